@@ -0,0 +1,20 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+
+#include "craw_benchmarks.h"
+
+void craw_benchmarks_bytewise_zero_bytes(uint8_t *_Nonnull ptr, size_t size) {
+	volatile uint8_t *volatile p = ptr;
+	while (size--) {
+		*p++ = 0;
+	}
+}
+
+uint64_t craw_benchmarks_bytewise_assert_zero_bytes(const uint8_t *_Nonnull volatile ptr, size_t size) {
+	const volatile uint8_t *volatile p = (const volatile uint8_t *)ptr;
+	volatile uint64_t sum = 0;
+	for (size_t i = 0; i < size; i++) {
+		sum |= p[i];
+	}
+	return sum;
+}
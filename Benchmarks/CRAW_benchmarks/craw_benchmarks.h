@@ -0,0 +1,16 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+
+#ifndef __CRAW_BENCHMARKS_H
+#define __CRAW_BENCHMARKS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/// @brief the byte at a time volatile zeroing loop that __craw_secure_zero_bytes replaced. a baseline for the benchmarks only.
+void craw_benchmarks_bytewise_zero_bytes(uint8_t *_Nonnull ptr, size_t size);
+
+/// @brief the byte at a time volatile verification loop that __craw_assert_secure_zero_bytes replaced. a baseline for the benchmarks only.
+uint64_t craw_benchmarks_bytewise_assert_zero_bytes(const uint8_t *_Nonnull volatile ptr, size_t size);
+
+#endif
@@ -0,0 +1,52 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import RAW
+import RAW_base64
+
+/// the bulk base64 codec over a 16 MiB buffer.
+func base64BulkBenchmark() throws {
+	let bytes = try generateSecureRandomBytes(count:16 * 1024 * 1024)
+	let clock = ContinuousClock()
+	var encoded = ""
+	let encodeElapsed = clock.measure {
+		encoded = String(RAW_base64.encode(bytes))
+	}
+	var decoded = [UInt8]()
+	let decodeElapsed = try clock.measure {
+		decoded = try RAW_base64.decode(encoded)
+	}
+	precondition(decoded == bytes)
+	for (name, count, elapsed) in [("encode", bytes.count, encodeElapsed), ("decode", encoded.utf8.count, decodeElapsed)] {
+		print("RAW_base64 bulk \(name): \(millionsPerSecond(count, elapsed)) MB/s")
+	}
+}
+
+/// the streaming base64 codec over a 16 MiB buffer, without and with line breaks.
+func base64StreamingBenchmark() throws {
+	let bytes = try generateSecureRandomBytes(count:16 * 1024 * 1024)
+	let clock = ContinuousClock()
+	for lineLength in [0, 76] {
+		var encoded = [UInt8]()
+		encoded.reserveCapacity(bytes.count * 2)
+		var encoder = StreamingEncoder(lineLength:lineLength)
+		let encodeElapsed = bytes.withUnsafeBytes { input in
+			clock.measure {
+				encoder.update(input) { encoded.append(contentsOf:$0) }
+				encoder.finish { encoded.append(contentsOf:$0) }
+			}
+		}
+		var decoded = [UInt8]()
+		decoded.reserveCapacity(bytes.count)
+		var decoder = StreamingDecoder()
+		let decodeElapsed = try encoded.withUnsafeBytes { input in
+			try clock.measure {
+				try decoder.update(input) { decoded.append(contentsOf:$0) }
+				try decoder.finish { decoded.append(contentsOf:$0) }
+			}
+		}
+		precondition(decoded == bytes)
+		for (name, count, elapsed) in [("encode", bytes.count, encodeElapsed), ("decode", encoded.count, decodeElapsed)] {
+			print("RAW_base64 streaming \(name), line length \(lineLength): \(millionsPerSecond(count, elapsed)) MB/s")
+		}
+	}
+}
@@ -0,0 +1,68 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import RAW
+
+/// RAW_constant_time_equal over equal buffers of the sizes of keys, digests and pages.
+func constantTimeEqualBenchmark() throws {
+	for size in [16, 32, 64, 4096] {
+		let a = try generateSecureRandomBytes(count:size)
+		let b = a
+		let rounds = 64 * 1024 * 1024 / size
+		var equal = 0
+		let clock = ContinuousClock()
+		let elapsed = a.withUnsafeBytes { aBytes in
+			b.withUnsafeBytes { bBytes in
+				clock.measure {
+					for _ in 0..<rounds where RAW_constant_time_equal(aBytes.baseAddress!, bBytes.baseAddress!, count:size) {
+						equal += 1
+					}
+				}
+			}
+		}
+		precondition(equal == rounds)
+		print("RAW_constant_time_equal \(size) bytes: \(millionsPerSecond(rounds, elapsed)) M/s, \(millionsPerSecond(rounds * size, elapsed)) MB/s")
+	}
+}
+
+/// welch's t-test over the time taken by RAW_constant_time_equal to compare buffers that differ in their first byte against buffers that differ in their last byte. an early exit comparison separates the two classes by an order of magnitude at this size, a constant time one keeps |t| small.
+func constantTimeLeakBenchmark() throws {
+	let size = 4096
+	let samples = 40_000
+	let a = try generateSecureRandomBytes(count:size)
+	var early = a
+	early[0] ^= 1
+	var late = a
+	late[size - 1] ^= 1
+	let clock = ContinuousClock()
+	var measured:[[Double]] = [[], []]
+	var unequal = 0
+	a.withUnsafeBytes { aBytes in
+		early.withUnsafeBytes { earlyBytes in
+			late.withUnsafeBytes { lateBytes in
+				for _ in 0..<samples {
+					let selected = Int.random(in:0...1)
+					let other = selected == 0 ? earlyBytes : lateBytes
+					let start = clock.now
+					let equal = RAW_constant_time_equal(aBytes.baseAddress!, other.baseAddress!, count:size)
+					let elapsed = clock.now - start
+					if equal == false {
+						unequal += 1
+					}
+					measured[selected].append(seconds(elapsed) * 1e9)
+				}
+			}
+		}
+	}
+	precondition(unequal == samples)
+
+	// crop the slowest samples, which are dominated by interrupts and scheduling
+	let cutoff = (measured[0] + measured[1]).sorted()[samples * 9 / 10]
+	let classes = measured.map { $0.filter { $0 <= cutoff } }
+	let statistics = classes.map { values -> (mean:Double, variance:Double, count:Double) in
+		let mean = values.reduce(0, +) / Double(values.count)
+		let variance = values.reduce(0) { $0 + ($1 - mean) * ($1 - mean) } / Double(values.count - 1)
+		return (mean, variance, Double(values.count))
+	}
+	let t = (statistics[0].mean - statistics[1].mean) / (statistics[0].variance / statistics[0].count + statistics[1].variance / statistics[1].count).squareRoot()
+	print("RAW_constant_time_equal \(size) bytes: first byte differs \(Int(statistics[0].mean)) ns, last byte differs \(Int(statistics[1].mean)) ns, t = \(t)")
+}
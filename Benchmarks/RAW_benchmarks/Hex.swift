@@ -0,0 +1,35 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import RAW_hex
+
+/// the bulk hex codec over many short digests, as when logging, and over one large buffer. decoding is compared with the per-element decoder of character sequences.
+func hexBulkBenchmark() throws {
+	let clock = ContinuousClock()
+	for (size, rounds) in [(32, 100_000), (4 * 1024 * 1024, 4)] {
+		let bytes = (0..<size).map { _ in UInt8.random(in:0...255) }
+		let encoded = RAW_hex.encode(bytes)
+		var string = ""
+		let bulkEncode = clock.measure {
+			for _ in 0..<rounds {
+				string = String(encoded)
+			}
+		}
+		let characters = Array(string)
+		var bulkDecoded = [UInt8]()
+		var elementDecoded = [UInt8]()
+		let bulkDecode = try clock.measure {
+			for _ in 0..<rounds {
+				bulkDecoded = try RAW_hex.decode(string)
+			}
+		}
+		let elementDecode = try clock.measure {
+			for _ in 0..<rounds {
+				elementDecoded = try RAW_hex.decode(characters)
+			}
+		}
+		precondition(bulkDecoded == bytes && elementDecoded == bytes)
+		let total = size * rounds
+		print("RAW_hex \(size) bytes encode: bulk \(millionsPerSecond(total, bulkEncode)) MB/s")
+		print("RAW_hex \(size) bytes decode: bulk \(millionsPerSecond(total, bulkDecode)) MB/s, per-element \(millionsPerSecond(total, elementDecode)) MB/s")
+	}
+}
@@ -0,0 +1,12 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+
+/// the length of a duration in seconds.
+func seconds(_ duration:Duration) -> Double {
+	return Double(duration.components.seconds) + Double(duration.components.attoseconds) / 1e18
+}
+
+/// the rate of a count over a duration, in millions per second.
+func millionsPerSecond(_ count:Int, _ duration:Duration) -> Int {
+	return Int(Double(count) / seconds(duration) / 1_000_000)
+}
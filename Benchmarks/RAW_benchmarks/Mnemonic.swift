@@ -0,0 +1,42 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import RAW_mnemonic
+
+/// BIP39 seed derivation. each seed is 2048 iterations of HMAC-SHA512, two compressions per iteration.
+func mnemonicSeedBenchmark() throws {
+	let words = try [UInt8](repeating:0x5a, count:32).withUnsafeBufferPointer { try Mnemonic.encode($0) }
+	let seedCount = 100
+	let clock = ContinuousClock()
+	let elapsed = try clock.measure {
+		for i in 0..<seedCount {
+			_ = try Mnemonic.seed(words, passphrase:"\(i)")
+		}
+	}
+	print("RAW_mnemonic seed derivation: \(Int(Double(seedCount) / seconds(elapsed))) seeds/s, \(Int(Double(seedCount * 2048) / seconds(elapsed))) HMAC-SHA512 iterations/s")
+}
+
+/// encoding and decoding 24 word sentences through caller buffers.
+func mnemonicSentenceBenchmark() throws {
+	let entropy = (0..<32).map { _ in UInt8.random(in:0...255) }
+	var sentence = [UInt8](repeating:0, count:Mnemonic.maximumSentenceByteCount(bytes:32))
+	var decoded = [UInt8](repeating:0, count:32)
+	let rounds = 100_000
+	let clock = ContinuousClock()
+	var written = 0
+	let encodeTime = try clock.measure {
+		for _ in 0..<rounds {
+			written = try entropy.withUnsafeBufferPointer { entropyBuffer in
+				try sentence.withUnsafeMutableBytes { try Mnemonic.encode(entropyBuffer, into:$0) }
+			}
+		}
+	}
+	let decodeTime = try clock.measure {
+		for _ in 0..<rounds {
+			_ = try decoded.withUnsafeMutableBytes { decodedBuffer in
+				try sentence.prefix(written).withUnsafeBytes { try Mnemonic.decode(sentence:$0, into:decodedBuffer) }
+			}
+		}
+	}
+	precondition(decoded == entropy)
+	print("RAW_mnemonic 24 word sentences: encode \(encodeTime / rounds) each, decode \(decodeTime / rounds) each")
+}
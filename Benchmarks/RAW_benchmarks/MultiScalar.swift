@@ -0,0 +1,38 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import RAW
+import RAW_dh25519
+import RAW_ed25519
+import __crawdog_curve25519
+
+/// the points per second of both ed25519 multi-scalar multiplication methods, for batches doubling in size up to 4096. shows where pippenger overtakes straus.
+func multiScalarMultiplyBenchmark() throws {
+	let clock = ContinuousClock()
+	let maxCount = 4096
+	var scalarBytes = [UInt8]()
+	var pointBytes = [UInt8]()
+	scalarBytes.reserveCapacity(maxCount * 32)
+	pointBytes.reserveCapacity(maxCount * 32)
+	for _ in 0..<maxCount {
+		let secretKey = MemoryGuarded<RAW_dh25519.PrivateKey>(RAW_decode:try generateSecureRandomBytes(count:32), count:32)!
+		try RAW_ed25519.generateKeys(secretKey:secretKey).0.RAW_access { pointBytes.append(contentsOf:$0) }
+		scalarBytes.append(contentsOf:try generateSecureRandomBytes(count:32))
+	}
+	var result = [UInt8](repeating:0, count:32)
+	var count = 1
+	while count <= maxCount {
+		for (name, method) in [("straus", __CRAWDOG_ED25519_MSM_STRAUS), ("pippenger", __CRAWDOG_ED25519_MSM_PIPPENGER)] {
+			var rounds = 0
+			var elapsed = Duration.zero
+			while elapsed < .milliseconds(50) {
+				elapsed += clock.measure {
+					let success = __crawdog_ed25519_multi_scalar_mult(&result, scalarBytes, pointBytes, count, method)
+					precondition(success == 1)
+				}
+				rounds += 1
+			}
+			print("RAW_ed25519 multi-scalar multiply \(count) points: \(name) \(Int(Double(count * rounds) / seconds(elapsed))) points/s")
+		}
+		count *= 2
+	}
+}
@@ -0,0 +1,39 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import RAW
+import CRAW_benchmarks
+
+/// secureZeroBytes against the byte at a time volatile loops that it replaced, and against a plain memset fill, which bounds what any zeroing can do.
+func secureZeroBenchmark() throws {
+	let byteCount = 16 * 1024 * 1024
+	let buffer = UnsafeMutableRawBufferPointer.allocate(byteCount:byteCount + 1, alignment:64)
+	defer { buffer.deallocate() }
+	// start one byte in so the unaligned head and tail paths run too
+	let region = UnsafeMutableRawBufferPointer(rebasing:buffer[1...])
+	let bytes = region.baseAddress!.assumingMemoryBound(to:UInt8.self)
+	let rounds = 8
+	let clock = ContinuousClock()
+	let current = try clock.measure {
+		for _ in 0..<rounds {
+			region.initializeMemory(as:UInt8.self, repeating:0xA5)
+			try secureZeroBytes(region)
+		}
+	}
+	let baseline = clock.measure {
+		for _ in 0..<rounds {
+			region.initializeMemory(as:UInt8.self, repeating:0xA5)
+			craw_benchmarks_bytewise_zero_bytes(bytes, byteCount)
+			precondition(craw_benchmarks_bytewise_assert_zero_bytes(bytes, byteCount) == 0)
+		}
+	}
+	let fill = clock.measure {
+		for _ in 0..<rounds {
+			region.initializeMemory(as:UInt8.self, repeating:0xA5)
+			region.initializeMemory(as:UInt8.self, repeating:0)
+		}
+	}
+	precondition(region.allSatisfy { $0 == 0 })
+	for (name, elapsed) in [("secureZeroBytes (fill, zero and verify)", current), ("byte at a time baseline (fill, zero and verify)", baseline), ("memset (fill and zero)", fill)] {
+		print("\(name): \(millionsPerSecond(byteCount * rounds, elapsed)) MB/s")
+	}
+}
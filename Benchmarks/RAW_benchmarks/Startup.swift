@@ -0,0 +1,145 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+#if canImport(Darwin)
+import Darwin
+#else
+import Glibc
+#endif
+import RAW
+import RAW_hex
+import RAW_base64
+import RAW_blake2
+import RAW_md5
+import RAW_sha1
+import RAW_sha256
+import RAW_sha512
+import RAW_hmac
+import RAW_chachapoly
+import RAW_xchachapoly
+import RAW_dh25519
+import RAW_ed25519
+import RAW_ristretto255
+import RAW_mnemonic
+
+/// thrown when a startup measurement process fails or prints something unexpected.
+struct StartupMeasurementFailure:Swift.Error {
+	let product:String
+}
+
+/// the first use of every product. each body runs twice in a fresh process: the first run pays for every lazy global, metadata and protocol conformance lookup and page of constant data that it touches.
+private let startupProducts:[(name:String, body:@Sendable () throws -> Void)] = {
+	let bytes = [UInt8](repeating:0x5A, count:32)
+	let nonceBytes = [UInt8](repeating:0xA5, count:24)
+	return [
+		("RAW", {
+			_ = try generateSecureRandomBytes(count:32)
+		}),
+		("RAW_hex", {
+			precondition(try RAW_hex.decode(RAW_hex.encode(bytes, uppercase:false)) == bytes)
+		}),
+		("RAW_base64", {
+			precondition(try RAW_base64.decode(String(RAW_base64.encode(bytes))) == bytes)
+		}),
+		("RAW_blake2", {
+			var hasher = try RAW_blake2.Hasher<RAW_blake2.B, [UInt8]>(outputCount:32)
+			try hasher.update(bytes)
+			_ = try hasher.finish()
+		}),
+		("RAW_md5", {
+			_ = try RAW_md5.Hasher<RAW_md5.Hash>.hash(bytes)
+		}),
+		("RAW_sha1", {
+			_ = try RAW_sha1.Hasher<RAW_sha1.Hash>.hash(bytes)
+		}),
+		("RAW_sha256", {
+			_ = try RAW_sha256.Hasher<RAW_sha256.Hash>.hash(bytes)
+		}),
+		("RAW_sha512", {
+			_ = try RAW_sha512.Hasher<RAW_sha512.Hash>.hash(bytes)
+		}),
+		("RAW_hmac", {
+			var hmac = try RAW_hmac.HMAC<RAW_sha256.Hasher<RAW_sha256.Hash>>(key:bytes)
+			try hmac.update(message:bytes)
+			_ = try hmac.finish()
+		}),
+		("RAW_chachapoly", {
+			var context = RAW_chachapoly.Context(key:RAW_chachapoly.Key32(RAW_staticbuff:bytes))
+			let nonce = RAW_chachapoly.Nonce(RAW_staticbuff:Array(nonceBytes.prefix(12)))
+			var output = [UInt8](repeating:0, count:bytes.count)
+			_ = try bytes.RAW_access { input in
+				try output.withUnsafeMutableBufferPointer { try context.encrypt(nonce:nonce, associatedData:input, inputData:input, output:$0.baseAddress!) }
+			}
+		}),
+		("RAW_xchachapoly", {
+			var context = RAW_xchachapoly.Context(key:RAW_xchachapoly.Key(RAW_staticbuff:bytes))
+			let nonce = RAW_xchachapoly.Nonce(RAW_staticbuff:nonceBytes)
+			var output = [UInt8](repeating:0, count:bytes.count)
+			_ = try bytes.RAW_access { input in
+				try output.withUnsafeMutableBufferPointer { try context.encrypt(nonce:nonce, associatedData:input, inputData:input, output:$0.baseAddress!) }
+			}
+		}),
+		("RAW_dh25519", {
+			let privateKey = try RAW_dh25519.PrivateKey.new()
+			_ = RAW_dh25519.PublicKey(privateKey:privateKey)
+		}),
+		("RAW_ed25519", {
+			let secretKey = MemoryGuarded<RAW_dh25519.PrivateKey>(RAW_decode:bytes, count:32)!
+			let (publicKey, privateKey) = try RAW_ed25519.generateKeys(secretKey:secretKey)
+			var signature = [UInt8](repeating:0, count:64)
+			bytes.RAW_access { message in
+				signature.withUnsafeMutableBufferPointer { RAW_ed25519.sign(to:$0.baseAddress!, privateKey:privateKey, message:message) }
+				precondition(signature.withUnsafeBufferPointer { RAW_ed25519.verify(signature:$0.baseAddress!, publicKey:publicKey, message:message) })
+			}
+		}),
+		("RAW_ristretto255", {
+			precondition(try RAW_ristretto255.Element.generator.adding(RAW_ristretto255.Element.generator).isValid)
+		}),
+		("RAW_mnemonic", {
+			let words = try bytes.withUnsafeBufferPointer { try Mnemonic.encode($0) }
+			var decoded = [UInt8](repeating:0, count:32)
+			try decoded.withUnsafeMutableBufferPointer { try Mnemonic.decode(words, into:$0.baseAddress!) }
+			precondition(decoded == bytes)
+		}),
+	]
+}()
+
+private func nanoseconds(_ duration:Duration) -> Int {
+	return Int(seconds(duration) * 1e9)
+}
+
+/// run in a fresh process: time the first call into a product and a second call right after it, and print both in nanoseconds.
+func startupMeasurement(_ product:String) throws {
+	guard let body = startupProducts.first(where:{ $0.name == product })?.body else {
+		throw StartupMeasurementFailure(product:product)
+	}
+	let clock = ContinuousClock()
+	let first = try clock.measure(body)
+	let second = try clock.measure(body)
+	print(nanoseconds(first), nanoseconds(second))
+}
+
+/// the first-call and second-call latency of every product, each measured in its own process so that no other product has warmed what it shares. reports the median of several processes.
+func startupBenchmark() throws {
+	let processes = 9
+	for product in startupProducts.map(\.name) {
+		var firstCalls = [Int]()
+		var secondCalls = [Int]()
+		for _ in 0..<processes {
+			guard let pipe = popen("'\(CommandLine.arguments[0])' --startup \(product)", "r") else {
+				throw StartupMeasurementFailure(product:product)
+			}
+			var line = [CChar](repeating:0, count:128)
+			let read = fgets(&line, Int32(line.count), pipe) != nil
+			guard pclose(pipe) == 0 && read else {
+				throw StartupMeasurementFailure(product:product)
+			}
+			let fields = line.withUnsafeBufferPointer { String(cString:$0.baseAddress!) }.split(separator:" ").compactMap { Int($0.filter(\.isNumber)) }
+			guard fields.count == 2 else {
+				throw StartupMeasurementFailure(product:product)
+			}
+			firstCalls.append(fields[0])
+			secondCalls.append(fields[1])
+		}
+		print("\(product) first call \(firstCalls.sorted()[processes / 2]) ns, second call \(secondCalls.sorted()[processes / 2]) ns (median of \(processes) processes)")
+	}
+}
@@ -0,0 +1,36 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import RAW
+import RAW_sha256
+
+/// lookups of 32 byte digests in a RAW_staticbuff_table against a Set.
+func staticbuffTableBenchmark() throws {
+	let keys = try (0..<(1 << 18)).map { _ in try RAW_sha256.Hasher<RAW_sha256.Hash>.hash(try generateSecureRandomBytes(count:32)) }
+	let table = RAW_staticbuff_table<RAW_sha256.Hash, Void>(minimumCapacity:keys.count)
+	var set = Set<RAW_sha256.Hash>(minimumCapacity:keys.count)
+	for key in keys {
+		table.insert(key)
+		set.insert(key)
+	}
+	let rounds = 4
+	var found = 0
+	let clock = ContinuousClock()
+	let tableElapsed = clock.measure {
+		for _ in 0..<rounds {
+			for key in keys where table.contains(key) {
+				found += 1
+			}
+		}
+	}
+	let setElapsed = clock.measure {
+		for _ in 0..<rounds {
+			for key in keys where set.contains(key) {
+				found += 1
+			}
+		}
+	}
+	precondition(found == 2 * rounds * keys.count)
+	for (name, elapsed) in [("RAW_staticbuff_table", tableElapsed), ("Set", setElapsed)] {
+		print("\(name) 32 byte digest lookups: \(millionsPerSecond(rounds * keys.count, elapsed)) M/s")
+	}
+}
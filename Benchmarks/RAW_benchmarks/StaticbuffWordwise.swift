@@ -0,0 +1,26 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import RAW
+
+@RAW_staticbuff(bytes:32)
+fileprivate struct Wordwise32:Sendable, Hashable, Equatable {}
+
+/// the generated word-wise `==` of a 32 byte static buffer.
+func staticbuffEqualityBenchmark() throws {
+	let a = Wordwise32(RAW_staticbuff:try generateSecureRandomBytes(count:32))
+	var b = a
+	let rounds = 10_000_000
+	var equal = 0
+	let clock = ContinuousClock()
+	let elapsed = clock.measure {
+		for i in 0..<rounds {
+			// vary the operand so the comparison is not hoisted out of the loop
+			b.RAW_access_mutating { $0[31] = UInt8(truncatingIfNeeded:i & 1) }
+			if a == b {
+				equal += 1
+			}
+		}
+	}
+	precondition(equal > 0)
+	print("RAW_staticbuff 32 byte equality: \(millionsPerSecond(rounds, elapsed)) M/s")
+}
@@ -0,0 +1,29 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+
+// the benchmarks of the package, kept out of the test suite so that the tests stay fast and deterministic.
+// run them in release mode: `swift run -c release RAW_benchmarks [name ...]`. with no names, every benchmark runs.
+let benchmarks:[(name:String, run:() throws -> Void)] = [
+	("secure_zero", secureZeroBenchmark),
+	("constant_time_equal", constantTimeEqualBenchmark),
+	("constant_time_leak", constantTimeLeakBenchmark),
+	("base64_bulk", base64BulkBenchmark),
+	("base64_streaming", base64StreamingBenchmark),
+	("hex_bulk", hexBulkBenchmark),
+	("ed25519_msm", multiScalarMultiplyBenchmark),
+	("mnemonic_sentence", mnemonicSentenceBenchmark),
+	("mnemonic_seed", mnemonicSeedBenchmark),
+	("staticbuff_equality", staticbuffEqualityBenchmark),
+	("staticbuff_table", staticbuffTableBenchmark),
+	("startup", startupBenchmark),
+]
+
+if CommandLine.arguments.count == 3 && CommandLine.arguments[1] == "--startup" {
+	// one measurement of the startup benchmark, in a process of its own
+	try startupMeasurement(CommandLine.arguments[2])
+} else {
+	let selected = CommandLine.arguments.dropFirst()
+	for benchmark in benchmarks where selected.isEmpty || selected.contains(benchmark.name) {
+		try benchmark.run()
+	}
+}
@@ -19,11 +19,13 @@ fileprivate func rawHexDependencies() -> [Target.Dependency] {
 	#if RAWDOG_HEX_LOG
 	return [
 		"RAW",
+		"__crawdog_hex",
 		.product(name: "Logging", package:"swift-log")
 	]
 	#else
 	return [
 		"RAW",
+		"__crawdog_hex",
 	]
 	#endif
 }
@@ -32,11 +34,13 @@ fileprivate func rawBase64Dependencies() -> [Target.Dependency] {
 	#if RAWDOG_BASE64_LOG
 	return [
 		"RAW",
+		"__crawdog_base64",
 		.product(name: "Logging", package:"swift-log")
 	]
 	#else
 	return [
 		"RAW",
+		"__crawdog_base64",
 	]
 	#endif
 }
@@ -68,6 +72,9 @@ let package = Package(
 		.library(
 			name:"RAW_ed25519",
 			targets: ["RAW_ed25519"]),
+		.library(
+			name:"RAW_ristretto255",
+			targets: ["RAW_ristretto255"]),
 		.library(
 			name:"RAW_chachapoly",
 			targets: ["RAW_chachapoly"]),
@@ -119,13 +126,14 @@ let package = Package(
 		.target(name:"RAW_hmac", dependencies: ["RAW"]),
 		.target(name:"RAW_kdf", dependencies: ["RAW_hmac", "RAW"]),
 		.target(name:"RAW_md5", dependencies:["RAW", "__crawdog_md5"]),
-		.target(name:"RAW_mnemonic", dependencies:["RAW", "RAW_sha256"]),
+		.target(name:"RAW_mnemonic", dependencies:["RAW", "RAW_sha256", "RAW_sha512", "RAW_kdf", "__crawdog_mnemonic"]),
 		.target(name:"RAW_sha1", dependencies:["RAW", "__crawdog_sha1"]),
 		.target(name:"RAW_sha256", dependencies:["RAW", "__crawdog_sha256"]),
 		.target(name:"RAW_sha512", dependencies:["RAW", "__crawdog_sha512"]),
 		.target(name:"RAW_chachapoly", dependencies:["RAW", "__crawdog_chachapoly"]),
 		.target(name:"RAW_dh25519", dependencies:["RAW", "__crawdog_curve25519"]),
 		.target(name:"RAW_ed25519", dependencies:["RAW", "__crawdog_curve25519", "RAW_dh25519"]),
+		.target(name:"RAW_ristretto255", dependencies:["RAW", "__crawdog_curve25519"]),
 		.target(name:"RAW_bcrypt_blowfish", dependencies:["RAW", "__crawdog_crypt_blowfish"]),
 		.target(name:"RAW_blake2", dependencies:["RAW", "__crawdog_blake2"]),
 		.target(name:"RAW_base64", dependencies:rawBase64Dependencies()),
@@ -188,12 +196,24 @@ let package = Package(
 			name:"CRAW_base64",
 			path:"Tests/CRAW_base64"
 		),
+		.target(
+			name:"__crawdog_base64",
+			publicHeadersPath:"include"
+		),
+		.target(
+			name:"__crawdog_hex",
+			publicHeadersPath:"include"
+		),
+		.target(
+			name:"__crawdog_mnemonic",
+			publicHeadersPath:"include"
+		),
 		.target(name:"__crawdog_blake2",
 			publicHeadersPath:"include"
 		),
 		.target(
 			name: "__crawdog_chachapoly",
-			dependencies:["__crawdog_endianness", "__crawdog_chacha", "__crawdog_poly1305"],
+			dependencies:["CRAW", "__crawdog_endianness", "__crawdog_chacha", "__crawdog_poly1305"],
 			publicHeadersPath:"."
 		),
 		.target(
@@ -257,6 +277,19 @@ let package = Package(
 			path:"Tests/__crawdog_hashing-tests",
 			publicHeadersPath:"."
 		),
+
+		// benchmarks, kept out of the test suite. run with `swift run -c release RAW_benchmarks`
+		.executableTarget(
+			name:"RAW_benchmarks",
+			dependencies:["RAW", "RAW_base64", "RAW_blake2", "RAW_chachapoly", "RAW_dh25519", "RAW_ed25519", "RAW_hex", "RAW_hmac", "RAW_md5", "RAW_mnemonic", "RAW_ristretto255", "RAW_sha1", "RAW_sha256", "RAW_sha512", "RAW_xchachapoly", "__crawdog_curve25519", "CRAW_benchmarks"],
+			path:"Benchmarks/RAW_benchmarks"
+		),
+		.target(
+			name:"CRAW_benchmarks",
+			path:"Benchmarks/CRAW_benchmarks",
+			publicHeadersPath:"."
+		),
+
 		// system library for testing
 		.systemLibrary(
 			name:"syslibsodium",
@@ -279,6 +312,6 @@ let package = Package(
 				"RAW_xchachapoly",
 				"__crawdog_hchacha20-tests",
 				"__crawdog_argon2-tests",
-				"__crawdog_argon2", "RAW", "RAW_base64", "RAW_macros", "RAW_blake2", "RAW_hex", "CRAW_base64", "RAW_chachapoly", "__crawdog_crypt_blowfish-tests", "__crawdog_chachapoly-tests", "__crawdog_hashing-tests", "__crawdog_curve25519-tests", "RAW_hmac", "RAW_sha1", "RAW_sha256", "RAW_sha512", "RAW_mnemonic", "RAW_ed25519"], resources:[.process("blake2-kat.json")], swiftSettings:[.define("ED25519_TEST"), .define("TEST")])
+				"__crawdog_argon2", "RAW", "RAW_base64", "RAW_macros", "RAW_blake2", "RAW_hex", "CRAW_base64", "RAW_chachapoly", "__crawdog_crypt_blowfish-tests", "__crawdog_chachapoly-tests", "__crawdog_hashing-tests", "__crawdog_curve25519-tests", "RAW_hmac", "RAW_sha1", "RAW_sha256", "RAW_sha512", "RAW_mnemonic", "__crawdog_mnemonic", "RAW_ed25519", "RAW_ristretto255"], resources:[.process("blake2-kat.json")], swiftSettings:[.define("ED25519_TEST"), .define("TEST")])
 	]
 )
@@ -1,5 +1,6 @@
 #include "__craw.h"
 #include <stdint.h>
+#include <sys/stat.h>
 
 int __craw_get_system_errno() {
 	return errno;
@@ -73,18 +74,89 @@ int __craw_get_entropy_bytes(uint8_t *_Nonnull out, const size_t len) {
 	#endif
 }
 
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+// keeps the compiler from treating the zeroed region as dead and eliding the stores or, on the verification side, from assuming the stores are what is read back.
+#define CRAW_MEMORY_BARRIER(ptr) __asm__ __volatile__("" : : "r"(ptr) : "memory")
+
 void __craw_secure_zero_bytes(uint8_t *_Nonnull ptr, size_t size) {
-	volatile uint8_t *volatile p = ptr;
-	while (size--) {
-		*p++ = 0;
-	}
+	#ifdef _WIN32
+	SecureZeroMemory(ptr, size);
+	#else
+	// memset runs at full vector width. the barrier makes the stores observable, the same construction glibc uses for explicit_bzero.
+	memset(ptr, 0, size);
+	CRAW_MEMORY_BARRIER(ptr);
+	#endif
 }
 
 uint64_t __craw_assert_secure_zero_bytes(const uint8_t *_Nonnull volatile ptr, size_t size) {
-	const volatile uint8_t *volatile p = (const volatile uint8_t *)ptr;
-	volatile uint64_t sum = 0;
-	for (size_t i = 0; i < size; i++) {
-		sum |= p[i];
+	const uint8_t *p = (const uint8_t *)ptr;
+	uint64_t sum = 0;
+	CRAW_MEMORY_BARRIER(p);
+	// unaligned head
+	while (size > 0 && ((uintptr_t)p & 7) != 0) {
+		sum |= *p++;
+		size--;
+	}
+	// four independent word accumulators keep the loads pipelined and let the compiler vectorize the loop
+	uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+	while (size >= 32) {
+		uint64_t w[4];
+		memcpy(w, p, 32);
+		s0 |= w[0];
+		s1 |= w[1];
+		s2 |= w[2];
+		s3 |= w[3];
+		p += 32;
+		size -= 32;
+	}
+	sum |= s0 | s1 | s2 | s3;
+	// tail
+	while (size > 0) {
+		sum |= *p++;
+		size--;
 	}
+	CRAW_MEMORY_BARRIER(&sum);
 	return sum;
-}
\ No newline at end of file
+}
+
+int __craw_map_file(const char *_Nonnull path, const void *_Nullable *_Nonnull ptr_out, size_t *_Nonnull size_out) {
+	*ptr_out = NULL;
+	*size_out = 0;
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return errno;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0) {
+		int err = errno;
+		close(fd);
+		return err;
+	}
+	if (st.st_size == 0) {
+		close(fd);
+		return 0;
+	}
+	void *ptr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	int err = errno;
+	// the mapping keeps its own reference to the file
+	close(fd);
+	if (ptr == MAP_FAILED) {
+		return err;
+	}
+	#ifdef MADV_SEQUENTIAL
+	// records are decoded front to back, let the kernel read ahead aggressively
+	madvise(ptr, (size_t)st.st_size, MADV_SEQUENTIAL);
+	#endif
+	*ptr_out = ptr;
+	*size_out = (size_t)st.st_size;
+	return 0;
+}
+
+void __craw_unmap_file(const void *_Nullable ptr, size_t size) {
+	if (ptr != NULL && size > 0) {
+		munmap((void *)ptr, size);
+	}
+}
@@ -15,6 +15,7 @@
 #include <stdbool.h>
 #include "time.h"
 #include <sys/mman.h>
+#include <sys/uio.h>
 
 /// @brief a function that returns the current system errno for the process.
 /// @return the system errno
@@ -24,10 +25,64 @@ int __craw_get_system_errno();
 /// @return 0 on success, errno on failure.
 int __craw_get_entropy_bytes(uint8_t *_Nonnull buf, const size_t len);
 
+/// @brief fill a buffer of any length from the calling thread's buffered chacha20 csprng. the generator is seeded from the system entropy source on first use, after fork and periodically, and erases its key after every refill.
+/// @return 0 on success, errno when the generator could not be seeded.
+int __craw_random_bytes(uint8_t *_Nonnull out, size_t len);
+
 // secure zeroing function
 void __craw_secure_zero_bytes(uint8_t *_Nonnull ptr, size_t size);
 
 // used to ensure that memory has been zeroed
 uint64_t __craw_assert_secure_zero_bytes(const uint8_t *_Nonnull volatile ptr, size_t size);
 
+/// @brief allocate zeroed memory for a secret from the shared pool of mlocked pages. allocations up to 1024 bytes are packed into single page slabs with other secrets of the same size class, larger allocations get their own locked pages.
+/// @return the allocation, or NULL when memory could not be mapped or locked.
+void *_Nullable __craw_locked_alloc(size_t size);
+
+/// @brief zero and release memory returned by `__craw_locked_alloc`. the size must match the size that was allocated.
+void __craw_locked_free(void *_Nullable ptr, size_t size);
+
+/// @brief surround every slab that is mapped from now on with inaccessible guard pages. disabled by default. guard pages cost address space but no locked memory.
+void __craw_locked_set_guard_pages(bool enabled);
+
+/// @brief report the number of mapped slabs, live allocations and locked bytes of the shared pool.
+void __craw_locked_stats(size_t *_Nonnull slabs, size_t *_Nonnull slots, size_t *_Nonnull locked_bytes);
+
+/// @brief map a file read-only into memory for sequential reading. empty files are not mapped and report a NULL pointer with a size of 0.
+/// @return 0 on success, errno on failure.
+int __craw_map_file(const char *_Nonnull path, const void *_Nullable *_Nonnull ptr_out, size_t *_Nonnull size_out);
+
+/// @brief release a mapping returned by `__craw_map_file`.
+void __craw_unmap_file(const void *_Nullable ptr, size_t size);
+
+/// @brief hint that the memory at `ptr` will be read soon. compiles to a single prefetch instruction where the compiler supports it.
+static inline __attribute__((always_inline)) void __craw_prefetch(const void *_Nonnull ptr) {
+	#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(ptr, 0, 3);
+	#endif
+}
+
+/// @brief compare two buffers for equality in time that depends only on their length. the buffers are compared eight bytes at a time with the differences accumulated, so the comparison never exits early, and the accumulated difference is hidden from the optimizer before it is reduced to a result.
+/// @return true when the buffers hold the same bytes.
+static inline __attribute__((always_inline)) bool __craw_equals_constant_time(const void *_Nonnull a, const void *_Nonnull b, size_t len) {
+	const uint8_t *a8 = (const uint8_t *)a;
+	const uint8_t *b8 = (const uint8_t *)b;
+	uint64_t diff = 0;
+	size_t i = 0;
+	for (; i + 8 <= len; i += 8) {
+		uint64_t aw, bw;
+		memcpy(&aw, a8 + i, 8);
+		memcpy(&bw, b8 + i, 8);
+		diff |= aw ^ bw;
+	}
+	for (; i < len; i++) {
+		diff |= (uint64_t)(a8[i] ^ b8[i]);
+	}
+	#if defined(__GNUC__) || defined(__clang__)
+	__asm__ __volatile__("" : "+r"(diff));
+	#endif
+	// the top bit of (diff | -diff) is set exactly when diff is not zero
+	return (bool)((((diff | (0 - diff)) >> 63) ^ 1) & 1);
+}
+
 #endif // __CRAW_H
\ No newline at end of file
@@ -0,0 +1,183 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+
+#include "__craw.h"
+#include <pthread.h>
+
+// buffered csprng with fast key erasure.
+// - every thread owns a chacha20 key and a buffer of keystream. a refill runs chacha20 over a fresh block range, immediately replaces the key with the first 32 bytes of the output and keeps the rest as the buffer. the key that produced any output handed to a caller no longer exists.
+// - output is zeroed in the buffer as it is handed out, so earlier output cannot be recovered from the state either.
+// - the key is seeded from the system entropy source on first use, after a fork and after a fixed number of refills.
+// - requests larger than the buffer are served straight from the keystream of a one-off key.
+
+#define CRAW_RNG_BLOCKS 16
+#define CRAW_RNG_BUFFER_SIZE (CRAW_RNG_BLOCKS * 64)
+#define CRAW_RNG_KEY_SIZE 32
+#define CRAW_RNG_RESEED_INTERVAL 1024
+
+typedef struct {
+	uint32_t key[8];
+	uint8_t buffer[CRAW_RNG_BUFFER_SIZE];
+	size_t available;
+	uint64_t refills;
+	uint64_t fork_generation;
+	int seeded;
+} __craw_rng_state;
+
+static _Thread_local __craw_rng_state __craw_rng;
+static volatile uint64_t __craw_rng_fork_generation = 1;
+static pthread_once_t __craw_rng_once = PTHREAD_ONCE_INIT;
+static pthread_key_t __craw_rng_thread_key;
+
+#define CRAW_ROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+#define CRAW_QUARTERROUND(a, b, c, d) \
+	a += b; d ^= a; d = CRAW_ROTL32(d, 16); \
+	c += d; b ^= c; b = CRAW_ROTL32(b, 12); \
+	a += b; d ^= a; d = CRAW_ROTL32(d, 8); \
+	c += d; b ^= c; b = CRAW_ROTL32(b, 7);
+
+static void __craw_store32_le(uint8_t *_Nonnull p, uint32_t v) {
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t)(v >> 8);
+	p[2] = (uint8_t)(v >> 16);
+	p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t __craw_load32_le(const uint8_t *_Nonnull p) {
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// one chacha20 block (rfc 8439) with an all zero nonce.
+static void __craw_chacha20_block(uint8_t *_Nonnull out, const uint32_t *_Nonnull key, uint32_t counter) {
+	uint32_t input[16] = {
+		0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+		key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+		counter, 0, 0, 0
+	};
+	uint32_t x[16];
+	for (int i = 0; i < 16; i++) {
+		x[i] = input[i];
+	}
+	for (int i = 0; i < 10; i++) {
+		CRAW_QUARTERROUND(x[0], x[4], x[8], x[12])
+		CRAW_QUARTERROUND(x[1], x[5], x[9], x[13])
+		CRAW_QUARTERROUND(x[2], x[6], x[10], x[14])
+		CRAW_QUARTERROUND(x[3], x[7], x[11], x[15])
+		CRAW_QUARTERROUND(x[0], x[5], x[10], x[15])
+		CRAW_QUARTERROUND(x[1], x[6], x[11], x[12])
+		CRAW_QUARTERROUND(x[2], x[7], x[8], x[13])
+		CRAW_QUARTERROUND(x[3], x[4], x[9], x[14])
+	}
+	for (int i = 0; i < 16; i++) {
+		__craw_store32_le(out + 4 * i, x[i] + input[i]);
+	}
+	__craw_secure_zero_bytes((uint8_t *)x, sizeof(x));
+	__craw_secure_zero_bytes((uint8_t *)input, sizeof(input));
+}
+
+static void __craw_rng_fork_child(void) {
+	__craw_rng_fork_generation++;
+}
+
+static void __craw_rng_thread_exit(void *_Nullable state) {
+	if (state != NULL) {
+		__craw_secure_zero_bytes((uint8_t *)state, sizeof(__craw_rng_state));
+	}
+}
+
+static void __craw_rng_init_once(void) {
+	pthread_atfork(NULL, NULL, __craw_rng_fork_child);
+	pthread_key_create(&__craw_rng_thread_key, __craw_rng_thread_exit);
+}
+
+static int __craw_rng_seed(__craw_rng_state *_Nonnull state) {
+	uint8_t seed[CRAW_RNG_KEY_SIZE];
+	int result = __craw_get_entropy_bytes(seed, sizeof(seed));
+	if (result != 0) {
+		return result;
+	}
+	for (int i = 0; i < 8; i++) {
+		state->key[i] = __craw_load32_le(seed + 4 * i);
+	}
+	__craw_secure_zero_bytes(seed, sizeof(seed));
+	__craw_secure_zero_bytes(state->buffer, sizeof(state->buffer));
+	state->available = 0;
+	state->refills = 0;
+	state->fork_generation = __craw_rng_fork_generation;
+	if (state->seeded == 0) {
+		pthread_setspecific(__craw_rng_thread_key, state);
+	}
+	state->seeded = 1;
+	return 0;
+}
+
+// runs the keystream into the buffer and erases the key that produced it.
+static void __craw_rng_refill(__craw_rng_state *_Nonnull state) {
+	for (uint32_t i = 0; i < CRAW_RNG_BLOCKS; i++) {
+		__craw_chacha20_block(state->buffer + 64 * i, state->key, i);
+	}
+	for (int i = 0; i < 8; i++) {
+		state->key[i] = __craw_load32_le(state->buffer + 4 * i);
+	}
+	__craw_secure_zero_bytes(state->buffer, CRAW_RNG_KEY_SIZE);
+	state->available = CRAW_RNG_BUFFER_SIZE - CRAW_RNG_KEY_SIZE;
+	state->refills++;
+}
+
+int __craw_random_bytes(uint8_t *_Nonnull out, size_t len) {
+	__craw_rng_state *state = &__craw_rng;
+	pthread_once(&__craw_rng_once, __craw_rng_init_once);
+	if (state->seeded == 0 || state->fork_generation != __craw_rng_fork_generation || state->refills >= CRAW_RNG_RESEED_INTERVAL) {
+		int result = __craw_rng_seed(state);
+		if (result != 0) {
+			return result;
+		}
+	}
+
+	if (len > CRAW_RNG_BUFFER_SIZE) {
+		// derive a one-off stream key, replace the thread key, and stream the request directly from the one-off key.
+		uint32_t stream_key[8];
+		uint8_t block[64];
+		__craw_chacha20_block(block, state->key, 0);
+		for (int i = 0; i < 8; i++) {
+			state->key[i] = __craw_load32_le(block + 4 * i);
+			stream_key[i] = __craw_load32_le(block + CRAW_RNG_KEY_SIZE + 4 * i);
+		}
+		uint32_t counter = 0;
+		while (len >= 64) {
+			__craw_chacha20_block(out, stream_key, counter++);
+			out += 64;
+			len -= 64;
+			if (counter == 0) {
+				// 256GiB from one stream key, roll it forward
+				__craw_chacha20_block(block, stream_key, 0);
+				for (int i = 0; i < 8; i++) {
+					stream_key[i] = __craw_load32_le(block + 4 * i);
+				}
+				counter = 1;
+			}
+		}
+		if (len > 0) {
+			__craw_chacha20_block(block, stream_key, counter);
+			memcpy(out, block, len);
+		}
+		__craw_secure_zero_bytes(block, sizeof(block));
+		__craw_secure_zero_bytes((uint8_t *)stream_key, sizeof(stream_key));
+		state->refills++;
+		return 0;
+	}
+
+	while (len > 0) {
+		if (state->available == 0) {
+			__craw_rng_refill(state);
+		}
+		size_t take = len < state->available ? len : state->available;
+		uint8_t *source = state->buffer + CRAW_RNG_BUFFER_SIZE - state->available;
+		memcpy(out, source, take);
+		__craw_secure_zero_bytes(source, take);
+		state->available -= take;
+		out += take;
+		len -= take;
+	}
+	return 0;
+}
@@ -0,0 +1,288 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+
+#include "__craw.h"
+#include <pthread.h>
+#include <stddef.h>
+
+// locked memory slabs.
+// - every slab is a single page that is mlocked once, when the slab is mapped. the slab header sits at the start of the page and the rest of the page is cut into slots of one size class.
+// - a slot address is always inside its slab page, so the slab of any slot is found by rounding the slot address down to the page size.
+// - slabs with free slots are kept on a per-class list. a slab that becomes empty is kept as the single spare for its class, any other empty slab is unmapped.
+// - allocations larger than the largest size class get their own mlocked mapping, which is always surrounded by guard pages.
+
+#define CRAW_SLAB_MAGIC 0x52415753u
+#define CRAW_SLAB_CLASSES 7
+#define CRAW_SLAB_MAX_SLOTS 256
+#define CRAW_SLAB_HEADER_SIZE 64
+
+typedef struct __craw_slab {
+	uint32_t magic;
+	uint16_t class_index;
+	uint16_t used;
+	uint16_t capacity;
+	uint16_t guarded;
+	struct __craw_slab *prev;
+	struct __craw_slab *next;
+	uint64_t free_map[CRAW_SLAB_MAX_SLOTS / 64];
+} __craw_slab;
+
+_Static_assert(sizeof(__craw_slab) <= CRAW_SLAB_HEADER_SIZE, "slab header does not fit its reserved space");
+
+typedef struct {
+	pthread_mutex_t lock;
+	__craw_slab *partial;
+	__craw_slab *spare;
+} __craw_slab_class;
+
+static const size_t __craw_slab_class_sizes[CRAW_SLAB_CLASSES] = { 16, 32, 64, 128, 256, 512, 1024 };
+
+static __craw_slab_class __craw_slab_classes[CRAW_SLAB_CLASSES] = {
+	{ PTHREAD_MUTEX_INITIALIZER, NULL, NULL },
+	{ PTHREAD_MUTEX_INITIALIZER, NULL, NULL },
+	{ PTHREAD_MUTEX_INITIALIZER, NULL, NULL },
+	{ PTHREAD_MUTEX_INITIALIZER, NULL, NULL },
+	{ PTHREAD_MUTEX_INITIALIZER, NULL, NULL },
+	{ PTHREAD_MUTEX_INITIALIZER, NULL, NULL },
+	{ PTHREAD_MUTEX_INITIALIZER, NULL, NULL },
+};
+
+static pthread_mutex_t __craw_slab_stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static volatile int __craw_slab_guard_pages = 0;
+static size_t __craw_slab_mapped_slabs = 0;
+static size_t __craw_slab_live_slots = 0;
+static size_t __craw_slab_locked_bytes = 0;
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+static size_t __craw_slab_page_size(void) {
+	static size_t page_size = 0;
+	if (page_size == 0) {
+		long found = sysconf(_SC_PAGESIZE);
+		page_size = found > 0 ? (size_t)found : 4096;
+	}
+	return page_size;
+}
+
+static void __craw_slab_account(ptrdiff_t slabs, ptrdiff_t slots, ptrdiff_t locked_bytes) {
+	pthread_mutex_lock(&__craw_slab_stats_lock);
+	__craw_slab_mapped_slabs += slabs;
+	__craw_slab_live_slots += slots;
+	__craw_slab_locked_bytes += locked_bytes;
+	pthread_mutex_unlock(&__craw_slab_stats_lock);
+}
+
+// map and lock a region of page_count pages. when guarded is nonzero, the region is surrounded by an inaccessible page on each side.
+static uint8_t *_Nullable __craw_slab_map_locked(size_t page_count, int guarded) {
+	const size_t page_size = __craw_slab_page_size();
+	const size_t guard_size = guarded ? page_size : 0;
+	const size_t map_size = page_count * page_size + 2 * guard_size;
+
+	uint8_t *base = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (base == MAP_FAILED) {
+		return NULL;
+	}
+	if (guarded) {
+		if (mprotect(base, guard_size, PROT_NONE) != 0 || mprotect(base + map_size - guard_size, guard_size, PROT_NONE) != 0) {
+			munmap(base, map_size);
+			return NULL;
+		}
+	}
+	uint8_t *region = base + guard_size;
+	if (mlock(region, page_count * page_size) != 0) {
+		munmap(base, map_size);
+		return NULL;
+	}
+	#ifdef MADV_DONTDUMP
+	madvise(region, page_count * page_size, MADV_DONTDUMP);
+	#endif
+	return region;
+}
+
+static void __craw_slab_unmap_locked(uint8_t *_Nonnull region, size_t page_count, int guarded) {
+	const size_t page_size = __craw_slab_page_size();
+	const size_t guard_size = guarded ? page_size : 0;
+	__craw_secure_zero_bytes(region, page_count * page_size);
+	munlock(region, page_count * page_size);
+	munmap(region - guard_size, page_count * page_size + 2 * guard_size);
+}
+
+static int __craw_slab_class_for_size(size_t size) {
+	for (int i = 0; i < CRAW_SLAB_CLASSES; i++) {
+		if (size <= __craw_slab_class_sizes[i]) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static __craw_slab *_Nullable __craw_slab_create(int class_index) {
+	const size_t page_size = __craw_slab_page_size();
+	const int guarded = __craw_slab_guard_pages;
+	size_t capacity = (page_size - CRAW_SLAB_HEADER_SIZE) / __craw_slab_class_sizes[class_index];
+	if (capacity > CRAW_SLAB_MAX_SLOTS) {
+		capacity = CRAW_SLAB_MAX_SLOTS;
+	}
+
+	__craw_slab *slab = (__craw_slab *)__craw_slab_map_locked(1, guarded);
+	if (slab == NULL) {
+		return NULL;
+	}
+	slab->magic = CRAW_SLAB_MAGIC;
+	slab->class_index = (uint16_t)class_index;
+	slab->used = 0;
+	slab->capacity = (uint16_t)capacity;
+	slab->guarded = (uint16_t)guarded;
+	slab->prev = NULL;
+	slab->next = NULL;
+	for (size_t i = 0; i < CRAW_SLAB_MAX_SLOTS / 64; i++) {
+		slab->free_map[i] = 0;
+	}
+	for (size_t i = 0; i < capacity; i++) {
+		slab->free_map[i / 64] |= (uint64_t)1 << (i % 64);
+	}
+	__craw_slab_account(1, 0, (ptrdiff_t)page_size);
+	return slab;
+}
+
+static void __craw_slab_destroy(__craw_slab *_Nonnull slab) {
+	__craw_slab_unmap_locked((uint8_t *)slab, 1, slab->guarded);
+	__craw_slab_account(-1, 0, -(ptrdiff_t)__craw_slab_page_size());
+}
+
+static void __craw_slab_list_push(__craw_slab *_Nullable *_Nonnull head, __craw_slab *_Nonnull slab) {
+	slab->prev = NULL;
+	slab->next = *head;
+	if (*head != NULL) {
+		(*head)->prev = slab;
+	}
+	*head = slab;
+}
+
+static void __craw_slab_list_remove(__craw_slab *_Nullable *_Nonnull head, __craw_slab *_Nonnull slab) {
+	if (slab->prev != NULL) {
+		slab->prev->next = slab->next;
+	} else {
+		*head = slab->next;
+	}
+	if (slab->next != NULL) {
+		slab->next->prev = slab->prev;
+	}
+	slab->prev = NULL;
+	slab->next = NULL;
+}
+
+void *_Nullable __craw_locked_alloc(size_t size) {
+	if (size == 0) {
+		size = 1;
+	}
+	const int class_index = __craw_slab_class_for_size(size);
+	if (class_index < 0) {
+		// large secrets get a dedicated mapping
+		const size_t page_size = __craw_slab_page_size();
+		const size_t page_count = (size + page_size - 1) / page_size;
+		void *region = __craw_slab_map_locked(page_count, 1);
+		if (region != NULL) {
+			__craw_slab_account(0, 1, (ptrdiff_t)(page_count * page_size));
+		}
+		return region;
+	}
+
+	__craw_slab_class *cls = &__craw_slab_classes[class_index];
+	pthread_mutex_lock(&cls->lock);
+	__craw_slab *slab = cls->partial;
+	if (slab == NULL) {
+		if (cls->spare != NULL) {
+			slab = cls->spare;
+			cls->spare = NULL;
+		} else {
+			slab = __craw_slab_create(class_index);
+			if (slab == NULL) {
+				pthread_mutex_unlock(&cls->lock);
+				return NULL;
+			}
+		}
+		__craw_slab_list_push(&cls->partial, slab);
+	}
+
+	size_t slot = 0;
+	for (size_t i = 0; i < CRAW_SLAB_MAX_SLOTS / 64; i++) {
+		if (slab->free_map[i] != 0) {
+			slot = i * 64 + (size_t)__builtin_ctzll(slab->free_map[i]);
+			slab->free_map[i] &= slab->free_map[i] - 1;
+			break;
+		}
+	}
+	slab->used++;
+	if (slab->used == slab->capacity) {
+		__craw_slab_list_remove(&cls->partial, slab);
+	}
+	pthread_mutex_unlock(&cls->lock);
+	__craw_slab_account(0, 1, 0);
+	return (uint8_t *)slab + CRAW_SLAB_HEADER_SIZE + slot * __craw_slab_class_sizes[class_index];
+}
+
+void __craw_locked_free(void *_Nullable ptr, size_t size) {
+	if (ptr == NULL) {
+		return;
+	}
+	if (size == 0) {
+		size = 1;
+	}
+	const size_t page_size = __craw_slab_page_size();
+	const int class_index = __craw_slab_class_for_size(size);
+	if (class_index < 0) {
+		const size_t page_count = (size + page_size - 1) / page_size;
+		__craw_slab_unmap_locked(ptr, page_count, 1);
+		__craw_slab_account(0, -1, -(ptrdiff_t)(page_count * page_size));
+		return;
+	}
+
+	__craw_slab *slab = (__craw_slab *)((uintptr_t)ptr & ~(uintptr_t)(page_size - 1));
+	if (slab->magic != CRAW_SLAB_MAGIC || slab->class_index != class_index) {
+		abort();
+	}
+	const size_t class_size = __craw_slab_class_sizes[class_index];
+	const size_t slot = ((uint8_t *)ptr - ((uint8_t *)slab + CRAW_SLAB_HEADER_SIZE)) / class_size;
+	__craw_secure_zero_bytes((uint8_t *)slab + CRAW_SLAB_HEADER_SIZE + slot * class_size, class_size);
+
+	__craw_slab_class *cls = &__craw_slab_classes[class_index];
+	__craw_slab *release = NULL;
+	pthread_mutex_lock(&cls->lock);
+	if ((slab->free_map[slot / 64] >> (slot % 64)) & 1) {
+		// double free
+		abort();
+	}
+	if (slab->used == slab->capacity) {
+		__craw_slab_list_push(&cls->partial, slab);
+	}
+	slab->free_map[slot / 64] |= (uint64_t)1 << (slot % 64);
+	slab->used--;
+	if (slab->used == 0) {
+		__craw_slab_list_remove(&cls->partial, slab);
+		if (cls->spare == NULL) {
+			cls->spare = slab;
+		} else {
+			release = slab;
+		}
+	}
+	pthread_mutex_unlock(&cls->lock);
+	__craw_slab_account(0, -1, 0);
+	if (release != NULL) {
+		__craw_slab_destroy(release);
+	}
+}
+
+void __craw_locked_set_guard_pages(bool enabled) {
+	__craw_slab_guard_pages = enabled ? 1 : 0;
+}
+
+void __craw_locked_stats(size_t *_Nonnull slabs, size_t *_Nonnull slots, size_t *_Nonnull locked_bytes) {
+	pthread_mutex_lock(&__craw_slab_stats_lock);
+	*slabs = __craw_slab_mapped_slabs;
+	*slots = __craw_slab_live_slots;
+	*locked_bytes = __craw_slab_locked_bytes;
+	pthread_mutex_unlock(&__craw_slab_stats_lock);
+}
@@ -2,18 +2,15 @@
 // copyright (c) tanner silva 2024. all rights reserved.
 extension Array:RAW_accessible, RAW_encodable where Element == UInt8 {
     public mutating func RAW_access_mutating<R, E>(_ body: (UnsafeMutableBufferPointer<UInt8>) throws(E) -> R) throws(E) -> R where E:Swift.Error {
-    	func accessBytes(_ unsafePtr:UnsafeMutablePointer<UInt8>, _ cnt:Int) throws(E) -> R where E:Swift.Error {
-    		return try body(UnsafeMutableBufferPointer<UInt8>(start:unsafePtr, count:cnt))
-    	}
-		return try accessBytes(&self, count)
+		// the array storage is handed out directly, without an intermediate pointer to the array value
+		return try withUnsafeMutableBufferPointer { (buffer:inout UnsafeMutableBufferPointer<UInt8>) throws(E) -> R in
+			return try body(buffer)
+		}
     }
 	public borrowing func RAW_access<R, E>(_ body:(UnsafeBufferPointer<UInt8>) throws(E) -> R) throws(E) -> R where E:Swift.Error {
-		func accessBytes(_ unsafePtr:UnsafePointer<UInt8>, _ cnt:Int) throws(E) -> R where E:Swift.Error {
-    		return try body(UnsafeBufferPointer<UInt8>(start:unsafePtr, count:cnt))
-    	}
-    	return try withUnsafePointer(to:self) { (ptr:UnsafePointer<Self>) throws(E) -> R in
-    		return try accessBytes(ptr.pointee, ptr.pointee.count)
-    	}
+		return try withUnsafeBufferPointer { (buffer:UnsafeBufferPointer<UInt8>) throws(E) -> R in
+			return try body(buffer)
+		}
 	}
 	public borrowing func RAW_encode(count cntVar: inout size_t) {
 		cntVar += count
@@ -15,7 +15,18 @@
 										named(RAW_encode(count:)),
 									 	named(RAW_encode(dest:)),
 										named(RAW_compare(lhs_data:lhs_count:rhs_data:rhs_count:)),
-										named(RAW_compare(lhs_data:rhs_data:)))
+										named(RAW_compare(lhs_data:rhs_data:)),
+										named(==),
+										named(^),
+										named(&),
+										named(|),
+										named(~),
+										named(^=),
+										named(&=),
+										named(|=),
+										named(RAW_equals_constant_time(_:)),
+										named(RAW_hash_prefix),
+										named(RAW_staticbuff_hash(into:)))
 @attached(extension,	conformances:	RAW_staticbuff)
 public macro RAW_staticbuff(bytes:size_t) = #externalMacro(module:"RAW_macros", type:"RAW_staticbuff_bytes_macro")
 
@@ -29,7 +40,18 @@ public macro RAW_staticbuff(bytes:size_t) = #externalMacro(module:"RAW_macros",
 										named(RAW_encode(count:)),
 									 	named(RAW_encode(dest:)),
 										named(RAW_compare(lhs_data:lhs_count:rhs_data:rhs_count:)),
-										named(RAW_compare(lhs_data:rhs_data:)))
+										named(RAW_compare(lhs_data:rhs_data:)),
+										named(==),
+										named(^),
+										named(&),
+										named(|),
+										named(~),
+										named(^=),
+										named(&=),
+										named(|=),
+										named(RAW_equals_constant_time(_:)),
+										named(RAW_hash_prefix),
+										named(RAW_staticbuff_hash(into:)))
 @attached(extension,	conformances:	RAW_staticbuff)
 public macro RAW_staticbuff(concat:any RAW_staticbuff.Type...) = #externalMacro(module:"RAW_macros", type:"RAW_staticbuff_concat_macro")
 
@@ -64,4 +86,12 @@ public macro RAW_convertible_string_type<S:RAW_encoded_fixedwidthinteger>(_:any
 										named(RAW_encode(count:)),
 										named(RAW_encode(dest:)))
 @attached(extension,	conformances:	RAW_encoded_unicode)
-public macro RAW_convertible_string_type<U:UnicodeCodec>(backing: any RAW_encoded_fixedwidthinteger.Type) = #externalMacro(module:"RAW_macros", type:"RAW_convertible_string_type_macro_v2")
\ No newline at end of file
+public macro RAW_convertible_string_type<U:UnicodeCodec>(backing: any RAW_encoded_fixedwidthinteger.Type) = #externalMacro(module:"RAW_macros", type:"RAW_convertible_string_type_macro_v2")
+/// implements ``RAW_serializable`` for a struct from its stored properties, in declaration order.
+/// - every stored property needs an explicit type annotation. supported field types are FixedWidthInteger, Bool, RAW_staticbuff types, [UInt8], String, other RAW_serializable types and arrays of them.
+/// - the implementation is generated in an extension, so the memberwise initializer of the struct is kept.
+@attached(extension,	conformances:	RAW_serializable,
+						names:			named(RAW_serial_fixed_size),
+										named(RAW_serialize(into:)),
+										named(init(RAW_deserialize:)))
+public macro RAW_serializable() = #externalMacro(module:"RAW_macros", type:"RAW_serializable_macro")
@@ -3,24 +3,13 @@ import CRAW
 public final class MemoryGuarded<GuardedStaticbuffType>:@unchecked Sendable, RAW_decodable, RAW_accessible where GuardedStaticbuffType:RAW_staticbuff {
 	public struct MemoryPageLockFailure:Swift.Error {}
 
+	/// allocate zeroed, mlocked storage for a single value. values are packed into shared locked slab pages with other secrets of the same size class, so a small key does not lock a page of its own.
 	private static func memoryPrepare() throws -> UnsafeMutableRawPointer {
-		var storePtr:UnsafeMutableRawPointer? = nil
-		
-		#if os(Linux)
-		guard posix_memalign(&storePtr, RAW_sysconf(Int32(_SC_PAGESIZE)), MemoryLayout<GuardedStaticbuffType.RAW_staticbuff_storetype>.size) == 0 else {
+		guard let storePtr = __craw_locked_alloc(MemoryLayout<GuardedStaticbuffType.RAW_staticbuff_storetype>.size) else {
 			throw MemoryPageLockFailure()
 		}
-		#else
-		guard posix_memalign(&storePtr, RAW_sysconf(_SC_PAGESIZE), MemoryLayout<GuardedStaticbuffType.RAW_staticbuff_storetype>.size) == 0 else {
-			throw MemoryPageLockFailure()
-		}
-		#endif
-
-		guard RAW_mlock(storePtr, MemoryLayout<GuardedStaticbuffType.RAW_staticbuff_storetype>.size) == 0 else {
-			throw MemoryPageLockFailure()
-		}
-		try secureZeroBytes(storePtr!, count:MemoryLayout<GuardedStaticbuffType.RAW_staticbuff_storetype>.size)
-		return storePtr!
+		try secureZeroBytes(storePtr, count:MemoryLayout<GuardedStaticbuffType.RAW_staticbuff_storetype>.size)
+		return storePtr
 	}
 
 	private let storage:UnsafeMutableRawPointer
@@ -55,8 +44,31 @@ public final class MemoryGuarded<GuardedStaticbuffType>:@unchecked Sendable, RAW
 	}
 
 	deinit {
-		try? secureZeroBytes(storage, count:MemoryLayout<GuardedStaticbuffType.RAW_staticbuff_storetype>.size)
-		_ = RAW_munlock(storage, MemoryLayout<GuardedStaticbuffType.RAW_staticbuff_storetype>.size)
-		RAW_free(storage)
+		// the slot is zeroed before it is returned to its slab
+		__craw_locked_free(storage, MemoryLayout<GuardedStaticbuffType.RAW_staticbuff_storetype>.size)
+	}
+}
+
+extension MemoryGuarded:Equatable {
+	/// compare the guarded contents of two instances in constant time.
+	public static func == (lhs:MemoryGuarded, rhs:MemoryGuarded) -> Bool {
+		return lhs.RAW_equals_constant_time(rhs)
 	}
+
+	/// compare the guarded contents with another guarded value in time that does not depend on the contents.
+	public func RAW_equals_constant_time(_ other:MemoryGuarded) -> Bool {
+		return RAW_constant_time_equal(storage, other.storage, count:MemoryLayout<GuardedStaticbuffType.RAW_staticbuff_storetype>.size)
+	}
+
+	/// compare the guarded contents with an unguarded value in time that does not depend on the contents.
+	public func RAW_equals_constant_time(_ other:borrowing GuardedStaticbuffType) -> Bool {
+		return other.RAW_access_staticbuff { otherPtr in
+			RAW_constant_time_equal(storage, otherPtr, count:MemoryLayout<GuardedStaticbuffType.RAW_staticbuff_storetype>.size)
+		}
+	}
+}
+
+/// surround every locked slab page that backs ``MemoryGuarded`` values with inaccessible guard pages, so that an overrun faults instead of reaching the neighboring mapping. applies to slabs that are mapped after the call. disabled by default.
+public func memoryGuardedUseGuardPages(_ enabled:Bool) {
+	__craw_locked_set_guard_pages(enabled)
 }
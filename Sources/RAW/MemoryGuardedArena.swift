@@ -0,0 +1,61 @@
+import CRAW
+
+/// a fixed number of secret slots that share a single allocation from the pool of mlocked pages that also backs ``MemoryGuarded``.
+/// - the allocation happens once, when the arena is initialized. arenas up to 1024 bytes are packed into a shared locked slab, larger arenas get their own locked pages. reading, writing and clearing a slot afterwards makes no system calls and no heap allocations.
+/// - every slot is zeroed when the arena is initialized, when it is cleared, and when the arena is dereferenced.
+/// - the arena does not synchronize access to its slots. concurrent users must work on disjoint slots.
+public final class MemoryGuardedArena<GuardedStaticbuffType>:@unchecked Sendable where GuardedStaticbuffType:RAW_staticbuff {
+	/// the type of error that is thrown when the arena memory could not be allocated or locked.
+	public struct MemoryPageLockFailure:Swift.Error {}
+
+	/// the size of a single slot in bytes.
+	public static var slotSize:Int {
+		return MemoryLayout<GuardedStaticbuffType.RAW_staticbuff_storetype>.size
+	}
+
+	/// the number of slots in the arena.
+	public let count:Int
+
+	private let storage:UnsafeMutableRawPointer
+	private let byteCount:Int
+
+	/// allocate and lock the memory for a number of slots.
+	/// - parameters:
+	///		- count: the number of slots the arena holds.
+	public init(count:Int) throws {
+		precondition(count > 0, "a memory guarded arena needs at least one slot")
+		let byteCount = count * Self.slotSize
+		// the pool hands out zeroed memory
+		guard let storePtr = __craw_locked_alloc(byteCount) else {
+			throw MemoryPageLockFailure()
+		}
+		self.count = count
+		self.byteCount = byteCount
+		self.storage = storePtr
+	}
+
+	private func slotPointer(_ slot:Int) -> UnsafeMutablePointer<UInt8> {
+		precondition(slot >= 0 && slot < count, "memory guarded arena slot out of range")
+		return storage.advanced(by:slot * Self.slotSize).assumingMemoryBound(to:UInt8.self)
+	}
+
+	/// access the bytes of a slot.
+	public func RAW_access<R, E>(slot:Int, _ body:(UnsafeBufferPointer<UInt8>) throws(E) -> R) throws(E) -> R where E:Error {
+		try body(UnsafeBufferPointer(start:slotPointer(slot), count:Self.slotSize))
+	}
+
+	/// access the bytes of a slot for writing.
+	public func RAW_access_mutating<R, E>(slot:Int, _ body:(UnsafeMutableBufferPointer<UInt8>) throws(E) -> R) throws(E) -> R where E:Error {
+		try body(UnsafeMutableBufferPointer(start:slotPointer(slot), count:Self.slotSize))
+	}
+
+	/// securely zero the bytes of a slot so it can be reused.
+	public func clear(slot:Int) throws {
+		try secureZeroBytes(UnsafeMutableRawPointer(slotPointer(slot)), count:Self.slotSize)
+	}
+
+	deinit {
+		// the pool zeroes the memory before it is released
+		__craw_locked_free(storage, byteCount)
+	}
+}
@@ -7,6 +7,29 @@ public protocol RAW_accessible:RAW_encodable {
 	mutating func RAW_access_mutating<R, E>(_ body:(UnsafeMutableBufferPointer<UInt8>) throws(E) -> R) throws(E) -> R where E:Swift.Error
 }
 
+// borrowed span views. the span is only valid inside the closure and cannot escape it, so it carries no lifetime risk beyond that of the underlying access, and no bytes are copied.
+extension RAW_accessible {
+	/// allows for non-mutating access to the raw representation of the instance as a borrowed span of bytes.
+	public borrowing func RAW_access_span<R, E>(_ body:(Span<UInt8>) throws(E) -> R) throws(E) -> R where E:Swift.Error {
+		try RAW_access { (buffer:UnsafeBufferPointer<UInt8>) throws(E) -> R in
+			try body(buffer.span)
+		}
+	}
+	/// allows for non-mutating access to the raw representation of the instance as a borrowed raw span.
+	public borrowing func RAW_access_rawspan<R, E>(_ body:(RawSpan) throws(E) -> R) throws(E) -> R where E:Swift.Error {
+		try RAW_access { (buffer:UnsafeBufferPointer<UInt8>) throws(E) -> R in
+			try body(buffer.span.bytes)
+		}
+	}
+	/// allows for mutating access to the raw representation of the instance as an exclusive mutable span of bytes.
+	public mutating func RAW_access_span_mutating<R, E>(_ body:(inout MutableSpan<UInt8>) throws(E) -> R) throws(E) -> R where E:Swift.Error {
+		try RAW_access_mutating { (buffer:UnsafeMutableBufferPointer<UInt8>) throws(E) -> R in
+			var span = buffer.mutableSpan
+			return try body(&span)
+		}
+	}
+}
+
 extension RAW_accessible {
 	public borrowing func RAW_encode(count:inout size_t) {
 		RAW_access { buffer in
@@ -16,6 +16,7 @@ public protocol RAW_decodable_unbounded: RAW_decodable {
 
 	/// initialize from the contents of a raw data buffer that has no known boundaries on the forward end.
 	/// - WARNING: this protocol is SUPER RIDICULOUSLY, IRRESPONSIBLY UNSAFE. Implement this ONLY if you know that you need it and why.
+	/// - note: ``RAW_cursor`` decodes streams of concatenated records with bounds checks, and should be preferred.
 	static func RAW_decode(unbounded:inout UnsafeRawPointer) -> Self?
 }
 
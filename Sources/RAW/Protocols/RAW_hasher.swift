@@ -11,6 +11,8 @@ public protocol RAW_hasher {
 	mutating func update(_ :UnsafeBufferPointer<UInt8>) throws
 	/// update the hasher with new data with the specified data and length arguments
 	mutating func update(_ :UnsafeRawPointer, count:size_t) throws
+	/// update the hasher with a chain of fragments, in order. the result is the same as updating with each fragment in turn.
+	mutating func update(vectored:UnsafeBufferPointer<iovec>) throws
 	/// finish a hasher by outputting to a pointer
 	mutating func finish(into _:UnsafeMutableRawPointer) throws
 }
@@ -38,6 +40,34 @@ extension RAW_hasher {
 	public mutating func update(_ ptr:UnsafeRawPointer, count:size_t) throws {
 		try update(UnsafeRawBufferPointer(start:ptr, count:count))
 	}
+
+	public mutating func update(vectored vectors:UnsafeBufferPointer<iovec>) throws {
+		for vector in vectors where vector.iov_len > 0 {
+			try update(UnsafeRawPointer(vector.iov_base!), count:vector.iov_len)
+		}
+	}
+}
+
+extension RAW_hasher {
+	/// update the hasher with a collection of fragments, in order. the fragments are described to the hasher in a single stack allocated vector, so none of them are copied.
+	public mutating func update<C>(fragments:C) throws where C:Collection, C.Element == UnsafeRawBufferPointer {
+		try withUnsafeFragmentVectors(fragments) { vectors in
+			try update(vectored:vectors)
+		}
+	}
+}
+
+/// describe a collection of fragments as a temporary, stack allocated vector of iovec structures.
+public func withUnsafeFragmentVectors<C, R>(_ fragments:C, _ body:(UnsafeBufferPointer<iovec>) throws -> R) rethrows -> R where C:Collection, C.Element == UnsafeRawBufferPointer {
+	return try withUnsafeTemporaryAllocation(of:iovec.self, capacity:fragments.count) { vectors in
+		var count = 0
+		for fragment in fragments where fragment.count > 0 {
+			vectors.initializeElement(at:count, to:iovec(iov_base:UnsafeMutableRawPointer(mutating:fragment.baseAddress!), iov_len:fragment.count))
+			count += 1
+		}
+		// iovec is a trivial type, the slots need no deinitialization
+		return try body(UnsafeBufferPointer(rebasing:vectors.prefix(count)))
+	}
 }
 
 extension RAW_hasher {
@@ -50,6 +80,18 @@ extension RAW_hasher {
 			try update(buffer)
 		}
 	}
+	/// update the hasher with new data from a borrowed span
+	public mutating func update(_ span:Span<UInt8>) throws {
+		try span.withUnsafeBufferPointer { buffer in
+			try update(buffer)
+		}
+	}
+	/// update the hasher with new data from a borrowed raw span
+	public mutating func update(_ span:RawSpan) throws {
+		try span.withUnsafeBytes { buffer in
+			try update(buffer)
+		}
+	}
 	/// update the hasher with new data (unsafe pointer to accessible type)
 	public mutating func update<A>(_ data:UnsafePointer<A>) throws where A:RAW_accessible {
 		try data.pointee.RAW_access { buffer in
@@ -0,0 +1,180 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+
+/// a composite value that serializes its fields, in declaration order, into a ``RAW_serial_writer`` and reads them back from a ``RAW_serial_reader``.
+/// - fixed size fields (integers, booleans, static buffers, fixed size serializables) are written as-is. integers are little endian. `Int` and `UInt` are always written as 8 bytes, so the encoding does not depend on the platform.
+/// - variable size fields (byte arrays, strings, arrays of serializables, variable size serializables) are written with a varint length prefix.
+/// - this protocol is usually implemented with the ``RAW_serializable()`` macro.
+public protocol RAW_serializable {
+	/// the exact number of bytes every instance serializes to, or nil if the size depends on the value.
+	static var RAW_serial_fixed_size:Int? { get }
+
+	/// write the value to the end of the writer.
+	borrowing func RAW_serialize(into writer:RAW_serial_writer)
+
+	/// read a value from the reader, advancing it past the bytes that were consumed.
+	init(RAW_deserialize reader:inout RAW_serial_reader) throws(RAW_serial_error)
+}
+
+extension RAW_serializable {
+	/// serialize the value into a new byte array.
+	public borrowing func RAW_serialized() -> [UInt8] {
+		let writer = RAW_serial_writer(capacity:Self.RAW_serial_fixed_size ?? 256)
+		RAW_serialize(into:writer)
+		return writer.bytes()
+	}
+
+	/// read a value that occupies the entire buffer.
+	public init(RAW_deserialize buffer:UnsafeRawBufferPointer) throws(RAW_serial_error) {
+		var reader = RAW_serial_reader(buffer)
+		try self.init(RAW_deserialize:&reader)
+		try reader.finish()
+	}
+}
+
+// field level building blocks used by the code that the RAW_serializable macro generates.
+
+/// the serialized size of an integer field.
+public func RAW_serial_field_fixed_size<I>(of _:I.Type) -> Int? where I:FixedWidthInteger {
+	return MemoryLayout<I>.size
+}
+/// the serialized size of an `Int` field, which is 8 bytes on every platform.
+public func RAW_serial_field_fixed_size(of _:Int.Type) -> Int? {
+	return 8
+}
+/// the serialized size of a `UInt` field, which is 8 bytes on every platform.
+public func RAW_serial_field_fixed_size(of _:UInt.Type) -> Int? {
+	return 8
+}
+/// the serialized size of a boolean field.
+public func RAW_serial_field_fixed_size(of _:Bool.Type) -> Int? {
+	return 1
+}
+/// the serialized size of a static buffer field.
+public func RAW_serial_field_fixed_size<S>(of _:S.Type) -> Int? where S:RAW_staticbuff {
+	return MemoryLayout<S.RAW_staticbuff_storetype>.size
+}
+/// the serialized size of a nested serializable field.
+public func RAW_serial_field_fixed_size<T>(of _:T.Type) -> Int? where T:RAW_serializable {
+	return T.RAW_serial_fixed_size
+}
+/// byte arrays are length prefixed and have no fixed size.
+public func RAW_serial_field_fixed_size(of _:[UInt8].Type) -> Int? {
+	return nil
+}
+/// strings are length prefixed and have no fixed size.
+public func RAW_serial_field_fixed_size(of _:String.Type) -> Int? {
+	return nil
+}
+/// arrays are count prefixed and have no fixed size.
+public func RAW_serial_field_fixed_size<T>(of _:[T].Type) -> Int? where T:RAW_serializable {
+	return nil
+}
+
+extension RAW_serial_writer {
+	public func RAW_serialize_field<I>(_ value:I) where I:FixedWidthInteger {
+		write(littleEndian:value)
+	}
+	public func RAW_serialize_field(_ value:Int) {
+		write(littleEndian:Int64(value))
+	}
+	public func RAW_serialize_field(_ value:UInt) {
+		write(littleEndian:UInt64(value))
+	}
+	public func RAW_serialize_field(_ value:Bool) {
+		write(littleEndian:value ? 1 as UInt8 : 0)
+	}
+	public func RAW_serialize_field<S>(_ value:borrowing S) where S:RAW_staticbuff {
+		write(staticbuff:value)
+	}
+	public func RAW_serialize_field<T>(_ value:borrowing T) where T:RAW_serializable {
+		guard T.RAW_serial_fixed_size == nil else {
+			value.RAW_serialize(into:self)
+			return
+		}
+		// variable size values are length prefixed so that a reader can bound them
+		let prefix = beginLengthPrefix()
+		value.RAW_serialize(into:self)
+		endLengthPrefix(prefix)
+	}
+	public func RAW_serialize_field(_ value:[UInt8]) {
+		value.withUnsafeBytes { bytes in
+			write(lengthPrefixed:bytes)
+		}
+	}
+	public func RAW_serialize_field(_ value:String) {
+		var value = value
+		value.withUTF8 { utf8 in
+			write(lengthPrefixed:UnsafeRawBufferPointer(utf8))
+		}
+	}
+	public func RAW_serialize_field<T>(_ value:[T]) where T:RAW_serializable {
+		write(varint:UInt64(value.count))
+		if let fixedSize = T.RAW_serial_fixed_size {
+			reserve(fixedSize * value.count)
+		}
+		for element in value {
+			RAW_serialize_field(element)
+		}
+	}
+}
+
+extension RAW_serial_reader {
+	public mutating func RAW_deserialize_field<I>(_:I.Type) throws(RAW_serial_error) -> I where I:FixedWidthInteger {
+		return try read(littleEndian:I.self)
+	}
+	public mutating func RAW_deserialize_field(_:Int.Type) throws(RAW_serial_error) -> Int {
+		let start = offset
+		guard let value = Int(exactly:try read(littleEndian:Int64.self)) else {
+			throw RAW_serial_error(kind:.integerOverflow, offset:start)
+		}
+		return value
+	}
+	public mutating func RAW_deserialize_field(_:UInt.Type) throws(RAW_serial_error) -> UInt {
+		let start = offset
+		guard let value = UInt(exactly:try read(littleEndian:UInt64.self)) else {
+			throw RAW_serial_error(kind:.integerOverflow, offset:start)
+		}
+		return value
+	}
+	public mutating func RAW_deserialize_field(_:Bool.Type) throws(RAW_serial_error) -> Bool {
+		return try read(littleEndian:UInt8.self) != 0
+	}
+	public mutating func RAW_deserialize_field<S>(_:S.Type) throws(RAW_serial_error) -> S where S:RAW_staticbuff {
+		return try read(staticbuff:S.self)
+	}
+	public mutating func RAW_deserialize_field<T>(_:T.Type) throws(RAW_serial_error) -> T where T:RAW_serializable {
+		guard T.RAW_serial_fixed_size == nil else {
+			return try T(RAW_deserialize:&self)
+		}
+		var nested = RAW_serial_reader(try readLengthPrefixed())
+		let value = try T(RAW_deserialize:&nested)
+		try nested.finish()
+		return value
+	}
+	public mutating func RAW_deserialize_field(_:[UInt8].Type) throws(RAW_serial_error) -> [UInt8] {
+		return [UInt8](try readLengthPrefixed())
+	}
+	public mutating func RAW_deserialize_field(_:String.Type) throws(RAW_serial_error) -> String {
+		let start = offset
+		let bytes = try readLengthPrefixed()
+		// decoding alone would substitute replacement characters for malformed sequences, so the bytes are validated first
+		guard transcode(bytes.makeIterator(), from:UTF8.self, to:UTF8.self, stoppingOnError:true, into:{ _ in }) == false else {
+			throw RAW_serial_error(kind:.invalidUTF8, offset:start)
+		}
+		return String(decoding:bytes, as:UTF8.self)
+	}
+	public mutating func RAW_deserialize_field<T>(_:[T].Type) throws(RAW_serial_error) -> [T] where T:RAW_serializable {
+		let elementCount = try readVarint()
+		// bounding the count by the remaining bytes keeps a hostile count from driving the reservation
+		guard elementCount <= UInt64(remaining) else {
+			throw RAW_serial_error(kind:.truncated, offset:offset)
+		}
+		var result = [T]()
+		result.reserveCapacity(Int(elementCount))
+		for _ in 0..<elementCount {
+			result.append(try RAW_deserialize_field(T.self))
+		}
+		return result
+	}
+}
@@ -21,6 +21,74 @@ public protocol RAW_staticbuff:RAW_convertible_fixed, RAW_comparable_fixed, RAW_
 	consuming func RAW_staticbuff() -> RAW_staticbuff_storetype
 
 	static func RAW_staticbuff_zeroed() -> RAW_staticbuff_storetype
+
+	/// the first eight bytes of the static buffer as a little endian integer, zero padded for shorter buffers. for buffers holding uniformly distributed data (digests, public keys) this is a ready made hash value.
+	var RAW_hash_prefix:UInt64 { get }
+
+	/// feed the entire contents of the static buffer into a hasher.
+	borrowing func RAW_staticbuff_hash(into hasher:inout Swift.Hasher)
+
+	/// compare two static buffers for equality in time that does not depend on their contents.
+	borrowing func RAW_equals_constant_time(_ other:borrowing Self) -> Bool
+
+	/// true for types that conform to ``RAW_staticbuff_uniform``. generic code branches on this instead of casting at runtime, and the branch folds away once the code is specialized.
+	/// - the witness is chosen where the type conforms to ``RAW_staticbuff``, so declare a ``RAW_staticbuff_uniform`` conformance in the module of the type.
+	static var RAW_staticbuff_is_uniform:Bool { get }
+}
+
+/// a static buffer whose bytes are uniformly distributed (the output of a cryptographic hash function, for example). hashable conformers of this protocol feed only their ``RAW_staticbuff/RAW_hash_prefix`` to the hasher, and ``RAW_staticbuff_table`` uses the prefix as the hash without a hasher.
+/// - note: values that share their first eight bytes always collide, whatever the hasher seed, so the seeding of Set and Dictionary no longer protects them from flooding. only conform types whose values an attacker can not choose freely.
+public protocol RAW_staticbuff_uniform:RAW_staticbuff {}
+
+extension RAW_staticbuff_uniform {
+	@inlinable public static var RAW_staticbuff_is_uniform:Bool {
+		return true
+	}
+}
+
+/// a static buffer that holds a secret or an authenticator (a key, a tag, a MAC), whose equality must not leak where two values first differ.
+/// - when declared directly on a type with the RAW_staticbuff macro, the generated `==` compares in constant time through ``RAW_staticbuff/RAW_equals_constant_time(_:)``.
+public protocol RAW_staticbuff_secret:RAW_staticbuff, Equatable {}
+
+extension RAW_staticbuff_secret {
+	public static func == (lhs:Self, rhs:Self) -> Bool {
+		return lhs.RAW_equals_constant_time(rhs)
+	}
+}
+
+// generic fallbacks for static buffers that are not implemented with the RAW_staticbuff macro. the macro generates versions of these that are specialized for the byte count of the type.
+extension RAW_staticbuff {
+	@inlinable public static var RAW_staticbuff_is_uniform:Bool {
+		return false
+	}
+
+	public var RAW_hash_prefix:UInt64 {
+		return RAW_access_staticbuff { ptr in
+			let size = MemoryLayout<RAW_staticbuff_storetype>.size
+			guard size < 8 else {
+				return UInt64(littleEndian:ptr.loadUnaligned(as:UInt64.self))
+			}
+			var prefix:UInt64 = 0
+			for i in 0..<size {
+				prefix |= UInt64(ptr.load(fromByteOffset:i, as:UInt8.self)) << (8 * i)
+			}
+			return prefix
+		}
+	}
+
+	public borrowing func RAW_staticbuff_hash(into hasher:inout Swift.Hasher) {
+		RAW_access_staticbuff({ ptr in
+			hasher.combine(bytes:UnsafeRawBufferPointer(start:ptr, count:MemoryLayout<RAW_staticbuff_storetype>.size))
+		})
+	}
+
+	public borrowing func RAW_equals_constant_time(_ other:borrowing Self) -> Bool {
+		return RAW_access_staticbuff { lhs_ptr in
+			other.RAW_access_staticbuff { rhs_ptr in
+				RAW_constant_time_equal(lhs_ptr, rhs_ptr, count:MemoryLayout<RAW_staticbuff_storetype>.size)
+			}
+		}
+	}
 }
 
 extension RAW_staticbuff {
@@ -45,9 +113,13 @@ extension RAW_staticbuff where Self:ExpressibleByArrayLiteral {
 
 extension RAW_staticbuff where Self:Hashable {
 	public func hash(into hasher:inout Hasher) {
-		RAW_access_staticbuff({ ptr in
-			hasher.combine(bytes:UnsafeRawBufferPointer(start:ptr, count:MemoryLayout<RAW_staticbuff_storetype>.size))
-		})
+		RAW_staticbuff_hash(into:&hasher)
+	}
+}
+
+extension RAW_staticbuff_uniform where Self:Hashable {
+	public func hash(into hasher:inout Hasher) {
+		hasher.combine(RAW_hash_prefix)
 	}
 }
 
@@ -100,7 +172,39 @@ extension RAW_staticbuff {
 	}
 }
 
+// bitwise operators. the RAW_staticbuff macro replaces these with word-wise versions that are specialized for the byte count of the type.
 extension RAW_staticbuff {
+	private static func RAW_staticbuff_bytewise(_ lhs:Self, _ rhs:Self, _ op:(UInt8, UInt8) -> UInt8) -> Self {
+		return lhs.RAW_access { lhsPtr in
+			rhs.RAW_access { rhsPtr in
+				var returnValue = Self(RAW_staticbuff:Self.RAW_staticbuff_zeroed())
+				returnValue.RAW_access_mutating { returnValuePtr in
+					for i in 0..<returnValuePtr.count {
+						returnValuePtr[i] = op(lhsPtr[i], rhsPtr[i])
+					}
+				}
+				return returnValue
+			}
+		}
+	}
+	public static func ^ (lhs:Self, rhs:Self) -> Self {
+		return RAW_staticbuff_bytewise(lhs, rhs, { $0 ^ $1 })
+	}
+	public static func & (lhs:Self, rhs:Self) -> Self {
+		return RAW_staticbuff_bytewise(lhs, rhs, { $0 & $1 })
+	}
+	public static func | (lhs:Self, rhs:Self) -> Self {
+		return RAW_staticbuff_bytewise(lhs, rhs, { $0 | $1 })
+	}
+	public static func ^= (lhs:inout Self, rhs:Self) {
+		lhs = lhs ^ rhs
+	}
+	public static func &= (lhs:inout Self, rhs:Self) {
+		lhs = lhs & rhs
+	}
+	public static func |= (lhs:inout Self, rhs:Self) {
+		lhs = lhs | rhs
+	}
 	public static prefix func ~ (value:Self) -> Self {
 		return value.RAW_access { valuePtr in
 			var returnValue = Self(RAW_staticbuff:Self.RAW_staticbuff_zeroed())
@@ -1,6 +1,7 @@
 // LICENSE MIT
 // copyright (c) tanner silva 2024. all rights reserved.
 public typealias size_t = CRAW.size_t
+public typealias iovec = CRAW.iovec
 
 #if os(Linux)
 import Glibc
@@ -22,6 +23,22 @@ public func RAW_strlen(_ str:UnsafeRawPointer) -> size_t {
 	return CRAW.strlen(str)
 }
 
+/// compare two regions of memory for equality in time that depends only on their length. use this instead of ``RAW_memcmp`` to check keys, tags and MACs.
+public func RAW_constant_time_equal(_ lhs:UnsafeRawPointer, _ rhs:UnsafeRawPointer, count:size_t) -> Bool {
+	return __craw_equals_constant_time(lhs, rhs, count)
+}
+
+/// compare two buffers for equality in time that depends only on their length. buffers of different lengths are never equal.
+public func RAW_constant_time_equal(_ lhs:UnsafeRawBufferPointer, _ rhs:UnsafeRawBufferPointer) -> Bool {
+	guard lhs.count == rhs.count else {
+		return false
+	}
+	guard let lhsBase = lhs.baseAddress, let rhsBase = rhs.baseAddress else {
+		return true
+	}
+	return __craw_equals_constant_time(lhsBase, rhsBase, lhs.count)
+}
+
 #if RAWDOG_LOG
 import Logging
 internal func makeDefaultLogger(label loggerLabel:String, level:Logger.Level) -> Logger {
@@ -47,18 +64,10 @@ public struct GenerateRandomBytesError:Swift.Error {}
 /// the type of error that is thrown when a memory page could not be zeroed
 public struct ByteZeroFailure:Swift.Error {}
 
+/// random bytes from the calling thread's buffered csprng. see ``generateSecureRandomBytes(count:)``.
 public func generateRandomBytes(count:Int) throws -> [UInt8] {
 	return try [UInt8](unsafeUninitializedCapacity:count) { buffer, initializedCount in
-		buffer.initialize(repeating:0)
-		let fd = open("/dev/urandom", O_RDONLY)
-		guard fd > 0 else {
-			throw GenerateRandomBytesError()
-		}
-		defer {
-			close(fd)
-		}
-		let result = read(fd, buffer.baseAddress, count)
-		guard result == count else {
+		guard count == 0 || __craw_random_bytes(buffer.baseAddress!, count) == 0 else {
 			throw GenerateRandomBytesError()
 		}
 		initializedCount = count
@@ -67,36 +76,39 @@ public func generateRandomBytes(count:Int) throws -> [UInt8] {
 
 /// this error is thrown when the secure random bytes generator fails to generate the requested number of bytes
 public struct InvalidSecureRandomBytesLengthError:Error {}
-/// source of secure random bytes from the system. this is the most secure way to generate random bytes, and is limited to a maximum 256 bytes.
+/// secure random bytes from the calling thread's buffered chacha20 csprng.
 /// - parameter S: the type of the static buffer to generate and return
 /// - returns: a static buffer of random bytes
-/// - throws: InvalidSecureRandomBytesLengthError if the requested number of bytes is greater than 256
+/// - throws: InvalidSecureRandomBytesLengthError if the generator could not be seeded from the system
 public func generateSecureRandomBytes<S>(as _:S.Type) throws -> S where S:RAW_staticbuff {
 	return S(RAW_staticbuff:try generateSecureRandomBytes(count:MemoryLayout<S>.size))
 }
 
-/// source of secure random bytes from the system. this is the most secure way to generate random bytes, and is limited to a maximum 256 bytes.
-/// - parameter [UInt8].Type: the type of the static buffer to generate and return
+/// secure random bytes from the calling thread's buffered chacha20 csprng. the generator is seeded from the system entropy source on first use, after fork and periodically, and erases its key after every refill. there is no limit on the number of bytes.
 /// - parameter count: the number of bytes to generate
 /// - returns: the byte array of bytes sourced
 public func generateSecureRandomBytes(count:size_t) throws -> [UInt8] {
-	guard count <= 256 else {
-		throw InvalidSecureRandomBytesLengthError()
-	}
 	return try [UInt8](unsafeUninitializedCapacity:Int(count), initializingWith: { buffer, initializedCount in
-		guard __craw_get_entropy_bytes(buffer.baseAddress!, count) == 0 else {
+		guard count == 0 || __craw_random_bytes(buffer.baseAddress!, count) == 0 else {
 			throw InvalidSecureRandomBytesLengthError()
 		}
 		initializedCount = Int(count)
 	})
 }
 
-public func generateSecureRandomBytes<StaticbuffType>(into memoryGuardedStaticbuff:MemoryGuarded<StaticbuffType>) throws where StaticbuffType:RAW_staticbuff {
-	guard MemoryLayout<StaticbuffType.RAW_staticbuff_storetype>.size <= 256 else {
+/// fill a buffer in place with secure random bytes from the calling thread's buffered chacha20 csprng. no intermediate array is allocated.
+public func generateSecureRandomBytes(into buffer:UnsafeMutableRawBufferPointer) throws {
+	guard buffer.count > 0 else {
+		return
+	}
+	guard __craw_random_bytes(buffer.baseAddress!.assumingMemoryBound(to:UInt8.self), buffer.count) == 0 else {
 		throw InvalidSecureRandomBytesLengthError()
 	}
+}
+
+public func generateSecureRandomBytes<StaticbuffType>(into memoryGuardedStaticbuff:MemoryGuarded<StaticbuffType>) throws where StaticbuffType:RAW_staticbuff {
 	try memoryGuardedStaticbuff.RAW_access_mutating { buffer in
-		guard __craw_get_entropy_bytes(buffer.baseAddress!, MemoryLayout<StaticbuffType.RAW_staticbuff_storetype>.size) == 0 else {
+		guard __craw_random_bytes(buffer.baseAddress!, MemoryLayout<StaticbuffType.RAW_staticbuff_storetype>.size) == 0 else {
 			throw InvalidSecureRandomBytesLengthError()
 		}
 	}
@@ -0,0 +1,221 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import CRAW
+
+/// a file mapped read-only into memory, for decoding with a ``RAW_cursor``.
+/// - the mapping is released when the instance is dereferenced. cursors and record views taken from ``region`` must not outlive it.
+public final class RAW_mapped_file:@unchecked Sendable {
+	/// the type of error that is thrown when the file can not be opened or mapped.
+	public struct MapFailure:Swift.Error {
+		/// the system errno that describes the failure.
+		public let errno:Int32
+	}
+
+	/// the mapped bytes of the file. empty files map to an empty region.
+	public let region:UnsafeRawBufferPointer
+
+	/// map a file into memory.
+	public init(path:String) throws(MapFailure) {
+		var ptr:UnsafeRawPointer? = nil
+		var size:size_t = 0
+		let result = path.withCString { __craw_map_file($0, &ptr, &size) }
+		guard result == 0 else {
+			throw MapFailure(errno:result)
+		}
+		self.region = UnsafeRawBufferPointer(start:ptr, count:size)
+	}
+
+	/// a cursor positioned at the start of the file.
+	public func cursor() -> RAW_cursor {
+		return RAW_cursor(region)
+	}
+
+	deinit {
+		__craw_unmap_file(region.baseAddress, region.count)
+	}
+}
+
+/// a bounded, forward only cursor that decodes records straight out of a memory region, such as a ``RAW_mapped_file``.
+/// - bounds are checked once per record, not once per byte, and records are decoded from the region in place without intermediate copies.
+/// - a failed read returns nil and leaves the cursor where it was.
+/// - this is the bounded replacement for ``RAW_decodable_unbounded``.
+public struct RAW_cursor {
+	/// the region being read.
+	public let region:UnsafeRawBufferPointer
+	/// the offset of the next record.
+	public private(set) var offset:Int = 0
+
+	/// create a cursor at the start of a region.
+	public init(_ region:UnsafeRawBufferPointer) {
+		self.region = region
+	}
+
+	/// the number of bytes left in the region.
+	public var remaining:Int {
+		return region.count - offset
+	}
+
+	/// true when every byte of the region has been read.
+	public var isAtEnd:Bool {
+		return offset == region.count
+	}
+
+	/// advance past a number of bytes.
+	/// - returns: false, without moving, when fewer bytes remain.
+	@discardableResult public mutating func skip(_ byteCount:Int) -> Bool {
+		guard byteCount >= 0 && byteCount <= remaining else {
+			return false
+		}
+		offset += byteCount
+		return true
+	}
+
+	/// read a number of bytes as a view into the region.
+	public mutating func next(count byteCount:Int) -> UnsafeRawBufferPointer? {
+		guard byteCount >= 0 && byteCount <= remaining else {
+			return nil
+		}
+		defer {
+			offset += byteCount
+		}
+		return UnsafeRawBufferPointer(rebasing:region[offset..<(offset + byteCount)])
+	}
+
+	/// read a static buffer record.
+	public mutating func next<S>(_:S.Type) -> S? where S:RAW_staticbuff {
+		let size = MemoryLayout<S.RAW_staticbuff_storetype>.size
+		guard size <= remaining else {
+			return nil
+		}
+		// an empty region has no base address, and a zero size record reads nothing from it
+		guard size > 0 else {
+			return S(RAW_staticbuff:S.RAW_staticbuff_zeroed())
+		}
+		defer {
+			offset += size
+		}
+		return S(RAW_staticbuff:region.baseAddress! + offset)
+	}
+
+	/// read a decodable record that occupies the next `count` bytes.
+	public mutating func next<D>(_:D.Type, count byteCount:Int) -> D? where D:RAW_decodable {
+		guard let base = region.baseAddress, byteCount >= 0 && byteCount <= remaining else {
+			return nil
+		}
+		guard let decoded = D(RAW_decode:base + offset, count:byteCount) else {
+			return nil
+		}
+		offset += byteCount
+		return decoded
+	}
+
+	/// read a decodable record that is framed by a varint length prefix (see ``RAW_varint``).
+	public mutating func nextLengthPrefixed<D>(_:D.Type) -> D? where D:RAW_decodable {
+		var recordOffset = offset
+		guard let length = try? RAW_varint.decode(region, offset:&recordOffset), length <= UInt64(region.count - recordOffset) else {
+			return nil
+		}
+		guard let decoded = D(RAW_decode:region.baseAddress! + recordOffset, count:Int(length)) else {
+			return nil
+		}
+		offset = recordOffset + Int(length)
+		return decoded
+	}
+
+	/// iterate the static buffer records from the current offset to the end of the region. trailing bytes that are too short for a record are not visited.
+	/// - parameters:
+	///		- prefetchBytes: how far ahead of the record being decoded the iterator asks the processor to prefetch.
+	public func records<S>(_:S.Type, prefetchBytes:Int = 512) -> StaticRecords<S> where S:RAW_staticbuff {
+		return StaticRecords(region:region, offset:offset, prefetchBytes:prefetchBytes)
+	}
+
+	/// iterate the varint length prefixed records from the current offset. iteration ends at the end of the region, or at the first record that is truncated or does not decode.
+	/// - parameters:
+	///		- prefetchBytes: how far ahead of the record being decoded the iterator asks the processor to prefetch.
+	public func lengthPrefixedRecords<D>(_:D.Type, prefetchBytes:Int = 512) -> LengthPrefixedRecords<D> where D:RAW_decodable {
+		return LengthPrefixedRecords(cursor:self, prefetchBytes:prefetchBytes)
+	}
+}
+
+extension RAW_cursor {
+	// issues one prefetch per cache line as the read position moves through the region.
+	fileprivate struct Prefetcher {
+		private static let lineSize = 64
+		private let base:UnsafeRawPointer?
+		private let end:Int
+		private let distance:Int
+		private var nextLine:Int
+
+		fileprivate init(region:UnsafeRawBufferPointer, offset:Int, distance:Int) {
+			self.base = region.baseAddress
+			self.end = region.count
+			self.distance = max(distance, 0)
+			self.nextLine = offset & ~(Self.lineSize - 1)
+		}
+
+		fileprivate mutating func advance(to position:Int) {
+			let target = min(position + distance, end)
+			while nextLine < target {
+				__craw_prefetch(base! + nextLine)
+				nextLine += Self.lineSize
+			}
+		}
+	}
+
+	/// an iterator over the fixed size records of a region. the number of records is computed up front, so no bounds are checked while iterating.
+	public struct StaticRecords<S>:Sequence, IteratorProtocol where S:RAW_staticbuff {
+		private static var recordSize:Int {
+			return MemoryLayout<S.RAW_staticbuff_storetype>.size
+		}
+		private let base:UnsafeRawPointer?
+		private let recordCount:Int
+		private var index:Int = 0
+		private var offset:Int
+		private var prefetcher:Prefetcher
+
+		fileprivate init(region:UnsafeRawBufferPointer, offset:Int, prefetchBytes:Int) {
+			self.base = region.baseAddress
+			self.recordCount = Self.recordSize == 0 ? 0 : (region.count - offset) / Self.recordSize
+			self.offset = offset
+			self.prefetcher = Prefetcher(region:region, offset:offset, distance:prefetchBytes)
+		}
+
+		/// the number of records that have not been visited yet.
+		public var underestimatedCount:Int {
+			return recordCount - index
+		}
+
+		public mutating func next() -> S? {
+			guard index < recordCount else {
+				return nil
+			}
+			prefetcher.advance(to:offset)
+			defer {
+				index += 1
+				offset += Self.recordSize
+			}
+			return S(RAW_staticbuff:base! + offset)
+		}
+	}
+
+	/// an iterator over the varint length prefixed records of a region.
+	public struct LengthPrefixedRecords<D>:Sequence, IteratorProtocol where D:RAW_decodable {
+		private var cursor:RAW_cursor
+		private var prefetcher:Prefetcher
+
+		fileprivate init(cursor:RAW_cursor, prefetchBytes:Int) {
+			self.cursor = cursor
+			self.prefetcher = Prefetcher(region:cursor.region, offset:cursor.offset, distance:prefetchBytes)
+		}
+
+		/// the cursor positioned after the last record that was returned.
+		public var position:RAW_cursor {
+			return cursor
+		}
+
+		public mutating func next() -> D? {
+			prefetcher.advance(to:cursor.offset)
+			return cursor.nextLengthPrefixed(D.self)
+		}
+	}
+}
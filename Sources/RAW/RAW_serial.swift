@@ -0,0 +1,254 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+
+/// the error thrown when a serialized buffer can not be read.
+public struct RAW_serial_error:Swift.Error, Equatable {
+	public enum Kind:Equatable, Sendable {
+		/// the buffer ended before the value was complete.
+		case truncated
+		/// a varint ran longer than ten bytes or overflowed 64 bits.
+		case varintOverflow
+		/// bytes were left over after the value was decoded.
+		case trailingBytes
+		/// a string field was not valid UTF-8.
+		case invalidUTF8
+		/// an `Int` or `UInt` field held a value that does not fit the integer width of this platform.
+		case integerOverflow
+	}
+	/// the kind of failure.
+	public let kind:Kind
+	/// the reader offset at which the failure was detected.
+	public let offset:Int
+}
+
+/// unsigned LEB128 varint encoding, used for the length prefixes of variable sized fields.
+public enum RAW_varint {
+	/// the largest number of bytes a 64 bit varint can occupy.
+	public static let maximumByteCount = 10
+
+	/// the number of bytes needed to encode a value.
+	public static func byteCount(_ value:UInt64) -> Int {
+		// one byte per started group of seven bits, at least one byte for zero
+		return ((64 - (value | 1).leadingZeroBitCount) + 6) / 7
+	}
+
+	/// writes the varint to a destination with at least ``byteCount(_:)`` bytes of room.
+	/// - returns: the destination advanced past the written bytes.
+	public static func encode(_ value:UInt64, to dest:UnsafeMutablePointer<UInt8>) -> UnsafeMutablePointer<UInt8> {
+		var value = value
+		var dest = dest
+		while value >= 0x80 {
+			dest.pointee = UInt8(truncatingIfNeeded:value) | 0x80
+			dest += 1
+			value >>= 7
+		}
+		dest.pointee = UInt8(truncatingIfNeeded:value)
+		return dest + 1
+	}
+
+	/// reads a varint from a buffer, advancing the offset past it. the offset is left unchanged when the varint can not be read.
+	public static func decode(_ buffer:UnsafeRawBufferPointer, offset:inout Int) throws(RAW_serial_error) -> UInt64 {
+		var result:UInt64 = 0
+		var shift:UInt64 = 0
+		var i = offset
+		while i < buffer.count {
+			let byte = buffer[i]
+			i += 1
+			guard shift < 63 || (shift == 63 && byte <= 1) else {
+				throw RAW_serial_error(kind:.varintOverflow, offset:offset)
+			}
+			result |= UInt64(byte & 0x7F) << shift
+			if byte & 0x80 == 0 {
+				offset = i
+				return result
+			}
+			shift += 7
+		}
+		throw RAW_serial_error(kind:.truncated, offset:offset)
+	}
+}
+
+/// a reusable, growable output buffer for single pass serialization.
+/// - values are written straight into the buffer, without counting their size first. the buffer doubles when it runs out of room.
+/// - ``reset()`` rewinds the buffer without releasing its storage, so a long lived writer stops allocating once it has grown to the size of the largest message.
+public final class RAW_serial_writer {
+	private var storage:UnsafeMutablePointer<UInt8>
+	/// the number of bytes the writer can hold before it must grow.
+	public private(set) var capacity:Int
+	/// the number of bytes written since the last reset.
+	public private(set) var count:Int = 0
+
+	/// create a writer with an initial capacity.
+	public init(capacity:Int = 256) {
+		let capacity = max(capacity, 16)
+		self.storage = UnsafeMutablePointer<UInt8>.allocate(capacity:capacity)
+		self.capacity = capacity
+	}
+
+	deinit {
+		storage.deallocate()
+	}
+
+	/// rewinds the writer to zero bytes. the storage is kept for reuse.
+	public func reset() {
+		count = 0
+	}
+
+	/// makes sure that at least `additional` more bytes can be written without growing.
+	public func reserve(_ additional:Int) {
+		if count + additional > capacity {
+			grow(toAtLeast:count + additional)
+		}
+	}
+
+	private func grow(toAtLeast needed:Int) {
+		var newCapacity = capacity * 2
+		while newCapacity < needed {
+			newCapacity *= 2
+		}
+		let newStorage = UnsafeMutablePointer<UInt8>.allocate(capacity:newCapacity)
+		newStorage.update(from:storage, count:count)
+		storage.deallocate()
+		storage = newStorage
+		capacity = newCapacity
+	}
+
+	/// appends raw bytes.
+	public func write(bytes:UnsafeRawPointer, count byteCount:Int) {
+		reserve(byteCount)
+		if byteCount > 0 {
+			(storage + count).update(from:bytes.assumingMemoryBound(to:UInt8.self), count:byteCount)
+			count += byteCount
+		}
+	}
+
+	/// appends a varint.
+	public func write(varint value:UInt64) {
+		reserve(RAW_varint.maximumByteCount)
+		count = RAW_varint.encode(value, to:storage + count) - storage
+	}
+
+	/// appends an integer in little endian byte order.
+	public func write<I>(littleEndian value:I) where I:FixedWidthInteger {
+		var le = value.littleEndian
+		write(bytes:&le, count:MemoryLayout<I>.size)
+	}
+
+	/// appends the bytes of a static buffer.
+	public func write<S>(staticbuff value:borrowing S) where S:RAW_staticbuff {
+		let size = MemoryLayout<S.RAW_staticbuff_storetype>.size
+		reserve(size)
+		value.RAW_access_staticbuff { ptr in
+			(storage + count).update(from:ptr.assumingMemoryBound(to:UInt8.self), count:size)
+		}
+		count += size
+	}
+
+	/// appends a varint length prefix followed by the bytes.
+	public func write(lengthPrefixed bytes:UnsafeRawBufferPointer) {
+		write(varint:UInt64(bytes.count))
+		if let base = bytes.baseAddress {
+			write(bytes:base, count:bytes.count)
+		}
+	}
+
+	/// starts a length prefixed region whose length is not known yet. the returned token is passed to ``endLengthPrefix(_:)`` once the region is written.
+	/// - the prefix is reserved at its largest size and the region is moved down over the unused prefix bytes when it is closed.
+	public func beginLengthPrefix() -> Int {
+		reserve(RAW_varint.maximumByteCount)
+		let token = count
+		count += RAW_varint.maximumByteCount
+		return token
+	}
+
+	/// closes a length prefixed region that was started with ``beginLengthPrefix()``.
+	public func endLengthPrefix(_ token:Int) {
+		let regionStart = token + RAW_varint.maximumByteCount
+		let regionLength = count - regionStart
+		let prefixEnd = RAW_varint.encode(UInt64(regionLength), to:storage + token)
+		if prefixEnd != storage + regionStart {
+			UnsafeMutableRawPointer(prefixEnd).copyMemory(from:storage + regionStart, byteCount:regionLength)
+		}
+		count = (prefixEnd - storage) + regionLength
+	}
+
+	/// the bytes written since the last reset. the buffer is only valid for the duration of the closure.
+	public func RAW_access<R, E>(_ body:(UnsafeBufferPointer<UInt8>) throws(E) -> R) throws(E) -> R where E:Swift.Error {
+		return try body(UnsafeBufferPointer(start:storage, count:count))
+	}
+
+	/// copies the bytes written since the last reset into an array.
+	public func bytes() -> [UInt8] {
+		return [UInt8](UnsafeBufferPointer(start:storage, count:count))
+	}
+}
+
+/// a bounds checked, forward only reader over a serialized buffer.
+/// - variable sized fields can be read as views into the underlying buffer, without copying. such views are only valid as long as the underlying buffer is.
+public struct RAW_serial_reader {
+	/// the buffer being read.
+	public let buffer:UnsafeRawBufferPointer
+	/// the offset of the next byte to read.
+	public private(set) var offset:Int = 0
+
+	/// create a reader at the start of a buffer.
+	public init(_ buffer:UnsafeRawBufferPointer) {
+		self.buffer = buffer
+	}
+
+	/// the number of bytes left to read.
+	public var remaining:Int {
+		return buffer.count - offset
+	}
+
+	/// throws unless every byte of the buffer was read.
+	public func finish() throws(RAW_serial_error) {
+		guard offset == buffer.count else {
+			throw RAW_serial_error(kind:.trailingBytes, offset:offset)
+		}
+	}
+
+	/// reads a number of bytes as a view into the underlying buffer.
+	public mutating func read(count byteCount:Int) throws(RAW_serial_error) -> UnsafeRawBufferPointer {
+		guard byteCount >= 0 && byteCount <= remaining else {
+			throw RAW_serial_error(kind:.truncated, offset:offset)
+		}
+		defer {
+			offset += byteCount
+		}
+		return UnsafeRawBufferPointer(rebasing:buffer[offset..<(offset + byteCount)])
+	}
+
+	/// reads a varint.
+	public mutating func readVarint() throws(RAW_serial_error) -> UInt64 {
+		return try RAW_varint.decode(buffer, offset:&offset)
+	}
+
+	/// reads an integer stored in little endian byte order.
+	public mutating func read<I>(littleEndian _:I.Type) throws(RAW_serial_error) -> I where I:FixedWidthInteger {
+		let bytes = try read(count:MemoryLayout<I>.size)
+		return I(littleEndian:bytes.loadUnaligned(as:I.self))
+	}
+
+	/// reads a static buffer.
+	public mutating func read<S>(staticbuff _:S.Type) throws(RAW_serial_error) -> S where S:RAW_staticbuff {
+		let size = MemoryLayout<S.RAW_staticbuff_storetype>.size
+		// an empty buffer has no base address, and a zero size static buffer reads nothing from it
+		guard size > 0 else {
+			return S(RAW_staticbuff:S.RAW_staticbuff_zeroed())
+		}
+		let bytes = try read(count:size)
+		return S(RAW_staticbuff:bytes.baseAddress!)
+	}
+
+	/// reads a varint length prefix and the bytes that follow it, as a view into the underlying buffer.
+	public mutating func readLengthPrefixed() throws(RAW_serial_error) -> UnsafeRawBufferPointer {
+		let start = offset
+		let length = try readVarint()
+		guard length <= UInt64(remaining) else {
+			offset = start
+			throw RAW_serial_error(kind:.truncated, offset:start)
+		}
+		return try read(count:Int(length))
+	}
+}
@@ -0,0 +1,285 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+
+/// a flat, open addressing hash table keyed by static buffers.
+/// - keys and values are stored inline in flat arrays, next to an array of one byte control words (empty, deleted, or seven bits of the key hash). lookups probe eight control words at a time and only compare keys whose control word matches.
+/// - keys are hashed and compared by their raw bytes. keys that conform to ``RAW_staticbuff_uniform`` (digests) use their ``RAW_staticbuff/RAW_hash_prefix`` directly as the hash, other keys are hashed in full with a seeded hasher. the choice is made through ``RAW_staticbuff/RAW_staticbuff_is_uniform``, so it costs nothing once the table is specialized for its key type.
+/// - lookups are inlinable, so they are specialized in the module that uses the table.
+/// - this is a reference type. the table does not synchronize access.
+public final class RAW_staticbuff_table<Key, Value> where Key:RAW_staticbuff {
+	// control words. a full slot stores the low seven bits of its hash.
+	private static var empty:UInt8 { 0x80 }
+	private static var deleted:UInt8 { 0xFE }
+	// the number of control words that are probed at once.
+	@inlinable internal static var groupWidth:Int { 8 }
+	@inlinable internal static var lsbs:UInt64 { 0x0101010101010101 }
+	@inlinable internal static var msbs:UInt64 { 0x8080808080808080 }
+	@inlinable internal static var keySize:Int { MemoryLayout<Key.RAW_staticbuff_storetype>.size }
+
+	/// the number of entries in the table.
+	public private(set) var count:Int = 0
+	/// the number of slots in the table. the table grows when it is seven eighths full.
+	public private(set) var capacity:Int
+
+	// capacity control words, followed by a copy of the first group so that a group can be loaded at any slot without wrapping.
+	@usableFromInline internal var control:UnsafeMutablePointer<UInt8>
+	@usableFromInline internal var keys:UnsafeMutablePointer<Key>
+	@usableFromInline internal var values:UnsafeMutablePointer<Value>
+	// the number of empty slots that can be filled before the table must grow.
+	private var growthLeft:Int
+
+	/// create an empty table that can hold at least `minimumCapacity` entries without growing.
+	public init(minimumCapacity:Int = 0) {
+		let capacity = Self.capacity(for:minimumCapacity)
+		self.capacity = capacity
+		(control, keys, values) = Self.allocate(capacity:capacity)
+		growthLeft = Self.maximumLoad(capacity)
+	}
+
+	deinit {
+		deinitializeEntries()
+		control.deallocate()
+		keys.deallocate()
+		values.deallocate()
+	}
+
+	private static func maximumLoad(_ capacity:Int) -> Int {
+		return capacity - capacity / 8
+	}
+
+	private static func capacity(for count:Int) -> Int {
+		var capacity = groupWidth
+		while maximumLoad(capacity) < count {
+			capacity *= 2
+		}
+		return capacity
+	}
+
+	private static func allocate(capacity:Int) -> (UnsafeMutablePointer<UInt8>, UnsafeMutablePointer<Key>, UnsafeMutablePointer<Value>) {
+		let control = UnsafeMutablePointer<UInt8>.allocate(capacity:capacity + groupWidth)
+		control.initialize(repeating:empty, count:capacity + groupWidth)
+		return (control, UnsafeMutablePointer<Key>.allocate(capacity:capacity), UnsafeMutablePointer<Value>.allocate(capacity:capacity))
+	}
+
+	private func deinitializeEntries() {
+		guard count > 0 else {
+			return
+		}
+		for slot in 0..<capacity where control[slot] & 0x80 == 0 {
+			(keys + slot).deinitialize(count:1)
+			(values + slot).deinitialize(count:1)
+		}
+	}
+
+	// MARK: hashing and probing
+
+	@inlinable internal static func hash(_ key:borrowing Key) -> UInt64 {
+		if Key.RAW_staticbuff_is_uniform {
+			return key.RAW_hash_prefix
+		}
+		var hasher = Swift.Hasher()
+		key.RAW_staticbuff_hash(into:&hasher)
+		return UInt64(UInt(bitPattern:hasher.finalize()))
+	}
+
+	// compares a stored key with a candidate one word at a time.
+	@inlinable internal static func keysEqual(_ stored:UnsafePointer<Key>, _ key:borrowing Key) -> Bool {
+		return withUnsafeBytes(of:key) { keyBytes in
+			let storedBytes = UnsafeRawPointer(stored)
+			var difference:UInt64 = 0
+			var i = 0
+			while i + 8 <= keySize {
+				difference |= storedBytes.loadUnaligned(fromByteOffset:i, as:UInt64.self) ^ keyBytes.loadUnaligned(fromByteOffset:i, as:UInt64.self)
+				i += 8
+			}
+			while i < keySize {
+				difference |= UInt64(storedBytes.load(fromByteOffset:i, as:UInt8.self) ^ keyBytes[i])
+				i += 1
+			}
+			return difference == 0
+		}
+	}
+
+	@inlinable internal func group(at slot:Int) -> UInt64 {
+		return UInt64(littleEndian:UnsafeRawPointer(control + slot).loadUnaligned(as:UInt64.self))
+	}
+
+	// one set high bit per control word that may equal h2. false positives are possible and are weeded out by the key comparison.
+	@inlinable internal static func match(_ group:UInt64, _ h2:UInt8) -> UInt64 {
+		let x = group ^ (lsbs &* UInt64(h2))
+		return (x &- lsbs) & ~x & msbs
+	}
+
+	@inlinable internal static func matchEmpty(_ group:UInt64) -> UInt64 {
+		return group & ~(group << 6) & msbs
+	}
+
+	private static func matchEmptyOrDeleted(_ group:UInt64) -> UInt64 {
+		return group & msbs
+	}
+
+	private func setControl(_ slot:Int, _ value:UInt8) {
+		control[slot] = value
+		if slot < Self.groupWidth {
+			control[capacity + slot] = value
+		}
+	}
+
+	// the slot holding the key, if any.
+	@inlinable internal func find(_ key:borrowing Key, hash:UInt64) -> Int? {
+		let mask = capacity - 1
+		let h2 = UInt8(truncatingIfNeeded:hash) & 0x7F
+		var position = Int(truncatingIfNeeded:hash >> 7) & mask
+		var step = 0
+		while true {
+			let g = group(at:position)
+			var matches = Self.match(g, h2)
+			while matches != 0 {
+				let slot = (position + matches.trailingZeroBitCount / 8) & mask
+				if Self.keysEqual(keys + slot, key) {
+					return slot
+				}
+				matches &= matches &- 1
+			}
+			if Self.matchEmpty(g) != 0 {
+				return nil
+			}
+			step += Self.groupWidth
+			position = (position + step) & mask
+		}
+	}
+
+	// the first empty or deleted slot on the probe sequence of a hash.
+	private func findInsertSlot(hash:UInt64) -> Int {
+		let mask = capacity - 1
+		var position = Int(truncatingIfNeeded:hash >> 7) & mask
+		var step = 0
+		while true {
+			let free = Self.matchEmptyOrDeleted(group(at:position))
+			if free != 0 {
+				return (position + free.trailingZeroBitCount / 8) & mask
+			}
+			step += Self.groupWidth
+			position = (position + step) & mask
+		}
+	}
+
+	private func resize(to newCapacity:Int) {
+		let (oldControl, oldKeys, oldValues, oldCapacity) = (control, keys, values, capacity)
+		capacity = newCapacity
+		(control, keys, values) = Self.allocate(capacity:newCapacity)
+		growthLeft = Self.maximumLoad(newCapacity) - count
+		for slot in 0..<oldCapacity where oldControl[slot] & 0x80 == 0 {
+			let hash = Self.hash((oldKeys + slot).pointee)
+			let target = findInsertSlot(hash:hash)
+			setControl(target, UInt8(truncatingIfNeeded:hash) & 0x7F)
+			(keys + target).moveInitialize(from:oldKeys + slot, count:1)
+			(values + target).moveInitialize(from:oldValues + slot, count:1)
+		}
+		oldControl.deallocate()
+		oldKeys.deallocate()
+		oldValues.deallocate()
+	}
+
+	// MARK: public interface
+
+	/// make room for at least `minimumCapacity` entries without growing.
+	public func reserveCapacity(_ minimumCapacity:Int) {
+		let needed = Self.capacity(for:minimumCapacity)
+		if needed > capacity {
+			resize(to:needed)
+		}
+	}
+
+	/// true when the table holds a value for the key.
+	@inlinable public func contains(_ key:borrowing Key) -> Bool {
+		return find(key, hash:Self.hash(key)) != nil
+	}
+
+	/// the value stored for a key. assigning nil removes the key.
+	@inlinable public subscript(key:Key) -> Value? {
+		get {
+			guard let slot = find(key, hash:Self.hash(key)) else {
+				return nil
+			}
+			return values[slot]
+		}
+		set {
+			if let newValue {
+				updateValue(newValue, forKey:key)
+			} else {
+				removeValue(forKey:key)
+			}
+		}
+	}
+
+	/// store a value for a key.
+	/// - returns: the value that was replaced, or nil if the key was not in the table.
+	@discardableResult public func updateValue(_ value:Value, forKey key:Key) -> Value? {
+		var hash = Self.hash(key)
+		if let slot = find(key, hash:hash) {
+			let old = (values + slot).move()
+			(values + slot).initialize(to:value)
+			return old
+		}
+		var slot = findInsertSlot(hash:hash)
+		if control[slot] == Self.empty && growthLeft == 0 {
+			// reclaim tombstones in place when they make up a large share of the table, grow otherwise
+			resize(to:count < Self.maximumLoad(capacity) / 2 ? capacity : capacity * 2)
+			hash = Self.hash(key)
+			slot = findInsertSlot(hash:hash)
+		}
+		if control[slot] == Self.empty {
+			growthLeft -= 1
+		}
+		setControl(slot, UInt8(truncatingIfNeeded:hash) & 0x7F)
+		(keys + slot).initialize(to:key)
+		(values + slot).initialize(to:value)
+		count += 1
+		return nil
+	}
+
+	/// remove a key from the table.
+	/// - returns: the value that was removed, or nil if the key was not in the table.
+	@discardableResult public func removeValue(forKey key:Key) -> Value? {
+		guard let slot = find(key, hash:Self.hash(key)) else {
+			return nil
+		}
+		setControl(slot, Self.deleted)
+		(keys + slot).deinitialize(count:1)
+		count -= 1
+		return (values + slot).move()
+	}
+
+	/// remove every entry.
+	public func removeAll(keepingCapacity:Bool = false) {
+		deinitializeEntries()
+		count = 0
+		if keepingCapacity {
+			control.update(repeating:Self.empty, count:capacity + Self.groupWidth)
+			growthLeft = Self.maximumLoad(capacity)
+		} else {
+			control.deallocate()
+			keys.deallocate()
+			values.deallocate()
+			capacity = Self.groupWidth
+			(control, keys, values) = Self.allocate(capacity:capacity)
+			growthLeft = Self.maximumLoad(capacity)
+		}
+	}
+
+	/// visit every entry, in no particular order.
+	public func forEach<E>(_ body:(Key, Value) throws(E) -> Void) throws(E) where E:Swift.Error {
+		for slot in 0..<capacity where control[slot] & 0x80 == 0 {
+			try body(keys[slot], values[slot])
+		}
+	}
+}
+
+extension RAW_staticbuff_table where Value == Void {
+	/// add a key to the table when it is used as a set.
+	/// - returns: true if the key was not in the table.
+	@discardableResult public func insert(_ key:Key) -> Bool {
+		return updateValue((), forKey:key) == nil
+	}
+}
@@ -1,6 +1,7 @@
 // LICENSE MIT
 // copyright (c) tanner silva 2024. all rights reserved.
 import RAW
+import __crawdog_base64
 
 internal struct Decode {
 
@@ -145,3 +146,27 @@ internal struct Decode {
 	}
 }
 
+extension Decode {
+	/// decodes a contiguous buffer of base64 characters in a single pass through the bulk codec. validation is as strict as the per-character decoder.
+	internal static func process(contiguous encoded:UnsafeRawBufferPointer, options:Options = []) throws -> [UInt8] {
+		guard let source = encoded.baseAddress, encoded.count > 0 else {
+			return []
+		}
+		var errorOffset:size_t = 0
+		var result:Int32 = __CRAWDOG_BASE64_OK
+		let decoded = [UInt8](unsafeUninitializedCapacity:__crawdog_base64_decoded_length(encoded.count), initializingWith: { decodedBuffer, decodedCount in
+			result = __crawdog_base64_decode(decodedBuffer.baseAddress!, &decodedCount, source.assumingMemoryBound(to:CChar.self), encoded.count, options.rawValue, &errorOffset)
+		})
+		switch result {
+			case __CRAWDOG_BASE64_OK:
+				return decoded
+			case __CRAWDOG_BASE64_INVALID_CHARACTER:
+				guard options.contains(.constantTime) == false else {
+					throw Error.invalidEncoding
+				}
+				throw Error.invalidBase64EncodingCharacter(Character(UnicodeScalar(encoded[errorOffset])))
+			default:
+				throw Error.invalidPaddingLength
+		}
+	}
+}
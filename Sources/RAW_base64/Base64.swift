@@ -1,6 +1,7 @@
 // LICENSE MIT
 // copyright (c) tanner silva 2024. all rights reserved.
 import RAW
+import __crawdog_base64
 
 // encode functions
 /// encode a byte array to a base64 encoded string.
@@ -13,6 +14,32 @@ public func encode(_ inputByte:UnsafeBufferPointer<UInt8>) -> Encoded {
 	return Encoded(decoded_bytes:inputByte)
 }
 
+/// encode bytes to a base64 string with an alternate alphabet, padding policy or timing behavior.
+public func encode<A:RAW_accessible>(_ accessible:borrowing A, options:Options) -> String {
+	accessible.RAW_access { encodeBytes in
+		return Encode.string(decoded_bytes:encodeBytes, options:options)
+	}
+}
+public func encode(_ inputByte:UnsafeBufferPointer<UInt8>, options:Options) -> String {
+	return Encode.string(decoded_bytes:inputByte, options:options)
+}
+
+/// the number of characters that encoding the given number of bytes produces.
+public func encodedLength(_ byteCount:size_t, options:Options = []) -> size_t {
+	return __crawdog_base64_encoded_length(byteCount, options.rawValue)
+}
+
+/// encode bytes as ascii base64 characters into a caller provided buffer of at least ``encodedLength(_:options:)`` bytes.
+/// - returns: the number of characters written.
+public func encode<A:RAW_accessible>(_ accessible:borrowing A, into output:UnsafeMutableRawBufferPointer, options:Options = []) -> size_t {
+	accessible.RAW_access { encodeBytes in
+		return Encode.write(decoded_bytes:encodeBytes, into:output, options:options)
+	}
+}
+public func encode(_ inputByte:UnsafeBufferPointer<UInt8>, into output:UnsafeMutableRawBufferPointer, options:Options = []) -> size_t {
+	return Encode.write(decoded_bytes:inputByte, into:output, options:options)
+}
+
 /// encode an explicit base64 value array to a base64 encoded string (with padding).
 public func encode(_ values:consuming [Value]) throws -> Encoded {
 	return try Encoded.from(encoded:values)
@@ -24,6 +51,15 @@ public func decode(_ str:consuming String) throws -> [UInt8] {
 	return try Encoded.from(encoded:str).decoded_data
 }
 
+/// decode a base64 string that was encoded with an alternate alphabet or padding policy, or decode in constant time.
+/// - with ``Options/constantTime``, invalid characters are only reported once the whole string has been decoded, as ``Error/invalidEncoding``.
+public func decode(_ str:consuming String, options:Options) throws -> [UInt8] {
+	var str = str
+	return try str.withUTF8 { utf8Buffer in
+		try Decode.process(contiguous:UnsafeRawBufferPointer(utf8Buffer), options:options)
+	}
+}
+
 public func decode<S>(_ str:consuming S) throws -> [UInt8] where S:RAW_encoded_unicode {
 	return try decode(String(str))
 }
@@ -53,6 +89,11 @@ extension Array where Element == Value {
 extension String {
 	/// initialize a string value from a base64 encoded struct.
 	public init(_ encoded:consuming Encoded) {
+		self = encoded.decoded_data.withUnsafeBufferPointer { Encode.string(decoded_bytes:$0) }
+	}
+
+	/// initialize a string value from a base64 encoded struct, one base64 value at a time.
+	internal init(perCharacter encoded:consuming Encoded) {
 		let expectedTail = encoded.padding()
 		let encodedLength = encoded.unpaddedEncodedByteCount() + expectedTail.asSize()
 		self.init([Character](unsafeUninitializedCapacity:encodedLength, initializingWith: { charBuff, charSize in
@@ -8,6 +8,10 @@ public enum Error:Swift.Error {
 
 	/// thrown when a character is found while decoding that violates the specifications for base64 encoding.
 	case invalidBase64EncodingCharacter(Character)
+
+	/// thrown by constant time decoding when the input holds a character that violates the specifications for base64 encoding.
+	/// - the error carries neither the character nor its position, so that nothing about secret input escapes through it.
+	case invalidEncoding
 }
 
 extension Error:CustomDebugStringConvertible {
@@ -19,6 +23,8 @@ extension Error:CustomDebugStringConvertible {
 				return "RAW_base64.Error.invalidEncodingLength(\"\(foundLen.description)\")"
 			case .invalidBase64EncodingCharacter(let foundChar):
 				return "RAW_base64.Error.invalidBase64EncodingCharacter(\"\(foundChar.description)\")"
+			case .invalidEncoding:
+				return "RAW_base64.Error.invalidEncoding"
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,21 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import __crawdog_base64
+
+/// selects the alphabet, padding policy and timing behavior of the bulk and streaming codecs.
+public struct Options:OptionSet, Sendable {
+	public let rawValue:Int32
+	public init(rawValue:Int32) {
+		self.rawValue = rawValue
+	}
+
+	/// the url and filename safe alphabet of rfc 4648 §5, with `-` and `_` in place of `+` and `/`.
+	public static var url:Options { Options(rawValue:__CRAWDOG_BASE64_URL) }
+	/// omit padding when encoding and reject it when decoding.
+	public static var noPadding:Options { Options(rawValue:__CRAWDOG_BASE64_NO_PADDING) }
+	/// encode and decode without table lookups or branches that depend on the data. use this for secret material such as keys in PEM or JWK documents.
+	public static var constantTime:Options { Options(rawValue:__CRAWDOG_BASE64_CONSTANT_TIME) }
+
+	/// unpadded base64url, as used by JWTs and JWKs.
+	public static var urlUnpadded:Options { Options(rawValue:__CRAWDOG_BASE64_URL | __CRAWDOG_BASE64_NO_PADDING) }
+}
@@ -0,0 +1,149 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import RAW
+import __crawdog_base64
+
+/// the size of the stack buffer that the sink based streaming functions drain their output through.
+fileprivate let sinkBufferSize = 4096
+
+/// an incremental base64 encoder that works in constant memory.
+/// - bytes are fed in chunks of any size and encoded characters are written into caller provided buffers. the zero to two bytes of a group that straddles two chunks are carried in the encoder.
+/// - output is optionally broken into lines of `lineLength` characters separated by CRLF.
+public struct StreamingEncoder {
+	private var state = __crawdog_base64_stream()
+
+	/// the smallest output buffer that is guaranteed to make progress, and the largest output of ``finish(into:)``.
+	public static var minimumOutputCount:Int {
+		return Int(__CRAWDOG_BASE64_STREAM_FINAL_LENGTH)
+	}
+
+	/// create an encoder.
+	/// - parameter lineLength: the number of characters per line (64 for PEM, 76 for MIME), or zero to write a single line. must be a multiple of four.
+	/// - parameter options: the alphabet, padding policy and timing behavior of the encoder.
+	public init(lineLength:Int = 0, options:Options = []) {
+		precondition(lineLength >= 0 && lineLength % 4 == 0, "RAW_base64.StreamingEncoder line length must be a non-negative multiple of four")
+		__crawdog_base64_encode_stream_init(&state, lineLength, options.rawValue)
+	}
+
+	/// encode as much of the input as fits in the output buffer.
+	/// - returns: the number of input bytes consumed and the number of characters written. input that was not consumed must be fed again.
+	public mutating func update(_ input:UnsafeRawBufferPointer, into output:UnsafeMutableRawBufferPointer) -> (consumed:Int, written:Int) {
+		var written:size_t = 0
+		let consumed = __crawdog_base64_encode_stream_update(&state, output.baseAddress?.assumingMemoryBound(to:CChar.self), output.count, &written, input.baseAddress?.assumingMemoryBound(to:UInt8.self), input.count)
+		return (consumed, written)
+	}
+
+	/// encode the carried bytes after all input has been consumed.
+	/// - parameter output: a buffer of at least ``minimumOutputCount`` bytes.
+	/// - returns: the number of characters written.
+	public mutating func finish(into output:UnsafeMutableRawBufferPointer) -> Int {
+		precondition(output.count >= Self.minimumOutputCount, "RAW_base64.StreamingEncoder output buffer is too small to finish")
+		return __crawdog_base64_encode_stream_final(&state, output.baseAddress!.assumingMemoryBound(to:CChar.self))
+	}
+
+	/// encode all of the input, handing the encoded characters to `sink` as they are produced.
+	public mutating func update(_ input:UnsafeRawBufferPointer, _ sink:(UnsafeRawBufferPointer) throws -> Void) rethrows {
+		try withUnsafeTemporaryAllocation(byteCount:sinkBufferSize, alignment:1) { buffer in
+			var remaining = input
+			repeat {
+				let (consumed, written) = update(remaining, into:buffer)
+				if written > 0 {
+					try sink(UnsafeRawBufferPointer(rebasing:buffer.prefix(written)))
+				}
+				remaining = UnsafeRawBufferPointer(rebasing:remaining.dropFirst(consumed))
+			} while remaining.count > 0
+		}
+	}
+
+	/// encode the carried bytes, handing the final characters to `sink`.
+	public mutating func finish(_ sink:(UnsafeRawBufferPointer) throws -> Void) rethrows {
+		try withUnsafeTemporaryAllocation(byteCount:Self.minimumOutputCount, alignment:1) { buffer in
+			let written = finish(into:buffer)
+			if written > 0 {
+				try sink(UnsafeRawBufferPointer(rebasing:buffer.prefix(written)))
+			}
+		}
+	}
+}
+
+/// an incremental base64 decoder that works in constant memory.
+/// - characters are fed in chunks of any size and decoded bytes are written into caller provided buffers. the zero to three characters of a quartet that straddles two chunks are carried in the decoder.
+/// - validation is as strict as the contiguous decoder. CR and LF are skipped anywhere in the input unless `ignoringLineBreaks` is false.
+public struct StreamingDecoder {
+	private var state = __crawdog_base64_stream()
+
+	/// the smallest output buffer that is guaranteed to make progress, and the largest output of ``finish(into:)``.
+	public static var minimumOutputCount:Int {
+		return 3
+	}
+
+	/// create a decoder.
+	/// - parameter ignoringLineBreaks: skip CR and LF characters instead of rejecting them.
+	/// - parameter options: the alphabet, padding policy and timing behavior of the decoder.
+	public init(ignoringLineBreaks:Bool = true, options:Options = []) {
+		__crawdog_base64_decode_stream_init(&state, options.rawValue | (ignoringLineBreaks ? __CRAWDOG_BASE64_IGNORE_LINE_BREAKS : 0))
+	}
+
+	private func error(_ result:Int32) -> Error {
+		switch result {
+			case __CRAWDOG_BASE64_INVALID_CHARACTER:
+				guard state.flags & __CRAWDOG_BASE64_CONSTANT_TIME == 0 else {
+					return Error.invalidEncoding
+				}
+				return Error.invalidBase64EncodingCharacter(Character(UnicodeScalar(state.error_character)))
+			default:
+				return Error.invalidPaddingLength
+		}
+	}
+
+	/// decode as much of the input as fits in the output buffer.
+	/// - returns: the number of input characters consumed and the number of bytes written. input that was not consumed must be fed again.
+	public mutating func update(_ input:UnsafeRawBufferPointer, into output:UnsafeMutableRawBufferPointer) throws -> (consumed:Int, written:Int) {
+		var written:size_t = 0
+		var consumed:size_t = 0
+		var errorOffset:size_t = 0
+		let result = __crawdog_base64_decode_stream_update(&state, output.baseAddress?.assumingMemoryBound(to:UInt8.self), output.count, &written, input.baseAddress?.assumingMemoryBound(to:CChar.self), input.count, &consumed, &errorOffset)
+		guard result == __CRAWDOG_BASE64_OK else {
+			throw error(result)
+		}
+		return (consumed, written)
+	}
+
+	/// decode all of the input, handing the decoded bytes to `sink` as they are produced.
+	public mutating func update(_ input:UnsafeRawBufferPointer, _ sink:(UnsafeRawBufferPointer) throws -> Void) throws {
+		try withUnsafeTemporaryAllocation(byteCount:sinkBufferSize, alignment:1) { buffer in
+			var remaining = input
+			repeat {
+				let (consumed, written) = try update(remaining, into:buffer)
+				if written > 0 {
+					try sink(UnsafeRawBufferPointer(rebasing:buffer.prefix(written)))
+				}
+				remaining = UnsafeRawBufferPointer(rebasing:remaining.dropFirst(consumed))
+			} while remaining.count > 0
+		}
+	}
+
+	/// verify that the input did not end inside a quartet after all input has been consumed, and decode the final characters of unpadded input.
+	/// - parameter output: a buffer of at least ``minimumOutputCount`` bytes.
+	/// - returns: the number of bytes written.
+	public mutating func finish(into output:UnsafeMutableRawBufferPointer) throws -> Int {
+		precondition(output.count >= Self.minimumOutputCount, "RAW_base64.StreamingDecoder output buffer is too small to finish")
+		var written:size_t = 0
+		var errorOffset:size_t = 0
+		let result = __crawdog_base64_decode_stream_final(&state, output.baseAddress!.assumingMemoryBound(to:UInt8.self), &written, &errorOffset)
+		guard result == __CRAWDOG_BASE64_OK else {
+			throw error(result)
+		}
+		return written
+	}
+
+	/// verify that the input did not end inside a quartet, handing the final bytes of unpadded input to `sink`.
+	public mutating func finish(_ sink:(UnsafeRawBufferPointer) throws -> Void) throws {
+		try withUnsafeTemporaryAllocation(byteCount:Self.minimumOutputCount, alignment:1) { buffer in
+			let written = try finish(into:buffer)
+			if written > 0 {
+				try sink(UnsafeRawBufferPointer(rebasing:buffer.prefix(written)))
+			}
+		}
+	}
+}
@@ -1,6 +1,7 @@
 // LICENSE MIT
 // copyright (c) tanner silva 2024. all rights reserved.
 import RAW
+import __crawdog_base64
 
 internal struct Encode {
 
@@ -94,4 +95,38 @@ internal struct Encode {
 				fatalError("encoded index % 4 should never be greater than 3")
 		}
 	}
-}
\ No newline at end of file
+}
+
+extension Encode {
+	/// encodes a contiguous byte buffer to a base64 string in a single pass through the bulk codec.
+	internal static func string(decoded_bytes bytes:UnsafeBufferPointer<UInt8>, options:Options = []) -> String {
+		guard let source = bytes.baseAddress, bytes.count > 0 else {
+			return ""
+		}
+		let encodedLength = __crawdog_base64_encoded_length(bytes.count, options.rawValue)
+		if #available(macOS 11.0, *) {
+			return String(unsafeUninitializedCapacity:encodedLength, initializingUTF8With: { utf8Buffer in
+				return UnsafeMutableRawPointer(utf8Buffer.baseAddress!).withMemoryRebound(to:CChar.self, capacity:encodedLength) { charPtr in
+					__crawdog_base64_encode(charPtr, source, bytes.count, options.rawValue)
+				}
+			})
+		} else {
+			let utf8 = [UInt8](unsafeUninitializedCapacity:encodedLength, initializingWith: { utf8Buffer, utf8Count in
+				utf8Count = UnsafeMutableRawPointer(utf8Buffer.baseAddress!).withMemoryRebound(to:CChar.self, capacity:encodedLength) { charPtr in
+					__crawdog_base64_encode(charPtr, source, bytes.count, options.rawValue)
+				}
+			})
+			return String(decoding:utf8, as:UTF8.self)
+		}
+	}
+
+	/// encodes a contiguous byte buffer into a caller provided buffer of at least `__crawdog_base64_encoded_length` bytes. returns the number of characters written.
+	internal static func write(decoded_bytes bytes:UnsafeBufferPointer<UInt8>, into output:UnsafeMutableRawBufferPointer, options:Options = []) -> size_t {
+		let encodedLength = __crawdog_base64_encoded_length(bytes.count, options.rawValue)
+		precondition(output.count >= encodedLength, "RAW_base64 output buffer is too small for the encoded characters")
+		guard let source = bytes.baseAddress, bytes.count > 0 else {
+			return 0
+		}
+		return __crawdog_base64_encode(output.baseAddress!.assumingMemoryBound(to:CChar.self), source, bytes.count, options.rawValue)
+	}
+}
@@ -57,10 +57,17 @@ extension Encoded {
 // encoded initializers
 extension Encoded {
 	public static func from(encoded encString:consuming String) throws -> Self {
-		return try Self.from(encoded:encString.utf8)
+		var encString = encString
+		return Self(decoded_bytes:try encString.withUTF8 { utf8Buffer in
+			try Decode.process(contiguous:UnsafeRawBufferPointer(utf8Buffer))
+		})
 	}
 	
 	public static func from<SB>(encoded encBytes:consuming SB) throws -> Self where SB:Sequence, SB.Element == UInt8 {
+		// contiguous inputs take the bulk codec, anything else is decoded one character at a time
+		if let decodedBytes = try encBytes.withContiguousStorageIfAvailable({ try Decode.process(contiguous:UnsafeRawBufferPointer($0)) }) {
+			return Self(decoded_bytes:decodedBytes)
+		}
 		let decodedBytes = try Decode.process(bytes:encBytes)
 		return Self(decoded_bytes:decodedBytes.0)
 	}
@@ -152,6 +152,18 @@ public struct Hasher<H:RAW_blake2_func_impl, S> {
 	public mutating func update(_ data:UnsafeRawPointer, count:size_t) throws {
 		try RAW_blake2_func_type.update(state:&state, input_data_ptr:data, input_data_size:count)
 	}
+	/// update the hasher with a chain of fragments, in order. the blake2 state carries partial blocks between fragments.
+	public mutating func update(vectored vectors:UnsafeBufferPointer<iovec>) throws {
+		for vector in vectors where vector.iov_len > 0 {
+			try RAW_blake2_func_type.update(state:&state, input_data_ptr:vector.iov_base!, input_data_size:vector.iov_len)
+		}
+	}
+	/// update the hasher with a collection of fragments, in order, without copying them together.
+	public mutating func update<C>(fragments:C) throws where C:Collection, C.Element == UnsafeRawBufferPointer {
+		try withUnsafeFragmentVectors(fragments) { vectors in
+			try update(vectored:vectors)
+		}
+	}
 }
 
 extension Hasher:RAW_hasher where RAW_blake2_out_type:RAW_staticbuff, RAW_blake2_out_type.RAW_staticbuff_storetype == RAW_blake2_func_type.RAW_blake2_func_impl_outtype.RAW_staticbuff_storetype {
@@ -229,6 +241,18 @@ extension Hasher {
 			try update(UnsafeRawBufferPointer(buffer))
 		}
 	}
+
+	public mutating func update(_ span:Span<UInt8>) throws {
+		try span.withUnsafeBytes { buffer in
+			try update(buffer)
+		}
+	}
+
+	public mutating func update(_ span:RawSpan) throws {
+		try span.withUnsafeBytes { buffer in
+			try update(buffer)
+		}
+	}
 }
 
 extension Hasher where RAW_blake2_out_type:RAW_decodable {
@@ -10,7 +10,7 @@ extension __crawdog_blake2b_state:RAW_blake2_state_impl {}
 public struct B:RAW_blake2_func_impl {
 
 	@RAW_staticbuff(bytes:64)
-	public struct Hash:Sendable {}
+	public struct Hash:Sendable, Hashable, Equatable {}
 
 	public static let RAW_blake2_func_impl_exec_init_nokey_f:RAW_blake2_func_impl_exec_init_nokey_t = __crawdog_blake2b_init
 	public static let RAW_blake2_func_impl_exec_init_keyed_f:RAW_blake2_func_impl_exec_init_keyed_t = __crawdog_blake2b_init_key
@@ -32,4 +32,7 @@ extension B:RAW_blake2_func_impl_initparam {
 
 	/// the function that initializes the hasher with a given parameter set.
 	public static let RAW_blake2_func_impl_initparam_create_f:RAW_blake2_func_impl_initparam_create_t = __crawdog_blake2b_init_param
-}
\ No newline at end of file
+}
+
+// digests are uniformly distributed, so their first eight bytes are used as their hash value.
+extension B.Hash:RAW_staticbuff_uniform {}
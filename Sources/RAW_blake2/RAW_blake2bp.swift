@@ -9,7 +9,7 @@ extension __crawdog_blake2bp_state:RAW_blake2_state_impl {}
 public struct BP:RAW_blake2_func_impl {
 
 	@RAW_staticbuff(bytes:64)
-	public struct Hash:Sendable {}
+	public struct Hash:Sendable, Hashable, Equatable {}
 
 	public static let RAW_blake2_func_impl_exec_init_nokey_f:RAW_blake2_func_impl_exec_init_nokey_t = __crawdog_blake2bp_init
 	public static let RAW_blake2_func_impl_exec_init_keyed_f:RAW_blake2_func_impl_exec_init_keyed_t = __crawdog_blake2bp_init_key
@@ -23,4 +23,7 @@ public struct BP:RAW_blake2_func_impl {
 	public static let RAW_blake2_func_impl_outlen = __CRAWDOG_BLAKE2B_OUTBYTES.rawValue
 
 	public typealias RAW_blake2_func_impl_outtype = Hash
-}
\ No newline at end of file
+}
+
+// digests are uniformly distributed, so their first eight bytes are used as their hash value.
+extension BP.Hash:RAW_staticbuff_uniform {}
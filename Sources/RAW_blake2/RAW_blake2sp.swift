@@ -9,7 +9,7 @@ extension __crawdog_blake2sp_state:RAW_blake2_state_impl {}
 public struct SP:RAW_blake2_func_impl {
 
 	@RAW_staticbuff(bytes:32)
-	public struct Hash:Sendable {}
+	public struct Hash:Sendable, Hashable, Equatable {}
 
 	/// the state type that this hashing variant uses
 	public typealias RAW_blake2_statetype = __crawdog_blake2sp_state
@@ -23,4 +23,7 @@ public struct SP:RAW_blake2_func_impl {
 	public static let RAW_blake2_func_impl_outlen = __CRAWDOG_BLAKE2S_OUTBYTES.rawValue
 
 	public typealias RAW_blake2_func_impl_outtype = Hash
-}
\ No newline at end of file
+}
+
+// digests are uniformly distributed, so their first eight bytes are used as their hash value.
+extension SP.Hash:RAW_staticbuff_uniform {}
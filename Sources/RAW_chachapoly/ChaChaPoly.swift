@@ -8,7 +8,7 @@ public struct Nonce:Sendable, Equatable {}
 
 // poly1305 tag is 16 bytes
 @RAW_staticbuff(bytes:16)
-public struct Tag:Sendable, Equatable {
+public struct Tag:Sendable, Equatable, RAW_staticbuff_secret {
 	public init() {
 		self = Self(RAW_staticbuff:Self.RAW_staticbuff_zeroed())
 	}
@@ -20,11 +20,11 @@ public struct InvalidMACError:Swift.Error {
 
 // 16 byte key
 @RAW_staticbuff(bytes:16)
-public struct Key16:Sendable, Equatable {}
+public struct Key16:Sendable, Equatable, RAW_staticbuff_secret {}
 
 // 32 byte key
 @RAW_staticbuff(bytes:32)
-public struct Key32:Sendable, Equatable {}
+public struct Key32:Sendable, Equatable, RAW_staticbuff_secret {}
 
 public struct Context {
 	private var ctx:__crawdog_chachapoly_ctx
@@ -153,4 +153,82 @@ public struct Context {
 				fatalError("unknown error thrown from rawdog chachapoly impl")
 		}
 	}
-}
\ No newline at end of file
+
+	/// execute authenticated encryption with associated data over borrowed spans. the output span must be at least as large as the input span.
+	/// - returns: the tag that was generated for this encryption
+	public mutating func encrypt(nonce:consuming Nonce, associatedData:Span<UInt8>, inputData:Span<UInt8>, output:inout MutableSpan<UInt8>) throws -> Tag {
+		precondition(output.count >= inputData.count, "output span is smaller than the input span")
+		return try output.withUnsafeMutableBufferPointer { outputBuffer in
+			try associatedData.withUnsafeBufferPointer { associatedBuffer in
+				try inputData.withUnsafeBufferPointer { inputBuffer in
+					guard let outputPointer = outputBuffer.baseAddress else {
+						// an empty span may have no storage. the input is empty too, so nothing is written
+						return try withUnsafeTemporaryAllocation(of:UInt8.self, capacity:1) { try encrypt(nonce:copy nonce, associatedData:associatedBuffer, inputData:inputBuffer, output:$0.baseAddress!) }
+					}
+					return try encrypt(nonce:copy nonce, associatedData:associatedBuffer, inputData:inputBuffer, output:outputPointer)
+				}
+			}
+		}
+	}
+
+	/// execute authenticated decryption with associated data over borrowed spans. the output span must be at least as large as the input span.
+	public mutating func decrypt(tag:consuming Tag, nonce:consuming Nonce, associatedData:Span<UInt8>, inputData:Span<UInt8>, output:inout MutableSpan<UInt8>) throws {
+		precondition(output.count >= inputData.count, "output span is smaller than the input span")
+		try output.withUnsafeMutableBufferPointer { outputBuffer in
+			try associatedData.withUnsafeBufferPointer { associatedBuffer in
+				try inputData.withUnsafeBufferPointer { inputBuffer in
+					guard let outputPointer = outputBuffer.baseAddress else {
+						// an empty span may have no storage. the input is empty too, so nothing is written
+						return try withUnsafeTemporaryAllocation(of:UInt8.self, capacity:1) { try decrypt(tag:copy tag, nonce:copy nonce, associatedData:associatedBuffer, inputData:inputBuffer, output:$0.baseAddress!) }
+					}
+					try decrypt(tag:copy tag, nonce:copy nonce, associatedData:associatedBuffer, inputData:inputBuffer, output:outputPointer)
+				}
+			}
+		}
+	}
+
+	/// execute authenticated encryption over a chain of fragments, writing the ciphertext contiguously. the fragments are processed in place, without being copied together.
+	/// - parameters:
+	///		- nonce: the nonce to use for this encryption
+	///		- associatedFragments: the associated data fragments. may be empty.
+	///		- inputFragments: the plaintext fragments
+	///		- output: the output buffer. must be at least as large as all input fragments together.
+	/// - returns: the tag that was generated for this encryption
+	public mutating func encrypt(nonce:consuming Nonce, associatedFragments:UnsafeBufferPointer<iovec>, inputFragments:UnsafeBufferPointer<iovec>, output:UnsafeMutablePointer<UInt8>) throws -> Tag {
+		var newTag = Tag()
+		switch nonce.RAW_access_staticbuff({ noncePtr in
+			return newTag.RAW_access_staticbuff_mutating { tagPtr in
+				return __crawdog_chachapoly_cryptv(&ctx, noncePtr, associatedFragments.baseAddress, associatedFragments.count, inputFragments.baseAddress, inputFragments.count, output, tagPtr, Int32(MemoryLayout<Tag>.size), 1)
+			}
+		}) {
+			case 0:
+				return newTag
+			case __CRAWDOG_CHACHAPOLY_INVALID_MAC:
+				throw InvalidMACError()
+			default:
+				fatalError("unknown error thrown from rawdog chachapoly impl")
+		}
+	}
+
+	/// execute authenticated decryption over a chain of ciphertext fragments, writing the plaintext contiguously.
+	/// - parameters:
+	///		- tag: the tag to authenticate the decryption
+	///		- nonce: the nonce to use for this decryption
+	///		- associatedFragments: the associated data fragments. may be empty.
+	///		- inputFragments: the ciphertext fragments
+	///		- output: the output buffer. must be at least as large as all input fragments together.
+	public mutating func decrypt(tag:consuming Tag, nonce:consuming Nonce, associatedFragments:UnsafeBufferPointer<iovec>, inputFragments:UnsafeBufferPointer<iovec>, output:UnsafeMutablePointer<UInt8>) throws {
+		switch nonce.RAW_access_staticbuff({ noncePtr in
+			tag.RAW_access_staticbuff_mutating { tagPtr in
+				__crawdog_chachapoly_cryptv(&ctx, noncePtr, associatedFragments.baseAddress, associatedFragments.count, inputFragments.baseAddress, inputFragments.count, output, tagPtr, Int32(MemoryLayout<Tag>.size), 0)
+			}
+		}) {
+			case 0:
+				return
+			case __CRAWDOG_CHACHAPOLY_INVALID_MAC:
+				throw InvalidMACError()
+			default:
+				fatalError("unknown error thrown from rawdog chachapoly impl")
+		}
+	}
+}
@@ -28,7 +28,7 @@ public struct PublicKey:Sendable, Hashable, Comparable, Equatable {
 
 /// represents a private key in the curve25519 key exchange
 @RAW_staticbuff(bytes:32)
-public struct PrivateKey:Sendable, Hashable, Comparable, Equatable {}
+public struct PrivateKey:Sendable, Hashable, Comparable, Equatable, RAW_staticbuff_secret {}
 
 extension MemoryGuarded where GuardedStaticbuffType == PrivateKey {
 	/// generates a private key in a cryptographically secure manner
@@ -44,7 +44,7 @@ extension MemoryGuarded where GuardedStaticbuffType == PrivateKey {
 
 /// represents a shared key in the curve25519 key exchange
 @RAW_staticbuff(bytes:32)
-public struct SharedKey:Sendable, Hashable, Comparable, Equatable {}
+public struct SharedKey:Sendable, Hashable, Comparable, Equatable, RAW_staticbuff_secret {}
 
 extension MemoryGuarded where GuardedStaticbuffType == SharedKey {
 	/// computes a shared key from a private key and a public key
@@ -60,3 +60,40 @@ extension MemoryGuarded where GuardedStaticbuffType == SharedKey {
 		}
 	}
 }
+
+extension MemoryGuardedArena where GuardedStaticbuffType == SharedKey {
+	/// computes a shared key from a private key and a public key directly into a slot of the arena.
+	/// - makes no heap allocations and no system calls, so it is suitable for steady-state handshake loops.
+	///	- parameters:
+	///		- slot: the index of the arena slot that receives the shared key
+	///		- privateKey: the local private key
+	///		- publicKey: the remote public key
+	public func compute(slot:Int, privateKey:MemoryGuarded<PrivateKey>, publicKey:borrowing PublicKey) {
+		RAW_access_mutating(slot:slot) { sharedKeyPtr in
+			publicKey.RAW_access { pubBuff in
+				privateKey.RAW_access { pkBuff in
+					__crawdog_curve25519_calculate_shared_key(sharedKeyPtr.baseAddress!, pubBuff.baseAddress, pkBuff.baseAddress)
+				}
+			}
+		}
+	}
+
+	/// computes the shared keys of one private key with many public keys, writing the shared key for `publicKeys[i]` into slot `firstSlot + i`.
+	/// - makes no heap allocations and no system calls.
+	///	- parameters:
+	///		- firstSlot: the index of the arena slot that receives the first shared key
+	///		- privateKey: the local private key
+	///		- publicKeys: the remote public keys
+	public func compute(firstSlot:Int, privateKey:MemoryGuarded<PrivateKey>, publicKeys:[PublicKey]) {
+		precondition(firstSlot >= 0 && firstSlot + publicKeys.count <= count, "memory guarded arena does not have enough slots for the batch")
+		privateKey.RAW_access { pkBuff in
+			for i in 0..<publicKeys.count {
+				RAW_access_mutating(slot:firstSlot + i) { sharedKeyPtr in
+					publicKeys[i].RAW_access { pubBuff in
+						__crawdog_curve25519_calculate_shared_key(sharedKeyPtr.baseAddress!, pubBuff.baseAddress, pkBuff.baseAddress)
+					}
+				}
+			}
+		}
+	}
+}
@@ -4,7 +4,7 @@ import RAW
 
 /// represents a private key in the ed25519 key exchange
 @RAW_staticbuff(bytes:64)
-public struct PrivateKey:Sendable, Hashable, Comparable, Equatable {}
+public struct PrivateKey:Sendable, Hashable, Comparable, Equatable, RAW_staticbuff_secret {}
 
 /// a blinding context that can be used to harden ed25519 signature operations.
 public struct BlindingContext:~Copyable {
@@ -48,6 +48,108 @@ public struct BlindingContext:~Copyable {
 	}
 }
 
+/// a thread safe signing service that keeps a pool of blinding contexts for concurrent ed25519 signing.
+/// - signers are spread across the pool, each thread preferring the same context while it is uncontended.
+/// - every context is re-seeded after a fixed number of signatures. the replacement context is built before its slot is locked, so re-seeding never holds up other signers.
+public final class SigningService:@unchecked Sendable {
+	/// the type of error that is thrown when the pool of blinding contexts could not be created.
+	public struct PoolInitializationFailure:Swift.Error {}
+
+	/// the pointer that will be used to reference the signing pool for the cryptographic functions.
+	internal let storage:UnsafeMutableRawPointer
+
+	/// the number of blinding contexts held by this service.
+	public var count:Int {
+		return __crawdog_ed25519_signing_pool_size(storage)
+	}
+
+	/// initialize a new signing service, seeding every blinding context from secure random bytes.
+	/// - parameters:
+	///		- contexts: the number of blinding contexts to keep in the pool. pass `0` to keep one context per online processor.
+	///		- refreshInterval: the number of signatures each context produces before it is re-seeded. pass `0` to never re-seed.
+	public init(contexts:Int = 0, refreshInterval:UInt64 = 4096) throws {
+		let seed = try generateSecureRandomBytes(count:64)
+		guard let newPool = seed.RAW_access({ seedBuffer in
+			return __crawdog_ed25519_signing_pool_init(contexts, seedBuffer.baseAddress!, seedBuffer.count, refreshInterval)
+		}) else {
+			throw PoolInitializationFailure()
+		}
+		storage = newPool
+	}
+
+	/// sign a message with any available blinding context. safe to call from any number of threads or tasks at once.
+	///	- parameters:
+	///		- signature: the destination of the 64 byte signature
+	///		- privateKey: the private key to sign with
+	///		- message: the bytes to sign
+	public func sign(to signature:UnsafeMutablePointer<UInt8>, privateKey:MemoryGuarded<PrivateKey>, message:UnsafeBufferPointer<UInt8>) {
+		var slot:Int = 0
+		let refreshDue = privateKey.RAW_access { privateKeyPtr in
+			return __crawdog_ed25519_signing_pool_sign(storage, signature, privateKeyPtr.baseAddress!, message.baseAddress!, message.count, &slot)
+		}
+		if refreshDue == 1 {
+			refresh(slot:slot)
+		}
+	}
+
+	/// replace the blinding context of a slot with a freshly seeded one.
+	private func refresh(slot:Int) {
+		// when entropy is unavailable the current context stays in service and the slot asks again on its next signature.
+		guard let seed = try? generateSecureRandomBytes(count:64) else {
+			return
+		}
+		seed.RAW_access { seedBuffer in
+			_ = __crawdog_ed25519_signing_pool_refresh(storage, slot, seedBuffer.baseAddress!, seedBuffer.count)
+		}
+	}
+
+	/// clear and free every blinding context when the service is dereferenced
+	deinit {
+		__crawdog_ed25519_signing_pool_finish(storage)
+	}
+}
+
+/// a 32 byte little-endian scalar used as the multiplier of an ed25519 point in `multiScalarMultiply(scalars:points:)`.
+@RAW_staticbuff(bytes:32)
+public struct Scalar:Sendable, Hashable, Equatable {}
+
+/// the type of error that is thrown when bytes that do not encode a point on the ed25519 curve are used as a point.
+public struct InvalidPointEncoding:Swift.Error {}
+
+/// computes the sum of `scalars[i] * points[i]` with a single multi-scalar multiplication.
+/// - Straus is used for small batches and Pippenger with an adaptive window for large ones.
+/// - scalars are used as given and are not reduced modulo the group order.
+/// - runs in variable time. only use with public inputs (aggregation of public keys, signature components).
+///	- parameters:
+///		- scalars: the multipliers. must have the same count as `points`.
+///		- points: the encoded ed25519 points.
+///	- returns: the encoded ed25519 point of the sum.
+public func multiScalarMultiply(scalars:[Scalar], points:[PublicKey]) throws(InvalidPointEncoding) -> PublicKey {
+	precondition(scalars.count == points.count, "multi-scalar multiplication requires one scalar per point")
+	var scalarBytes = [UInt8]()
+	var pointBytes = [UInt8]()
+	scalarBytes.reserveCapacity(scalars.count * 32)
+	pointBytes.reserveCapacity(points.count * 32)
+	for scalar in scalars {
+		scalar.RAW_access { scalarBytes.append(contentsOf:$0) }
+	}
+	for point in points {
+		point.RAW_access { pointBytes.append(contentsOf:$0) }
+	}
+	var result = PublicKey(RAW_staticbuff:PublicKey.RAW_staticbuff_zeroed())
+	let success = result.RAW_access_mutating { resultBuffer in
+		scalarBytes.RAW_access { scalarBuffer in
+			pointBytes.RAW_access { pointBuffer in
+				return __crawdog_ed25519_multi_scalar_mult(resultBuffer.baseAddress!, scalarBuffer.baseAddress, pointBuffer.baseAddress, points.count, __CRAWDOG_ED25519_MSM_AUTO)
+			}
+		}
+	}
+	guard success == 1 else {
+		throw InvalidPointEncoding()
+	}
+	return result
+}
+
 /// a reusable context that can be used to efficiently verify large quantities of messages.
 public struct VerificationContext:~Copyable {
 	
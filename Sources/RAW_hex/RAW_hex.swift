@@ -21,6 +21,9 @@ public enum Error:Swift.Error {
 	/// thrown when the hex string is not a valid hex character.
 	/// - valid hex characters are `0-9`, `a-f`, and `A-F` in ascii form.
 	case invalidHexEncodingCharacter(Character)
+	/// thrown by the constant time decoders when the input holds a character that is not a valid hex character.
+	/// - the error carries neither the character nor its position, so that nothing about secret input escapes through it.
+	case invalidEncoding
 	/// thrown when a hex encoded string is not a valid size for the decoding algorithm. encoded strings must be an even number of characters, since they are represented with twice as many bytes.
 	case invalidEncodingSize(size_t)
 }
@@ -55,7 +58,67 @@ public func encode(_ inputByte:UnsafeBufferPointer<UInt8>) -> Encoded {
 	return Encoded(decoded_bytes:[UInt8](inputByte))
 }
 
+/// the number of characters that encoding the given number of bytes produces.
+public func encodedLength(_ byteCount:size_t) -> size_t {
+	return Encode.length(byteCount)
+}
+
+/// encode bytes straight to a hex string, with one allocation and one pass over the input.
+public func encode<A:RAW_accessible>(_ accessibleBytes:borrowing A, uppercase:Bool) -> String {
+	accessibleBytes.RAW_access { decodedBytesToEncode in
+		return Encode.string(decoded_bytes:decodedBytesToEncode, uppercase:uppercase)
+	}
+}
+public func encode(_ inputByte:UnsafeBufferPointer<UInt8>, uppercase:Bool) -> String {
+	return Encode.string(decoded_bytes:inputByte, uppercase:uppercase)
+}
+
+/// encode bytes as ascii hex characters into a caller provided buffer of at least ``encodedLength(_:)`` bytes.
+/// - returns: the number of characters written.
+public func encode<A:RAW_accessible>(_ accessibleBytes:borrowing A, into output:UnsafeMutableRawBufferPointer, uppercase:Bool = false) -> size_t {
+	accessibleBytes.RAW_access { decodedBytesToEncode in
+		return Encode.write(decoded_bytes:decodedBytesToEncode, into:output, uppercase:uppercase)
+	}
+}
+public func encode(_ inputByte:UnsafeBufferPointer<UInt8>, into output:UnsafeMutableRawBufferPointer, uppercase:Bool = false) -> size_t {
+	return Encode.write(decoded_bytes:inputByte, into:output, uppercase:uppercase)
+}
+
 // decode functions
+/// decode a hex encoded string to a decoded byte array.
+public func decode(_ str:consuming String) throws -> [UInt8] {
+	var str = str
+	return try str.withUTF8 { utf8Buffer in
+		try Decode.process(contiguous:UnsafeRawBufferPointer(utf8Buffer))
+	}
+}
+
+/// decode a hex encoded string without branches or table lookups that depend on its characters, for secret material such as keys and api secrets.
+/// - the time taken depends only on the length of the string. invalid characters are only reported once the whole string has been decoded, as ``Error/invalidEncoding``.
+public func decode(_ str:consuming String, constantTime:Bool) throws -> [UInt8] {
+	var str = str
+	return try str.withUTF8 { utf8Buffer in
+		try Decode.process(contiguous:UnsafeRawBufferPointer(utf8Buffer), constantTime:constantTime)
+	}
+}
+
+/// decode a hex encoded string into a caller provided buffer of exactly half as many bytes as the string has characters.
+/// - parameter constantTime: decode without branches or table lookups that depend on the characters. rejected input leaves the output zeroed and throws ``Error/invalidEncoding``.
+public func decode(_ str:consuming String, into output:UnsafeMutableRawBufferPointer, constantTime:Bool = false) throws {
+	var str = str
+	try str.withUTF8 { utf8Buffer in
+		try Decode.write(contiguous:UnsafeRawBufferPointer(utf8Buffer), into:output, constantTime:constantTime)
+	}
+}
+
+/// decode a hex encoded secret straight into guarded memory, in constant time. the decoded bytes never pass through unguarded storage.
+/// - the string must encode exactly as many bytes as the guarded type holds. rejected input leaves the guarded value zeroed.
+public func decode<G>(_ str:consuming String, into guarded:MemoryGuarded<G>) throws where G:RAW_staticbuff {
+	try guarded.RAW_access_mutating { guardedBytes in
+		try decode(str, into:UnsafeMutableRawBufferPointer(guardedBytes), constantTime:true)
+	}
+}
+
 /// decode a base64 encoded string to a decoded byte array.
 public func decode<S>(_ str:consuming S) throws -> [UInt8] where S:Sequence, S.Element == Character {
 	var buildValues = [Value]()
@@ -79,12 +142,22 @@ public func decode(_ encoded:borrowing Encoded) -> [UInt8] {
 extension String {
 	/// initialize a string from a hex encoded value. the resulting string will be the ascii-based hex string of representing the byte values.
 	public init(_ encoded:consuming Encoded) {
+		self = encoded.decoded_data.withUnsafeBufferPointer { Encode.string(decoded_bytes:$0) }
+	}
+
+	/// initialize a string from a hex encoded value, with upper or lower case letters.
+	public init(_ encoded:consuming Encoded, uppercase:Bool) {
+		self = encoded.decoded_data.withUnsafeBufferPointer { Encode.string(decoded_bytes:$0, uppercase:uppercase) }
+	}
+
+	/// initialize a string from a hex encoded value, one hex value at a time.
+	internal init(perElement encoded:consuming Encoded) {
 		self = .init(_encoder_main_char(encoded))
 	}
 }
 
 extension RAW_encoded_unicode {
 	public init(_ encoded:consuming Encoded) {
-		self.init(String(_encoder_main_char(encoded)))
+		self.init(String(encoded))
 	}
 }
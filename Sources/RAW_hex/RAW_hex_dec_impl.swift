@@ -2,6 +2,7 @@
 // copyright (c) tanner silva 2024. all rights reserved.
 
 import RAW
+import __crawdog_hex
 
 internal struct Decode {
 	/// computes the number of decoded bytes that would be required to decode the given number of encoded bytes.
@@ -15,6 +16,67 @@ internal struct Decode {
 		}
 	}
 
+	/// decodes a contiguous buffer of hex characters (either case) in a single pass through the bulk codec.
+	/// - parameter constantTime: decode without branches or table lookups that depend on the characters.
+	internal static func process(contiguous encoded:UnsafeRawBufferPointer, constantTime:Bool = false) throws -> [UInt8] {
+		guard encoded.count > 0 else {
+			return []
+		}
+		var thrown:Swift.Error? = nil
+		let decoded = [UInt8](unsafeUninitializedCapacity:encoded.count / 2, initializingWith: { decodedBuffer, decodedCount in
+			do {
+				try write(contiguous:encoded, into:UnsafeMutableRawBufferPointer(decodedBuffer), constantTime:constantTime)
+				decodedCount = encoded.count / 2
+			} catch let error {
+				thrown = error
+				decodedCount = 0
+			}
+		})
+		if let thrown {
+			throw thrown
+		}
+		return decoded
+	}
+
+	/// the whole character that the utf-8 byte at the given offset belongs to, so that non-ascii input is reported as it was written.
+	/// - a byte that is not part of a valid utf-8 sequence is reported as the replacement character.
+	internal static func character(in encoded:UnsafeRawBufferPointer, at offset:size_t) -> Character {
+		var start = offset
+		while start > 0 && encoded[start] & 0xC0 == 0x80 {
+			start -= 1
+		}
+		var iterator = encoded[start...].makeIterator()
+		var parser = Unicode.UTF8.ForwardParser()
+		guard case .valid(let scalarBytes) = parser.parseScalar(from:&iterator), start + scalarBytes.count > offset else {
+			return "\u{FFFD}"
+		}
+		return Character(Unicode.UTF8.decode(scalarBytes))
+	}
+
+	/// decodes a contiguous buffer of hex characters into a caller provided buffer of exactly half as many bytes.
+	/// - parameter constantTime: decode without branches or table lookups that depend on the characters. rejected input leaves the output zeroed and throws ``Error/invalidEncoding``.
+	internal static func write(contiguous encoded:UnsafeRawBufferPointer, into output:UnsafeMutableRawBufferPointer, constantTime:Bool = false) throws {
+		guard output.count == encoded.count / 2 else {
+			throw Error.invalidEncodingSize(encoded.count)
+		}
+		guard let source = encoded.baseAddress, encoded.count > 0 else {
+			return
+		}
+		var errorOffset:size_t = 0
+		let result = __crawdog_hex_decode(output.baseAddress?.assumingMemoryBound(to:UInt8.self), source.assumingMemoryBound(to:CChar.self), encoded.count, constantTime ? __CRAWDOG_HEX_CONSTANT_TIME : 0, &errorOffset)
+		switch result {
+			case __CRAWDOG_HEX_OK:
+				return
+			case __CRAWDOG_HEX_INVALID_CHARACTER:
+				guard constantTime == false else {
+					throw Error.invalidEncoding
+				}
+				throw Error.invalidHexEncodingCharacter(character(in:encoded, at:errorOffset))
+			default:
+				throw Error.invalidEncodingSize(encoded.count)
+		}
+	}
+
 	/// primary decoding function for the  decoder.
 	// internal static func process(bytes values:UnsafePointer<UInt8>, count value_size:size_t) throws -> ([UInt8], size_t) {
 	// 	// compute the length of the input buffer. if it's less than 2, we can't decode it.
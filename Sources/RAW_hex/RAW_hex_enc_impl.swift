@@ -2,6 +2,8 @@
 // copyright (c) tanner silva 2024. all rights reserved.
 
 import RAW
+import __crawdog_hex
+
 internal struct Encode {
 
 	/// computes the number of encoded bytes that would be required to encode the given number of unencoded bytes.
@@ -15,6 +17,39 @@ internal struct Encode {
 		let low = byte & 0x0F
 		return (Value(hexcharIndexValue:high), Value(hexcharIndexValue:low))
 	}
+
+	/// encodes a contiguous byte buffer to a hex string in a single pass through the bulk codec.
+	internal static func string(decoded_bytes bytes:UnsafeBufferPointer<UInt8>, uppercase:Bool = false) -> String {
+		guard let source = bytes.baseAddress, bytes.count > 0 else {
+			return ""
+		}
+		let encodedLength = length(bytes.count)
+		let flags = uppercase ? __CRAWDOG_HEX_UPPERCASE : 0
+		if #available(macOS 11.0, *) {
+			return String(unsafeUninitializedCapacity:encodedLength, initializingUTF8With: { utf8Buffer in
+				return UnsafeMutableRawPointer(utf8Buffer.baseAddress!).withMemoryRebound(to:CChar.self, capacity:encodedLength) { charPtr in
+					__crawdog_hex_encode(charPtr, source, bytes.count, flags)
+				}
+			})
+		} else {
+			let utf8 = [UInt8](unsafeUninitializedCapacity:encodedLength, initializingWith: { utf8Buffer, utf8Count in
+				utf8Count = UnsafeMutableRawPointer(utf8Buffer.baseAddress!).withMemoryRebound(to:CChar.self, capacity:encodedLength) { charPtr in
+					__crawdog_hex_encode(charPtr, source, bytes.count, flags)
+				}
+			})
+			return String(decoding:utf8, as:UTF8.self)
+		}
+	}
+
+	/// encodes a contiguous byte buffer into a caller provided buffer of at least `length(bytes.count)` bytes. returns the number of characters written.
+	internal static func write(decoded_bytes bytes:UnsafeBufferPointer<UInt8>, into output:UnsafeMutableRawBufferPointer, uppercase:Bool = false) -> size_t {
+		let encodedLength = length(bytes.count)
+		precondition(output.count >= encodedLength, "RAW_hex output buffer is too small for the encoded characters")
+		guard let source = bytes.baseAddress, bytes.count > 0 else {
+			return 0
+		}
+		return __crawdog_hex_encode(output.baseAddress!.assumingMemoryBound(to:CChar.self), source, bytes.count, uppercase ? __CRAWDOG_HEX_UPPERCASE : 0)
+	}
 }
 
 /// get values from raw decoded byte intake
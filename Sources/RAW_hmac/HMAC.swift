@@ -10,36 +10,34 @@ public struct HMAC<H:RAW_hasher> {
 	private static func initiate(key:UnsafeRawPointer, count:size_t) throws -> Self {
 		var innerContext = try H.init()
 		var outerContext = try H.init()
-		var tmp:UInt8 = 0;
-		var keyScratch = H.RAW_hasher_outputtype(RAW_decode:key)!
-		try keyScratch.RAW_access_mutating { keyScratchPtr in
-			let useKeyPtr:UnsafePointer<UInt8>
+		// the key is padded to a whole block and xor-ed with each pad in place, so that each context absorbs its pad in a single update
+		try withUnsafeTemporaryAllocation(byteCount:H.RAW_hasher_blocksize, alignment:MemoryLayout<UInt64>.alignment) { padBuffer in
+			let padBytes = padBuffer.bindMemory(to:UInt8.self)
 			let useKeyCount:size_t
 			if (count > H.RAW_hasher_blocksize) {
 				var keyContext = try H.init()
 				try keyContext.update(key, count:count)
-				try keyContext.finish(into:keyScratchPtr.baseAddress!)
-				useKeyPtr = UnsafePointer(keyScratchPtr.baseAddress!)
-				useKeyCount = keyScratchPtr.count
+				try keyContext.finish(into:padBuffer.baseAddress!)
+				useKeyCount = MemoryLayout<H.RAW_hasher_outputtype>.size
 			} else {
-				useKeyPtr = key.assumingMemoryBound(to:UInt8.self)
+				padBuffer.baseAddress!.copyMemory(from:key, byteCount:count)
 				useKeyCount = count
 			}
+			for i in useKeyCount..<H.RAW_hasher_blocksize {
+				padBytes[i] = 0
+			}
 
 			// ipad / opad processing
 
-			for i in 0..<useKeyCount {
-				tmp = useKeyPtr[i] ^ 0x5c;
-				try outerContext.update([tmp])
-				tmp = useKeyPtr[i] ^ 0x36;
-				try innerContext.update([tmp])
+			for i in 0..<H.RAW_hasher_blocksize {
+				padBytes[i] ^= 0x36
 			}
-			for _ in useKeyCount..<H.RAW_hasher_blocksize {
-				tmp = 0x5c;
-				try outerContext.update([tmp])
-				tmp = 0x36;
-				try innerContext.update([tmp])
+			try innerContext.update(UnsafeRawBufferPointer(padBuffer))
+			for i in 0..<H.RAW_hasher_blocksize {
+				padBytes[i] ^= 0x36 ^ 0x5c
 			}
+			try outerContext.update(UnsafeRawBufferPointer(padBuffer))
+			try secureZeroBytes(padBuffer)
 		}
 		return Self(inner:innerContext, outer:outerContext)
 	}
@@ -77,6 +75,30 @@ public struct HMAC<H:RAW_hasher> {
 	}
 }
 
+// verification
+extension HMAC {
+	/// finish the computation and compare the result with an expected MAC in constant time.
+	/// - parameters:
+	///		- expected: the MAC to check. a MAC shorter than `minimumLength` or longer than the output of the hasher is rejected.
+	///		- minimumLength: the shortest truncated MAC to accept, compared over its own length. defaults to the full output of the hasher, so truncated MACs are only accepted when the caller opts in.
+	public mutating func verify(_ expected:UnsafeRawBufferPointer, minimumLength:Int = MemoryLayout<H.RAW_hasher_outputtype.RAW_staticbuff_storetype>.size) throws -> Bool {
+		let outputLength = MemoryLayout<H.RAW_hasher_outputtype.RAW_staticbuff_storetype>.size
+		precondition(minimumLength > 0 && minimumLength <= outputLength, "RAW_hmac.HMAC.verify minimum length must be between 1 and the output size of the hasher")
+		let computed = try finish()
+		guard expected.count >= minimumLength && expected.count <= outputLength else {
+			return false
+		}
+		return computed.RAW_access_staticbuff { computedPtr in
+			RAW_constant_time_equal(computedPtr, expected.baseAddress!, count:expected.count)
+		}
+	}
+
+	/// finish the computation and compare the result with an expected MAC in constant time.
+	public mutating func verify(_ expected:borrowing H.RAW_hasher_outputtype) throws -> Bool {
+		return try finish().RAW_equals_constant_time(expected)
+	}
+}
+
 // update with data pointers
 extension HMAC {
 	public mutating func update(message inputData:UnsafeRawBufferPointer) throws {
@@ -90,6 +112,24 @@ extension HMAC {
 	public mutating func update(message data:UnsafeRawPointer, count:size_t) throws {
 		try innerContext.update(data, count:count)
 	}
+
+	public mutating func update(message span:Span<UInt8>) throws {
+		try innerContext.update(span)
+	}
+
+	public mutating func update(message span:RawSpan) throws {
+		try innerContext.update(span)
+	}
+
+	/// update the message with a chain of fragments, in order.
+	public mutating func update(message vectors:UnsafeBufferPointer<iovec>) throws {
+		try innerContext.update(vectored:vectors)
+	}
+
+	/// update the message with a collection of fragments, in order, without copying them together.
+	public mutating func update<C>(messageFragments fragments:C) throws where C:Collection, C.Element == UnsafeRawBufferPointer {
+		try innerContext.update(fragments:fragments)
+	}
 }
 
 // update with raw accessible types
@@ -109,4 +149,11 @@ extension RAW_hasher {
 		try hmac.update(message:message)
 		return try hmac.finish()
 	}
+
+	/// compute the HMAC of a message and compare it with an expected MAC in constant time.
+	public static func hmacVerify<K, M>(key:borrowing K, message:borrowing M, expected:borrowing RAW_hasher_outputtype) throws -> Bool where K:RAW_accessible, M:RAW_accessible {
+		var hmac = try HMAC<Self>(key:key)
+		try hmac.update(message:message)
+		return try hmac.verify(expected)
+	}
 }
\ No newline at end of file
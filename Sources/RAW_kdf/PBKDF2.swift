@@ -0,0 +1,71 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import RAW_hmac
+import RAW
+
+extension RAW_hasher {
+	/// derive key material from a password with PBKDF2 (rfc 8018), using HMAC with this hasher as the pseudorandom function.
+	/// - the password is absorbed into the inner and outer pad states once. every iteration starts from a copy of those two compression states instead of keying a new HMAC.
+	/// - parameters:
+	///		- password: the password bytes. BIP39 and most other users pass UTF-8 text.
+	///		- salt: the salt bytes.
+	///		- iterations: the number of HMAC invocations per output block. must be at least one.
+	///		- output: the buffer to fill with derived key material.
+	public static func pbkdf2(password:UnsafeRawBufferPointer, salt:UnsafeRawBufferPointer, iterations:Int, into output:UnsafeMutableRawBufferPointer) throws {
+		precondition(iterations > 0, "RAW_kdf.pbkdf2 requires at least one iteration")
+		let digestCount = MemoryLayout<RAW_hasher_outputtype>.size
+		var emptyPassword:UInt8 = 0
+		let keyed = try withUnsafeMutablePointer(to:&emptyPassword) { emptyPasswordPtr in
+			return try HMAC<Self>(key:password.baseAddress ?? UnsafeRawPointer(emptyPasswordPtr), count:password.count)
+		}
+
+		// the current HMAC output (U) and the running xor of every output of the block (T)
+		try withUnsafeTemporaryAllocation(byteCount:digestCount * 2, alignment:MemoryLayout<UInt64>.alignment) { scratch in
+			let u = scratch.baseAddress!
+			let t = u + digestCount
+			var blockIndex:UInt32 = 1
+			var outputOffset = 0
+			while outputOffset < output.count {
+				var prf = keyed
+				if salt.count > 0 {
+					try prf.update(message:salt)
+				}
+				var blockIndexBigEndian = blockIndex.bigEndian
+				try prf.update(message:&blockIndexBigEndian, count:MemoryLayout<UInt32>.size)
+				try prf.finish(into:u)
+				t.copyMemory(from:u, byteCount:digestCount)
+
+				let uBytes = u.assumingMemoryBound(to:UInt8.self)
+				let tBytes = t.assumingMemoryBound(to:UInt8.self)
+				var iteration = 1
+				while iteration < iterations {
+					prf = keyed
+					try prf.update(message:u, count:digestCount)
+					try prf.finish(into:u)
+					for i in 0..<digestCount {
+						tBytes[i] ^= uBytes[i]
+					}
+					iteration += 1
+				}
+
+				let copyCount = min(digestCount, output.count - outputOffset)
+				(output.baseAddress! + outputOffset).copyMemory(from:t, byteCount:copyCount)
+				outputOffset += copyCount
+				blockIndex += 1
+			}
+			try secureZeroBytes(scratch)
+		}
+	}
+
+	/// derive `outputLength` bytes of key material from a password with PBKDF2 (rfc 8018), using HMAC with this hasher as the pseudorandom function.
+	public static func pbkdf2<P, S>(password:borrowing P, salt:borrowing S, iterations:Int, outputLength:Int) throws -> [UInt8] where P:RAW_accessible, S:RAW_accessible {
+		return try [UInt8](unsafeUninitializedCapacity:outputLength) { outputBuffer, outputCount in
+			try password.RAW_access { passwordBuffer in
+				try salt.RAW_access { saltBuffer in
+					try pbkdf2(password:UnsafeRawBufferPointer(passwordBuffer), salt:UnsafeRawBufferPointer(saltBuffer), iterations:iterations, into:UnsafeMutableRawBufferPointer(outputBuffer))
+				}
+			}
+			outputCount = outputLength
+		}
+	}
+}
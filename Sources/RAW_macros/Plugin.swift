@@ -17,7 +17,8 @@ struct RAW_macros:CompilerPlugin {
 		RAW_staticbuff_floatingpoint_type_macro.self,
 		RAW_staticbuff_fixedwidthinteger_type_macro.self,
 		RAW_staticbuff_bytes_macro.self,
-		RAW_staticbuff_concat_macro.self
+		RAW_staticbuff_concat_macro.self,
+		RAW_serializable_macro.self
 	]
 }
 
@@ -267,3 +268,145 @@ fileprivate func generateTypeExpression(typeSyntax:IdentifierTypeSyntax, byteCou
 	}
 	return TupleTypeSyntax(leftParen:TokenSyntax.leftParenToken(), elements:buildContents, rightParen:TokenSyntax.rightParenToken())
 }
+
+/// generates the members that the RAW_staticbuff macros specialize for the byte count of the attached type: word-wise bitwise operators, hashing, constant time comparison and (optionally) equality.
+/// - the byte count is a compile time constant in the generated code, so every loop is unrolled or vectorized by the compiler for the exact size of the type.
+/// - members that the attached struct already declares are not generated.
+/// - parameters:
+///		- byteCountExpr: an expression for the byte count of the type that folds to a constant.
+///		- withEquality: generate `==`. this is only correct for types whose RAW_compare is a plain byte comparison.
+/// - the generated `==` always compares in constant time, so that it never shadows the `==` of ``RAW_staticbuff_secret`` with an early exit comparison, wherever that conformance is declared.
+internal func generateWordwiseStaticbuffMembers(_ asStruct:StructDeclSyntax, byteCountExpr:String, withEquality:Bool, context:some MacroExpansionContext) -> [DeclSyntax] {
+	var declared = Set<String>()
+	for member in asStruct.memberBlock.members {
+		if let funcDecl = member.decl.as(FunctionDeclSyntax.self) {
+			declared.insert(funcDecl.name.text)
+		} else if let varDecl = member.decl.as(VariableDeclSyntax.self) {
+			for binding in varDecl.bindings {
+				if let name = binding.pattern.as(IdentifierPatternSyntax.self)?.identifier.text {
+					declared.insert(name)
+				}
+			}
+		}
+	}
+	let wordwiseName = context.makeUniqueName("RAW_staticbuff_wordwise")
+	var decls = [DeclSyntax]()
+
+	decls.append(DeclSyntax("""
+		/// applies a bitwise operation to every word of two values.
+		private static func \(wordwiseName)(_ lhs:Self, _ rhs:Self, _ op:(UInt64, UInt64) -> UInt64) -> Self {
+			var result = lhs
+			withUnsafeMutableBytes(of:&result) { out in
+				withUnsafeBytes(of:rhs) { rhsBytes in
+					var i = 0
+					while i + 8 <= \(raw:byteCountExpr) {
+						out.storeBytes(of:op(out.loadUnaligned(fromByteOffset:i, as:UInt64.self), rhsBytes.loadUnaligned(fromByteOffset:i, as:UInt64.self)), toByteOffset:i, as:UInt64.self)
+						i += 8
+					}
+					while i < \(raw:byteCountExpr) {
+						out[i] = UInt8(truncatingIfNeeded:op(UInt64(out[i]), UInt64(rhsBytes[i])))
+						i += 1
+					}
+				}
+			}
+			return result
+		}
+	"""))
+	// a conformance to RAW_staticbuff_secret may be declared in an extension that the macro can not see, and a generated `==` would shadow the constant time `==` of that protocol. equality is therefore always generated through the constant time comparison.
+	if declared.contains("==") == false && (withEquality || inheritsType(asStruct, named:"RAW_staticbuff_secret")) {
+		decls.append(DeclSyntax("""
+			/// constant time equality of the raw representations.
+			\(asStruct.modifiers) static func == (lhs:Self, rhs:Self) -> Bool {
+				return lhs.RAW_equals_constant_time(rhs)
+			}
+		"""))
+	}
+	if declared.contains("RAW_equals_constant_time") == false {
+		decls.append(DeclSyntax("""
+			/// compare two values for equality in time that does not depend on their contents.
+			\(asStruct.modifiers) borrowing func RAW_equals_constant_time(_ other:borrowing Self) -> Bool {
+				return withUnsafeBytes(of:self) { lhsBytes in
+					withUnsafeBytes(of:other) { rhsBytes in
+						RAW_constant_time_equal(lhsBytes.baseAddress!, rhsBytes.baseAddress!, count:\(raw:byteCountExpr))
+					}
+				}
+			}
+		"""))
+	}
+	for (op, summary) in [("^", "exclusive or"), ("&", "and"), ("|", "or")] where declared.contains(op) == false {
+		decls.append(DeclSyntax("""
+			/// word-wise bitwise \(raw:summary) of the raw representations.
+			\(asStruct.modifiers) static func \(raw:op) (lhs:Self, rhs:Self) -> Self {
+				return \(wordwiseName)(lhs, rhs, { $0 \(raw:op) $1 })
+			}
+		"""))
+		if declared.contains(op + "=") == false {
+			decls.append(DeclSyntax("""
+				\(asStruct.modifiers) static func \(raw:op)= (lhs:inout Self, rhs:Self) {
+					lhs = \(wordwiseName)(lhs, rhs, { $0 \(raw:op) $1 })
+				}
+			"""))
+		}
+	}
+	if declared.contains("~") == false {
+		decls.append(DeclSyntax("""
+			/// word-wise bitwise inversion of the raw representation.
+			\(asStruct.modifiers) static prefix func ~ (value:Self) -> Self {
+				return \(wordwiseName)(value, value, { lhs, _ in ~lhs })
+			}
+		"""))
+	}
+	if declared.contains("RAW_hash_prefix") == false {
+		decls.append(DeclSyntax("""
+			/// the first eight bytes of the raw representation as a little endian integer, zero padded for shorter buffers.
+			\(asStruct.modifiers) var RAW_hash_prefix:UInt64 {
+				var prefix:UInt64 = 0
+				withUnsafeMutableBytes(of:&prefix) { prefixBytes in
+					withUnsafeBytes(of:self) { selfBytes in
+						prefixBytes.copyMemory(from:UnsafeRawBufferPointer(rebasing:selfBytes.prefix(8)))
+					}
+				}
+				return UInt64(littleEndian:prefix)
+			}
+		"""))
+	}
+	if declared.contains("RAW_staticbuff_hash") == false {
+		decls.append(DeclSyntax("""
+			/// feed the raw representation into a hasher one word at a time.
+			\(asStruct.modifiers) borrowing func RAW_staticbuff_hash(into hasher:inout Swift.Hasher) {
+				withUnsafeBytes(of:self) { selfBytes in
+					var i = 0
+					while i + 8 <= \(raw:byteCountExpr) {
+						hasher.combine(selfBytes.loadUnaligned(fromByteOffset:i, as:UInt64.self))
+						i += 8
+					}
+					while i < \(raw:byteCountExpr) {
+						hasher.combine(selfBytes[i])
+						i += 1
+					}
+				}
+			}
+		"""))
+	}
+	return decls
+}
+
+/// true when the struct lists a type with the given name in its inheritance clause, plain (`Name`) or module qualified (`Module.Name`).
+internal func inheritsType(_ asStruct:StructDeclSyntax, named name:String) -> Bool {
+	for inherited in asStruct.inheritanceClause?.inheritedTypes ?? [] {
+		if inherited.type.as(IdentifierTypeSyntax.self)?.name.text == name || inherited.type.as(MemberTypeSyntax.self)?.name.text == name {
+			return true
+		}
+	}
+	return false
+}
+
+/// true when the struct carries an attribute with the given name, in addition to the macro being expanded.
+internal func hasAttribute(_ asStruct:StructDeclSyntax, named name:String) -> Bool {
+	for attr in asStruct.attributes {
+		if attr.as(AttributeSyntax.self)?.attributeName.as(IdentifierTypeSyntax.self)?.name.text == name {
+			return true
+		}
+	}
+	return false
+}
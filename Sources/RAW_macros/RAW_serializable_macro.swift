@@ -0,0 +1,213 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import SwiftSyntax
+import SwiftSyntaxBuilder
+import SwiftSyntaxMacros
+import SwiftDiagnostics
+import SwiftParser
+
+#if RAWDOG_MACRO_LOG
+import Logging
+fileprivate let mainLogger = Logger(label:"RAW_serializable_macro")
+#endif
+
+/// generates the RAW_serializable implementation for a struct from its stored properties, in declaration order.
+/// - the fixed size of the struct is emitted as a literal when every field type is a known integer, boolean or variable size type. otherwise it is summed once from the field types into a static constant.
+/// - the implementation is generated in an extension so that the memberwise initializer of the struct is kept.
+internal struct RAW_serializable_macro:ExtensionMacro {
+	// thrown when a stored property has no explicit type annotation.
+	internal struct MissingTypeAnnotation:Swift.Error, DiagnosticMessage {
+		internal let message:String
+		internal var severity:DiagnosticSeverity { return .error }
+		internal var diagnosticID:MessageID { return MessageID(domain:"RAW_serializable_macro", id:"missingTypeAnnotation") }
+		internal init(name:String) {
+			self.message = "stored property '\(name)' needs an explicit type annotation to be serialized"
+		}
+	}
+
+	// thrown when a stored property is a constant with an initial value, which a deserializer can not assign.
+	internal struct InitializedConstant:Swift.Error, DiagnosticMessage {
+		internal let message:String
+		internal var severity:DiagnosticSeverity { return .error }
+		internal var diagnosticID:MessageID { return MessageID(domain:"RAW_serializable_macro", id:"initializedConstant") }
+		internal init(name:String) {
+			self.message = "stored property '\(name)' is a constant with an initial value and can not be deserialized. declare it with 'var' or remove the initial value"
+		}
+	}
+
+	// a stored property that takes part in serialization.
+	private struct Field {
+		let name:String
+		let type:TypeSyntax
+	}
+
+	// true when the binding stores a value (no accessors, or only observers).
+	private static func isStored(_ binding:PatternBindingSyntax) -> Bool {
+		guard let accessorBlock = binding.accessorBlock else {
+			return true
+		}
+		switch accessorBlock.accessors {
+			case .getter(_):
+				return false
+			case .accessors(let accessors):
+				for accessor in accessors {
+					switch accessor.accessorSpecifier.text {
+						case "willSet", "didSet":
+							continue
+						default:
+							return false
+					}
+				}
+				return true
+		}
+	}
+
+	private static func storedFields(of structDecl:StructDeclSyntax, in context:some MacroExpansionContext) -> [Field]? {
+		var fields = [Field]()
+		var valid = true
+		for member in structDecl.memberBlock.members {
+			guard let varDecl = member.decl.as(VariableDeclSyntax.self) else {
+				continue
+			}
+			guard varDecl.modifiers.contains(where: { $0.name.text == "static" || $0.name.text == "class" }) == false else {
+				continue
+			}
+			for binding in varDecl.bindings {
+				guard isStored(binding) else {
+					continue
+				}
+				guard let name = binding.pattern.as(IdentifierPatternSyntax.self)?.identifier.text else {
+					continue
+				}
+				guard let typeAnnotation = binding.typeAnnotation else {
+					context.diagnose(Diagnostic(node:binding, message:MissingTypeAnnotation(name:name)))
+					valid = false
+					continue
+				}
+				guard varDecl.bindingSpecifier.text != "let" || binding.initializer == nil else {
+					context.diagnose(Diagnostic(node:binding, message:InitializedConstant(name:name)))
+					valid = false
+					continue
+				}
+				fields.append(Field(name:name, type:typeAnnotation.type.trimmed))
+			}
+		}
+		return valid ? fields : nil
+	}
+
+	// the serialized size of field types that are known by name, or nil when the size is only known to the compiler.
+	private enum KnownSize {
+		case fixed(Int)
+		case variable
+	}
+	private static func knownSize(of type:TypeSyntax) -> KnownSize? {
+		if type.is(ArrayTypeSyntax.self) {
+			return .variable
+		}
+		var name = type.trimmedDescription
+		if name.hasPrefix("Swift.") {
+			name.removeFirst("Swift.".count)
+		}
+		switch name {
+			case "UInt8", "Int8", "Bool":
+				return .fixed(1)
+			case "UInt16", "Int16":
+				return .fixed(2)
+			case "UInt32", "Int32":
+				return .fixed(4)
+			case "UInt64", "Int64", "UInt", "Int":
+				return .fixed(8)
+			case "String", "Array<UInt8>":
+				return .variable
+			default:
+				return nil
+		}
+	}
+
+	// true when the struct or any type it is nested in has generic parameters. the parameters of an extended type are not visible here, so a struct nested in an extension is treated as generic.
+	private static func isGeneric(_ structDecl:StructDeclSyntax, in context:some MacroExpansionContext) -> Bool {
+		guard structDecl.genericParameterClause == nil else {
+			return true
+		}
+		for lexical in context.lexicalContext {
+			if lexical.as(StructDeclSyntax.self)?.genericParameterClause != nil || lexical.as(ClassDeclSyntax.self)?.genericParameterClause != nil || lexical.as(EnumDeclSyntax.self)?.genericParameterClause != nil || lexical.is(ExtensionDeclSyntax.self) {
+				return true
+			}
+		}
+		return false
+	}
+
+	// the generated members carry the access level of the struct so that they can witness the protocol requirements.
+	private static func accessModifier(of structDecl:StructDeclSyntax) -> String {
+		for mod in structDecl.modifiers {
+			switch mod.name.text {
+				case "public", "open":
+					return "public "
+				case "package":
+					return "package "
+				default:
+					continue
+			}
+		}
+		return ""
+	}
+
+	public static func expansion(of node:SwiftSyntax.AttributeSyntax, attachedTo declaration:some SwiftSyntax.DeclGroupSyntax, providingExtensionsOf type:some SwiftSyntax.TypeSyntaxProtocol, conformingTo protocols:[SwiftSyntax.TypeSyntax], in context:some SwiftSyntaxMacros.MacroExpansionContext) throws -> [SwiftSyntax.ExtensionDeclSyntax] {
+		guard let structDecl = declaration.as(StructDeclSyntax.self) else {
+			#if RAWDOG_MACRO_LOG
+			mainLogger.error("expected struct declaration, found \(String(describing:declaration.syntaxNodeType))")
+			#endif
+			context.diagnose(Diagnostic(node:node, message:ExpectedStructAttachment(found:declaration.syntaxNodeType)))
+			return []
+		}
+		guard let fields = storedFields(of:structDecl, in:context) else {
+			return []
+		}
+		let access = accessModifier(of:structDecl)
+
+		// fixed size: a literal when every field size is known by name, otherwise summed once from the field types
+		let knownSizes = fields.map { knownSize(of:$0.type) }
+		let fixedSizeValue:String
+		if knownSizes.contains(where: { if case .variable = $0 { return true } else { return false } }) {
+			fixedSizeValue = "nil"
+		} else if knownSizes.allSatisfy({ $0 != nil }) {
+			fixedSizeValue = String(knownSizes.reduce(0) { if case .fixed(let size) = $1 { return $0 + size } else { return $0 } })
+		} else {
+			let bindings = fields.enumerated().map { "let size\($0.offset) = RAW_serial_field_fixed_size(of:\($0.element.type).self)" }
+			let sum = fields.indices.map { "size\($0)" }
+			fixedSizeValue = """
+			{
+				guard \(bindings.joined(separator:", ")) else {
+					return nil
+				}
+				return \(sum.joined(separator:" + "))
+			}()
+			"""
+		}
+		let fixedSizeDecl:String
+		if isGeneric(structDecl, in:context) {
+			// generic contexts can not have static stored properties
+			fixedSizeDecl = "\(access)static var RAW_serial_fixed_size:Int? {\nreturn \(fixedSizeValue)\n}"
+		} else {
+			fixedSizeDecl = "\(access)static let RAW_serial_fixed_size:Int? = \(fixedSizeValue)"
+		}
+
+		let serializeBody = fields.map { "writer.RAW_serialize_field(self.\($0.name))" }.joined(separator:"\n")
+		let deserializeBody = fields.map { "self.\($0.name) = try reader.RAW_deserialize_field(\($0.type).self)" }.joined(separator:"\n")
+
+		return [try ExtensionDeclSyntax("""
+			extension \(type):RAW_serializable {
+				\(raw:fixedSizeDecl)
+				\(raw:access)borrowing func RAW_serialize(into writer:RAW_serial_writer) {
+					if let fixedSize = Self.RAW_serial_fixed_size {
+						writer.reserve(fixedSize)
+					}
+					\(raw:serializeBody)
+				}
+				\(raw:access)init(RAW_deserialize reader:inout RAW_serial_reader) throws(RAW_serial_error) {
+					\(raw:deserializeBody)
+				}
+			}
+		""")]
+	}
+}
@@ -502,7 +502,7 @@ public struct RAW_staticbuff_bytes_macro:MemberMacro, ExtensionMacro {
 	}
 
 	public static func expansion(of node:SwiftSyntax.AttributeSyntax, providingMembersOf declaration: some SwiftSyntax.DeclGroupSyntax, conformingTo protocols:[TypeSyntax],  in context: some SwiftSyntaxMacros.MacroExpansionContext) throws -> [SwiftSyntax.DeclSyntax] {
-		guard let (asStruct, _, byteCount) = Self.determineIfUsageCompliant(declaration:declaration, node:node, context:context, addDiagnostics:true) else {
+		guard let (asStruct, hasRAWCompareOverride, byteCount) = Self.determineIfUsageCompliant(declaration:declaration, node:node, context:context, addDiagnostics:true) else {
 			return []
 		}
 
@@ -594,6 +594,10 @@ public struct RAW_staticbuff_bytes_macro:MemberMacro, ExtensionMacro {
 				}
 			}
 		"""))
+
+		// byte-wise equality is only correct when the type compares by its raw bytes. floating point types compare by value.
+		let comparesRawBytes = hasRAWCompareOverride == false && hasAttribute(asStruct, named:"RAW_staticbuff_binaryfloatingpoint_type") == false
+		declString.append(contentsOf:generateWordwiseStaticbuffMembers(asStruct, byteCountExpr:"\(byteCount)", withEquality:comparesRawBytes, context:context))
 		
 		return declString
 	}
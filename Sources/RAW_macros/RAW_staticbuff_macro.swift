@@ -1160,6 +1160,8 @@ public struct RAW_staticbuff_concat_macro:MemberMacro, ExtensionMacro {
 				}
 			}
 		"""))
+		// concatenated types compare field by field with the RAW_compare of each field type, which is not necessarily a byte comparison. equality is left to RAW_compare.
+		buildDecls.append(contentsOf:generateWordwiseStaticbuffMembers(asStruct, byteCountExpr:"MemoryLayout<RAW_staticbuff_storetype>.size", withEquality:false, context:context))
 		return buildDecls
 	}
 }
@@ -29,6 +29,13 @@ public struct Hasher<RAW_hasher_outputtype:RAW_staticbuff>:RAW_hasher where RAW_
 	public mutating func update(_ data:UnsafeRawPointer, count:size_t) {
 		__crawdog_md5_update(&context, data, UInt32(count))
 	}
+
+	public mutating func update(vectored vectors:UnsafeBufferPointer<iovec>) {
+		guard vectors.count > 0 else {
+			return
+		}
+		__crawdog_md5_updatev(&context, vectors.baseAddress!, vectors.count)
+	}
 	
 	public mutating func finish(into pointer:UnsafeMutableRawPointer) throws {
 		__crawdog_md5_finish(&context, pointer.assumingMemoryBound(to:__crawdog_md5_output.self))
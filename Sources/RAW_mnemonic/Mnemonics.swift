@@ -2,6 +2,9 @@
 // copyright (c) tanner silva 2024. all rights reserved.
 import RAW
 import RAW_sha256
+import RAW_sha512
+import RAW_kdf
+import __crawdog_mnemonic
 
 public struct Mnemonic {
 	enum Error:Swift.Error {
@@ -36,127 +39,169 @@ public struct Mnemonic {
 	}
 	
 	
-	static public func encode(_ data:UnsafeBufferPointer<UInt8>) throws -> [String] {
+	/// the first byte of the SHA-256 digest of the entropy, which holds every checksum bit.
+	static private func checksumByte(_ data:UnsafeRawBufferPointer) throws -> UInt8 {
+		var hasher = RAW_sha256.Hasher<RAW_sha256.Hash>()
+		hasher.update(data)
+		return try withUnsafeTemporaryAllocation(byteCount:MemoryLayout<RAW_sha256.Hash>.size, alignment:1) { hashBuffer in
+			try hasher.finish(into:hashBuffer.baseAddress!)
+			return hashBuffer[0]
+		}
+	}
+
+	/// the entropy followed by its checksum bits, in a stack buffer that is zeroed afterwards, even when body throws.
+	static private func withSentenceBits<R>(_ data:UnsafeBufferPointer<UInt8>, _ body:(UnsafePointer<UInt8>, Int) throws -> R) throws -> R {
 		guard data.count >= 16 && data.count <= 32 && data.count.isMultiple(of:4) else {
 			throw Error.unsupportedDataByteCount(data.count)
 		}
-	
-		var hashBytes = [UInt8](repeating: 0, count: 32)
-		var hasher = Hasher<Hash>()
-		hasher.update(data)
-		try hasher.finish(into: &hashBytes)
-
-		let checksumBits:Int = checksumBitCount(bytes: data.count)
-		
-		var words: [String] = []
-		
-		var acc: UInt16 = 0      // will hold at most 16 bits
-		var accBits = 0          // number of bits currently in `acc`
+		let checksumBits = checksumBitCount(bytes:data.count)
+		let checksum = try checksumByte(UnsafeRawBufferPointer(data))
+		return try withUnsafeTemporaryAllocation(of:UInt8.self, capacity:data.count + 1) { bits in
+			defer {
+				try? secureZeroBytes(UnsafeMutableRawBufferPointer(bits))
+			}
+			_ = bits.initialize(from:data)
+			bits[data.count] = checksum & UInt8(truncatingIfNeeded:0xFF << (8 - checksumBits))
+			return try body(UnsafePointer(bits.baseAddress!), wordCountWithChecksum(bytes:data.count))
+		}
+	}
 
-		@inline(__always) func push(bit: UInt8) {
-			acc = (acc << 1) | UInt16(bit)
-			accBits += 1
+	/// verify the checksum bits that follow the entropy of a joined sentence and copy the entropy out. returns the number of entropy bytes.
+	/// - the caller zeroes bits.
+	static private func verifyChecksum(_ bits:UnsafeMutableBufferPointer<UInt8>, wordCount:Int, into data:UnsafeMutableRawPointer) throws -> Int {
+		let entropyCount = wordCount * 4 / 3
+		let checksumShift = 8 - wordCount / 3
+		let checksum = try checksumByte(UnsafeRawBufferPointer(start:bits.baseAddress!, count:entropyCount))
+		guard bits[entropyCount] >> checksumShift == checksum >> checksumShift else {
+			throw Error.checksumMismatch
+		}
+		data.copyMemory(from:bits.baseAddress!, byteCount:entropyCount)
+		return entropyCount
+	}
 
-			// Whenever we have 11 or more bits we can emit a word
-			if accBits >= 11 {
-				let shift = accBits - 11
-				let idx = Int((acc >> shift) & 0x7FF)
-				words.append(WordList.english[idx])
+	/// the size of a buffer that can hold the sentence of any entropy of the given length.
+	static public func maximumSentenceByteCount(bytes length:size_t, wordList:WordList = .english) -> size_t {
+		let list = wordList.list.pointee
+		return wordCountWithChecksum(bytes:length) * Int(list.max_word_length + list.separator_length) - Int(list.separator_length)
+	}
 
-				acc &= (1 << shift) - 1
-				accBits = shift
+	static public func encode(_ data:UnsafeBufferPointer<UInt8>, wordList:WordList = .english) throws -> [String] {
+		return try withSentenceBits(data) { bits, wordCount in
+			return withUnsafeTemporaryAllocation(of:UInt16.self, capacity:wordCount) { indices in
+				defer {
+					try? secureZeroBytes(UnsafeMutableRawBufferPointer(indices))
+				}
+				__crawdog_mnemonic_split(indices.baseAddress!, bits, wordCount)
+				return indices.map { wordList[Int($0)] }
 			}
 		}
+	}
 
-		for byte in data {
-			for i in (0..<8).reversed() {
-				let bit = (byte >> i) & 0x01
-				push(bit: bit)
-			}
+	/// encode entropy as a sentence, with the words joined by the separator of the word list, into a caller provided buffer of at least ``maximumSentenceByteCount(bytes:wordList:)`` bytes, without allocating.
+	/// - returns: the number of bytes written.
+	static public func encode(_ data:UnsafeBufferPointer<UInt8>, wordList:WordList = .english, into sentence:UnsafeMutableRawBufferPointer) throws -> Int {
+		return try withSentenceBits(data) { bits, wordCount in
+			let written = __crawdog_mnemonic_encode(wordList.list, sentence.baseAddress?.assumingMemoryBound(to:CChar.self), sentence.count, bits, wordCount)
+			precondition(written > 0, "RAW_mnemonic.Mnemonic sentence buffer is too small")
+			return written
 		}
-		
-		for i in 0..<checksumBits {
-			let byteIndex = i / 8
-			let bitIndex  = 7 - (i % 8)
-			let bit = (hashBytes[byteIndex] >> bitIndex) & 0x01
-			push(bit: bit)
-		}
-		
-		// Encode last word if there are leftover bits
-		if accBits > 0 {
-			let shift = 11 - accBits
-			let idx = Int((acc << shift) & 0x7FF)
-			words.append(WordList.english[idx])
-		}
-		
-		return words
 	}
-	
-	static public func decode(_ words:[String], into data:UnsafeMutablePointer<UInt8>) throws {
+
+	static public func decode(_ words:[String], wordList:WordList = .english, into data:UnsafeMutablePointer<UInt8>) throws {
 		guard words.count >= 12 && words.count <= 24 && words.count.isMultiple(of:3) else {
 			throw Error.unsupportedWordCount(words.count)
 		}
-		
-		var indices: [UInt16] = []
-
-		for w in words {
-			guard let idx = WordList.englishIndex[w] else {
-				throw Error.unknownWord(w)
+		try withUnsafeTemporaryAllocation(of:UInt16.self, capacity:words.count) { indices in
+			defer {
+				try? secureZeroBytes(UnsafeMutableRawBufferPointer(indices))
 			}
-			indices.append(UInt16(idx))
-		}
-		
-		var acc: UInt16 = 0
-		var accBits = 0
-		
-		let entropyBits = words.count * 11 * 32 / 33
-		let checksumBits  = words.count * 11 - entropyBits
-		let entropyBytes = entropyBits / 8
-		
-		var entropy = [UInt8](repeating: 0, count: entropyBytes)
-		var byteIdx = 0
-
-		for idx in indices {
-			for i in (0..<11).reversed() {
-				let bit = UInt16((idx >> i) & 1)
-				acc = (acc << 1) | UInt16(bit)
-				accBits += 1
-
-				if accBits == 8  && byteIdx < entropyBytes {
-					entropy[byteIdx] = UInt8(acc)
-					acc = 0
-					accBits = 0
-					byteIdx += 1
+			for (i, word) in words.enumerated() {
+				guard let index = wordList.index(of:word) else {
+					throw Error.unknownWord(word)
 				}
+				indices[i] = UInt16(index)
+			}
+			try withUnsafeTemporaryAllocation(of:UInt8.self, capacity:(words.count * 11 + 7) / 8) { bits in
+				defer {
+					try? secureZeroBytes(UnsafeMutableRawBufferPointer(bits))
+				}
+				__crawdog_mnemonic_join(bits.baseAddress!, indices.baseAddress!, words.count)
+				_ = try verifyChecksum(bits, wordCount:words.count, into:data)
 			}
 		}
+	}
 
-		// ---------- Verify checksum ----------
-		var hasher = Hasher<Hash>()
-		try hasher.update(entropy)
-		var hash = [UInt8](repeating: 0, count: 32)
-		try hasher.finish(into: &hash)
+	/// decode a sentence, with the words separated by the separator of the word list or an ASCII space, into a caller provided buffer of at least 32 bytes, without allocating.
+	/// - the words are compared by their bytes, so a sentence in a language with non-ASCII words must be NFKD normalized.
+	/// - returns: the number of entropy bytes written.
+	static public func decode(sentence:UnsafeRawBufferPointer, wordList:WordList = .english, into data:UnsafeMutableRawBufferPointer) throws -> Int {
+		return try withUnsafeTemporaryAllocation(of:UInt8.self, capacity:(Int(__CRAWDOG_MNEMONIC_MAX_SENTENCE_WORDS) * 11 + 7) / 8) { bits in
+			defer {
+				try? secureZeroBytes(UnsafeMutableRawBufferPointer(bits))
+			}
+			var wordCount = 0
+			var errorOffset = 0
+			var errorLength = 0
+			switch __crawdog_mnemonic_decode(wordList.list, bits.baseAddress!, &wordCount, sentence.baseAddress?.assumingMemoryBound(to:CChar.self), sentence.count, &errorOffset, &errorLength) {
+				case __CRAWDOG_MNEMONIC_OK:
+					break
+				case __CRAWDOG_MNEMONIC_UNKNOWN_WORD:
+					throw Error.unknownWord(String(decoding:sentence[errorOffset..<(errorOffset + errorLength)], as:UTF8.self))
+				default:
+					throw Error.unsupportedWordCount(wordCount)
+			}
+			guard wordCount >= 12 && wordCount <= 24 && wordCount.isMultiple(of:3) else {
+				throw Error.unsupportedWordCount(wordCount)
+			}
+			precondition(data.count >= wordCount * 4 / 3, "RAW_mnemonic.Mnemonic entropy buffer is too small")
+			return try verifyChecksum(bits, wordCount:wordCount, into:data.baseAddress!)
+		}
+	}
 
-		// Pull out the first `checksumBits` bits of the digest.
-		var trueCS: UInt16 = 0
-		var csBits = 0
-		for i in 0..<checksumBits {
-			let byteIndex = i / 8
-			let bitIndex  = 7 - (i % 8)
-			let bit = (hash[byteIndex] >> bitIndex) & 0x01
-			trueCS = (trueCS << 1) | UInt16(bit)
-			csBits += 1
+	/// decode a sentence, with the words separated by the separator of the word list or an ASCII space, into a caller provided buffer of at least 32 bytes.
+	/// - a non-ASCII sentence whose words are not found by their bytes is split into words and looked up again with ``WordList/index(of:)``, which also finds words that are canonically equivalent to the words of the list. compatibility forms are not folded.
+	/// - returns: the number of entropy bytes written.
+	static public func decode(sentence:String, wordList:WordList = .english, into data:UnsafeMutableRawBufferPointer) throws -> Int {
+		var sentence = sentence
+		do {
+			return try sentence.withUTF8 { sentenceBuffer in
+				try decode(sentence:UnsafeRawBufferPointer(sentenceBuffer), wordList:wordList, into:data)
+			}
+		} catch Error.unknownWord(let word) where sentence.utf8.contains(where:{ $0 >= 0x80 }) {
+			let separator = wordList.separator
+			let words = sentence.split(separator:" ").flatMap { $0.split(separator:separator) }.map(String.init)
+			guard words.count >= 12 && words.count <= 24 && words.count.isMultiple(of:3) else {
+				throw Error.unknownWord(word)
+			}
+			precondition(data.count >= words.count * 4 / 3, "RAW_mnemonic.Mnemonic entropy buffer is too small")
+			try decode(words, wordList:wordList, into:data.baseAddress!.assumingMemoryBound(to:UInt8.self))
+			return words.count * 4 / 3
 		}
+	}
 
-		let mnemonicCS = UInt16(acc & ((1 << checksumBits) - 1))
+	/// the number of bytes in a BIP39 seed.
+	static public let seedByteCount:size_t = 64
 
-		if mnemonicCS != trueCS {
-			throw Error.checksumMismatch
+	/// derive the BIP39 seed of a mnemonic sentence: PBKDF2-HMAC-SHA512 over the space separated words, salted with "mnemonic" and the passphrase, with 2048 iterations.
+	/// - the words are not checked against the word list or the checksum, as BIP39 specifies.
+	/// - BIP39 hashes NFKD normalized text. the english word list is already normalized, but callers with non-ASCII words or passphrases must normalize them before calling.
+	/// - parameter seed: a buffer of ``seedByteCount`` bytes.
+	static public func seed(_ words:[String], passphrase:String = "", into seed:UnsafeMutableRawBufferPointer) throws {
+		precondition(seed.count == seedByteCount, "RAW_mnemonic.Mnemonic.seed output must be \(seedByteCount) bytes")
+		var sentence = words.joined(separator:" ")
+		var salt = "mnemonic" + passphrase
+		try sentence.withUTF8 { sentenceBuffer in
+			try salt.withUTF8 { saltBuffer in
+				try RAW_sha512.Hasher<RAW_sha512.Hash>.pbkdf2(password:UnsafeRawBufferPointer(sentenceBuffer), salt:UnsafeRawBufferPointer(saltBuffer), iterations:2048, into:seed)
+			}
 		}
+	}
 
-		// ---------- CheckSum Verified, Copy Data ----------
-		for i in 0..<entropyBytes {
-			data[i] = entropy[i]
+	/// derive the 64 byte BIP39 seed of a mnemonic sentence. see ``seed(_:passphrase:into:)``.
+	static public func seed(_ words:[String], passphrase:String = "") throws -> [UInt8] {
+		return try [UInt8](unsafeUninitializedCapacity:seedByteCount) { seedBuffer, seedCount in
+			try seed(words, passphrase:passphrase, into:UnsafeMutableRawBufferPointer(seedBuffer))
+			seedCount = seedByteCount
 		}
 	}
 }
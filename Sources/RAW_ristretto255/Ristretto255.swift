@@ -0,0 +1,226 @@
+import __crawdog_curve25519
+import RAW
+
+/// thrown when bytes that are not the canonical encoding of a ristretto255 group element are used as an element.
+public struct InvalidElementEncoding:Swift.Error {}
+
+/// thrown when a domain separation tag longer than 255 bytes is passed to a hash-to-group or hash-to-scalar function.
+public struct InvalidDomainSeparationTag:Swift.Error {}
+
+/// thrown when the multiplicative inverse of a zero scalar is requested.
+public struct ZeroScalarInversion:Swift.Error {}
+
+/// represents the canonical 32 byte encoding of an element of the ristretto255 prime order group (RFC 9496).
+/// - two elements are equal exactly when their encodings are equal, so the synthesized `Equatable` and `Hashable` conformances are group equality.
+@RAW_staticbuff(bytes:32)
+public struct Element:Sendable, Hashable, Equatable {
+
+	/// the identity element of the group.
+	public static var identity:Element {
+		return Element(RAW_staticbuff:Element.RAW_staticbuff_zeroed())
+	}
+
+	/// the canonical generator of the group. its encoding is a constant (RFC 9496 §4.4), so no point is multiplied on first use.
+	public static var generator:Element {
+		return Element(RAW_staticbuff:(0xe2, 0xf2, 0xae, 0x0a, 0x6a, 0xbc, 0x4e, 0x71, 0xa8, 0x84, 0xa9, 0x61, 0xc5, 0x00, 0x51, 0x5f, 0x58, 0xe3, 0x0b, 0x6a, 0xa5, 0x82, 0xdd, 0x8d, 0xb6, 0xa6, 0x59, 0x45, 0xe0, 0x8d, 0x2d, 0x76))
+	}
+
+	/// returns `true` when the bytes of this instance are a canonical element encoding.
+	public var isValid:Bool {
+		return RAW_access { elementBuffer in
+			return __crawdog_ristretto255_is_valid(elementBuffer.baseAddress!) == 1
+		}
+	}
+
+	/// derive an element from the ristretto255 generator and a scalar (`scalar * generator`).
+	public init(multiplying scalar:borrowing Scalar) {
+		self = Element(RAW_staticbuff:Element.RAW_staticbuff_zeroed())
+		RAW_access_mutating { elementBuffer in
+			scalar.RAW_access { scalarBuffer in
+				__crawdog_ristretto255_scalarmult_base(elementBuffer.baseAddress!, scalarBuffer.baseAddress!)
+			}
+		}
+	}
+
+	/// map 64 uniformly random bytes to an element (RFC 9496 element derivation).
+	/// - parameters:
+	///		- uniform: exactly 64 bytes of uniformly distributed data, such as a SHA-512 digest.
+	public init(uniform:UnsafeBufferPointer<UInt8>) {
+		precondition(uniform.count == 64, "ristretto255 element derivation requires exactly 64 uniform bytes")
+		self = Element(RAW_staticbuff:Element.RAW_staticbuff_zeroed())
+		RAW_access_mutating { elementBuffer in
+			__crawdog_ristretto255_from_uniform(elementBuffer.baseAddress!, uniform.baseAddress!)
+		}
+	}
+
+	/// hash arbitrary bytes to an element with the RFC 9380 suite `ristretto255_XMD:SHA-512_R255MAP_RO_`.
+	/// - parameters:
+	///		- message: the bytes to hash.
+	///		- domain: the domain separation tag. must be 255 bytes or less.
+	public init(hashing message:UnsafeBufferPointer<UInt8>, domain:UnsafeBufferPointer<UInt8>) throws(InvalidDomainSeparationTag) {
+		self = Element(RAW_staticbuff:Element.RAW_staticbuff_zeroed())
+		let result = RAW_access_mutating { elementBuffer in
+			return __crawdog_ristretto255_hash_to_group(elementBuffer.baseAddress!, message.baseAddress, message.count, domain.baseAddress, domain.count)
+		}
+		guard result == 1 else {
+			throw InvalidDomainSeparationTag()
+		}
+	}
+
+	/// returns `self + other`.
+	public borrowing func adding(_ other:borrowing Element) throws(InvalidElementEncoding) -> Element {
+		var sum = Element(RAW_staticbuff:Element.RAW_staticbuff_zeroed())
+		let result = sum.RAW_access_mutating { sumBuffer in
+			RAW_access { elementBuffer in
+				other.RAW_access { otherBuffer in
+					return __crawdog_ristretto255_add(sumBuffer.baseAddress!, elementBuffer.baseAddress!, otherBuffer.baseAddress!)
+				}
+			}
+		}
+		guard result == 1 else {
+			throw InvalidElementEncoding()
+		}
+		return sum
+	}
+
+	/// returns `self - other`.
+	public borrowing func subtracting(_ other:borrowing Element) throws(InvalidElementEncoding) -> Element {
+		var difference = Element(RAW_staticbuff:Element.RAW_staticbuff_zeroed())
+		let result = difference.RAW_access_mutating { differenceBuffer in
+			RAW_access { elementBuffer in
+				other.RAW_access { otherBuffer in
+					return __crawdog_ristretto255_sub(differenceBuffer.baseAddress!, elementBuffer.baseAddress!, otherBuffer.baseAddress!)
+				}
+			}
+		}
+		guard result == 1 else {
+			throw InvalidElementEncoding()
+		}
+		return difference
+	}
+
+	/// returns `scalar * self`. runs in constant time with respect to the scalar.
+	public borrowing func multiplied(by scalar:borrowing Scalar) throws(InvalidElementEncoding) -> Element {
+		var product = Element(RAW_staticbuff:Element.RAW_staticbuff_zeroed())
+		let result = product.RAW_access_mutating { productBuffer in
+			RAW_access { elementBuffer in
+				scalar.RAW_access { scalarBuffer in
+					return __crawdog_ristretto255_scalarmult(productBuffer.baseAddress!, scalarBuffer.baseAddress!, elementBuffer.baseAddress!)
+				}
+			}
+		}
+		guard result == 1 else {
+			throw InvalidElementEncoding()
+		}
+		return product
+	}
+}
+
+/// represents a 32 byte little-endian scalar modulo the ristretto255 group order `l = 2^252 + 27742317777372353535851937790883648493`.
+/// - every arithmetic function returns a fully reduced scalar. scalars that are not fully reduced are reduced before use.
+@RAW_staticbuff(bytes:32)
+public struct Scalar:Sendable, Hashable, Equatable {
+
+	/// returns `true` when the bytes of this instance are fully reduced modulo the group order.
+	public var isCanonical:Bool {
+		return RAW_access { scalarBuffer in
+			return __crawdog_ristretto255_scalar_is_canonical(scalarBuffer.baseAddress!) == 1
+		}
+	}
+
+	/// reduce a 64 byte little-endian number modulo the group order.
+	/// - parameters:
+	///		- wide: exactly 64 bytes. pass 64 secure random bytes to produce a uniformly distributed scalar.
+	public init(reducing wide:UnsafeBufferPointer<UInt8>) {
+		precondition(wide.count == 64, "ristretto255 scalar reduction requires exactly 64 bytes")
+		self = Scalar(RAW_staticbuff:Scalar.RAW_staticbuff_zeroed())
+		RAW_access_mutating { scalarBuffer in
+			__crawdog_ristretto255_scalar_reduce(scalarBuffer.baseAddress!, wide.baseAddress!)
+		}
+	}
+
+	/// hash arbitrary bytes to a scalar: expand_message_xmd (SHA-512) to 64 bytes, reduced modulo the group order.
+	/// - parameters:
+	///		- message: the bytes to hash.
+	///		- domain: the domain separation tag. must be 255 bytes or less.
+	public init(hashing message:UnsafeBufferPointer<UInt8>, domain:UnsafeBufferPointer<UInt8>) throws(InvalidDomainSeparationTag) {
+		self = Scalar(RAW_staticbuff:Scalar.RAW_staticbuff_zeroed())
+		let result = RAW_access_mutating { scalarBuffer in
+			return __crawdog_ristretto255_hash_to_scalar(scalarBuffer.baseAddress!, message.baseAddress, message.count, domain.baseAddress, domain.count)
+		}
+		guard result == 1 else {
+			throw InvalidDomainSeparationTag()
+		}
+	}
+
+	/// generate a uniformly distributed scalar from 64 cryptographically secure random bytes.
+	public static func random() throws -> Scalar {
+		return try generateSecureRandomBytes(count:64).RAW_access { randomBuffer in
+			return Scalar(reducing:randomBuffer)
+		}
+	}
+
+	/// returns `self + other mod l`.
+	public borrowing func adding(_ other:borrowing Scalar) -> Scalar {
+		var sum = Scalar(RAW_staticbuff:Scalar.RAW_staticbuff_zeroed())
+		sum.RAW_access_mutating { sumBuffer in
+			RAW_access { scalarBuffer in
+				other.RAW_access { otherBuffer in
+					__crawdog_ristretto255_scalar_add(sumBuffer.baseAddress!, scalarBuffer.baseAddress!, otherBuffer.baseAddress!)
+				}
+			}
+		}
+		return sum
+	}
+
+	/// returns `self - other mod l`.
+	public borrowing func subtracting(_ other:borrowing Scalar) -> Scalar {
+		var difference = Scalar(RAW_staticbuff:Scalar.RAW_staticbuff_zeroed())
+		difference.RAW_access_mutating { differenceBuffer in
+			RAW_access { scalarBuffer in
+				other.RAW_access { otherBuffer in
+					__crawdog_ristretto255_scalar_sub(differenceBuffer.baseAddress!, scalarBuffer.baseAddress!, otherBuffer.baseAddress!)
+				}
+			}
+		}
+		return difference
+	}
+
+	/// returns `self * other mod l`.
+	public borrowing func multiplied(by other:borrowing Scalar) -> Scalar {
+		var product = Scalar(RAW_staticbuff:Scalar.RAW_staticbuff_zeroed())
+		product.RAW_access_mutating { productBuffer in
+			RAW_access { scalarBuffer in
+				other.RAW_access { otherBuffer in
+					__crawdog_ristretto255_scalar_mul(productBuffer.baseAddress!, scalarBuffer.baseAddress!, otherBuffer.baseAddress!)
+				}
+			}
+		}
+		return product
+	}
+
+	/// returns `-self mod l`.
+	public borrowing func negated() -> Scalar {
+		var negation = Scalar(RAW_staticbuff:Scalar.RAW_staticbuff_zeroed())
+		negation.RAW_access_mutating { negationBuffer in
+			RAW_access { scalarBuffer in
+				__crawdog_ristretto255_scalar_negate(negationBuffer.baseAddress!, scalarBuffer.baseAddress!)
+			}
+		}
+		return negation
+	}
+
+	/// returns `1 / self mod l`. runs in constant time with respect to the scalar.
+	public borrowing func inverted() throws(ZeroScalarInversion) -> Scalar {
+		var inverse = Scalar(RAW_staticbuff:Scalar.RAW_staticbuff_zeroed())
+		let result = inverse.RAW_access_mutating { inverseBuffer in
+			RAW_access { scalarBuffer in
+				return __crawdog_ristretto255_scalar_invert(inverseBuffer.baseAddress!, scalarBuffer.baseAddress!)
+			}
+		}
+		guard result == 1 else {
+			throw ZeroScalarInversion()
+		}
+		return inverse
+	}
+}
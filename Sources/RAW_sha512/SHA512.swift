@@ -3,7 +3,10 @@ import RAW
 
 /// a static length structure representing a SHA512 hash result.
 @RAW_staticbuff(bytes:64)
-public struct Hash:Sendable {}
+public struct Hash:Sendable, Hashable, Equatable {}
+
+// digests are uniformly distributed, so their first eight bytes are used as their hash value.
+extension Hash:RAW_staticbuff_uniform {}
 
 public struct Hasher<RAW_hasher_outputtype:RAW_staticbuff>:RAW_hasher where RAW_hasher_outputtype.RAW_staticbuff_storetype == (UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8, UInt8) {
 	public static var RAW_hasher_blocksize:size_t { size_t(__CRAWDOG_SHA512_BLOCK_SIZE) }
@@ -27,6 +30,13 @@ public struct Hasher<RAW_hasher_outputtype:RAW_staticbuff>:RAW_hasher where RAW_
 	public mutating func update(_ data:UnsafeRawPointer, count:size_t) {
 		__crawdog_sha512_update(&context, data, UInt32(count))
 	}
+
+	public mutating func update(vectored vectors:UnsafeBufferPointer<iovec>) {
+		guard vectors.count > 0 else {
+			return
+		}
+		__crawdog_sha512_updatev(&context, vectors.baseAddress!, vectors.count)
+	}
 	
 	public mutating func finish(into pointer:UnsafeMutableRawPointer) throws {
 		__crawdog_sha512_finish(&context, pointer.assumingMemoryBound(to:__crawdog_sha512_output.self))
@@ -0,0 +1,1076 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+#include "crawdog_base64.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CRAWDOG_BASE64_HAVE_X86
+#include <immintrin.h>
+#define SSSE3_TARGET __attribute__((target("ssse3")))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define CRAWDOG_BASE64_HAVE_NEON
+#include <arm_neon.h>
+#endif
+
+/* -- alphabets ----------------------------------------------------------------- */
+
+typedef struct {
+    const char *encode;                 /* 64 characters */
+    const uint8_t *decode;              /* 256 entries, 0xFF for characters outside the alphabet */
+    char c62;                           /* the two characters that differ between alphabets */
+    char c63;
+} b64_alphabet;
+
+const char __crawdog_base64_alphabet[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+const uint8_t __crawdog_base64_values[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const b64_alphabet _std = { __crawdog_base64_alphabet, __crawdog_base64_values, '+', '/' };
+
+static const char _url_encode[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+static const uint8_t _url_decode[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+static const b64_alphabet _url = { _url_encode, _url_decode, '-', '_' };
+
+/* the alphabet selected by __CRAWDOG_BASE64_URL */
+static const b64_alphabet *alphabet_for(int flags)
+{
+    return (flags & __CRAWDOG_BASE64_URL) ? &_url : &_std;
+}
+
+/* -- vector kernels ------------------------------------------------------------ */
+
+/*
+    Every kernel works on whole blocks and returns the number of input bytes
+    it consumed, leaving the rest to the scalar codec.
+
+    Encoding splits each 3 byte group into four 6 bit indices with one
+    shuffle and two multiplies, then maps indices to characters by adding a
+    per-range offset looked up with a 16 entry shuffle.
+
+    Decoding classifies every character by range (A-Z, a-z, 0-9 and the two
+    alphabet specific characters), which validates and translates a block
+    without memory lookups. A block with an invalid character stops the
+    kernel so that the scalar codec can report the exact offset. Indices are
+    then merged pairwise with multiply-add and compacted with a shuffle.
+*/
+
+#ifdef CRAWDOG_BASE64_HAVE_X86
+
+static int _x86_level = -1;            /* 0 = none, 1 = ssse3, 2 = avx2 */
+
+static int x86_level(void)
+{
+    if (_x86_level < 0)
+    {
+        __builtin_cpu_init();
+        _x86_level = __builtin_cpu_supports("avx2") ? 2 : (__builtin_cpu_supports("ssse3") ? 1 : 0);
+    }
+    return _x86_level;
+}
+
+SSSE3_TARGET static inline __m128i enc_split_128(__m128i in)
+{
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t1, t3);
+}
+
+SSSE3_TARGET static inline __m128i enc_translate_128(__m128i indices, __m128i shift_lut)
+{
+    __m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+    return _mm_add_epi8(_mm_shuffle_epi8(shift_lut, result), indices);
+}
+
+SSSE3_TARGET static size_t encode_ssse3(char *out, const uint8_t *src, size_t len, const b64_alphabet *alphabet)
+{
+    const __m128i shift_lut = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, (char)(alphabet->c62 - 62), (char)(alphabet->c63 - 63), 'A', 0, 0);
+    size_t i = 0;
+    /* 16 bytes are loaded for every 12 that are encoded */
+    while (len - i >= 16)
+    {
+        const __m128i in = _mm_loadu_si128((const __m128i *)(src + i));
+        _mm_storeu_si128((__m128i *)(out + i / 3 * 4), enc_translate_128(enc_split_128(in), shift_lut));
+        i += 12;
+    }
+    return i;
+}
+
+AVX2_TARGET static size_t encode_avx2(char *out, const uint8_t *src, size_t len, const b64_alphabet *alphabet)
+{
+    const __m256i shift_lut = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, (char)(alphabet->c62 - 62), (char)(alphabet->c63 - 63), 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, (char)(alphabet->c62 - 62), (char)(alphabet->c63 - 63), 'A', 0, 0);
+    const __m256i split = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    size_t i = 0;
+    /* each 128 bit lane encodes 12 bytes, the upper lane is loaded from 12 bytes in */
+    while (len - i >= 28)
+    {
+        __m256i in = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(src + i))),
+            _mm_loadu_si128((const __m128i *)(src + i + 12)), 1);
+        in = _mm256_shuffle_epi8(in, split);
+        const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+        const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        const __m256i indices = _mm256_or_si256(t1, t3);
+
+        __m256i result = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        result = _mm256_or_si256(result, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+        result = _mm256_add_epi8(_mm256_shuffle_epi8(shift_lut, result), indices);
+        _mm256_storeu_si256((__m256i *)(out + i / 3 * 4), result);
+        i += 24;
+    }
+    return i;
+}
+
+/* all ones in every lane where (c - lo) is below n, unsigned */
+#define IN_RANGE_128(c, lo, n) \
+    _mm_cmpeq_epi8(_mm_min_epu8(_mm_sub_epi8((c), _mm_set1_epi8(lo)), _mm_set1_epi8((n) - 1)), _mm_sub_epi8((c), _mm_set1_epi8(lo)))
+#define IN_RANGE_256(c, lo, n) \
+    _mm256_cmpeq_epi8(_mm256_min_epu8(_mm256_sub_epi8((c), _mm256_set1_epi8(lo)), _mm256_set1_epi8((n) - 1)), _mm256_sub_epi8((c), _mm256_set1_epi8(lo)))
+
+SSSE3_TARGET static size_t decode_ssse3(uint8_t *out, const char *src, size_t len, const b64_alphabet *alphabet, int constant_time, uint32_t *invalid)
+{
+    const __m128i c62 = _mm_set1_epi8(alphabet->c62);
+    const __m128i c63 = _mm_set1_epi8(alphabet->c63);
+    const __m128i shift62 = _mm_set1_epi8((char)(62 - alphabet->c62));
+    const __m128i shift63 = _mm_set1_epi8((char)(63 - alphabet->c63));
+    const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    __m128i all_valid = _mm_set1_epi8(-1);
+    size_t i = 0;
+    /* 16 bytes are stored for every 12 that are decoded. stopping 4 characters early keeps the extra stores inside the output of the characters that follow */
+    while (len - i >= 20)
+    {
+        const __m128i c = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i upper = IN_RANGE_128(c, 'A', 26);
+        const __m128i lower = IN_RANGE_128(c, 'a', 26);
+        const __m128i digit = IN_RANGE_128(c, '0', 10);
+        const __m128i is62 = _mm_cmpeq_epi8(c, c62);
+        const __m128i is63 = _mm_cmpeq_epi8(c, c63);
+        const __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, _mm_or_si128(is62, is63)));
+        if (!constant_time && _mm_movemask_epi8(valid) != 0xFFFF)
+        {
+            break;
+        }
+        all_valid = _mm_and_si128(all_valid, valid);
+        __m128i shift = _mm_and_si128(upper, _mm_set1_epi8(-65));
+        shift = _mm_or_si128(shift, _mm_and_si128(lower, _mm_set1_epi8(-71)));
+        shift = _mm_or_si128(shift, _mm_and_si128(digit, _mm_set1_epi8(4)));
+        shift = _mm_or_si128(shift, _mm_and_si128(is62, shift62));
+        shift = _mm_or_si128(shift, _mm_and_si128(is63, shift63));
+        const __m128i indices = _mm_add_epi8(c, shift);
+        const __m128i merged = _mm_maddubs_epi16(indices, _mm_set1_epi32(0x01400140));
+        const __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+        _mm_storeu_si128((__m128i *)(out + i / 4 * 3), _mm_shuffle_epi8(packed, pack));
+        i += 16;
+    }
+    *invalid |= (uint32_t)_mm_movemask_epi8(all_valid) ^ 0xFFFFu;
+    return i;
+}
+
+AVX2_TARGET static size_t decode_avx2(uint8_t *out, const char *src, size_t len, const b64_alphabet *alphabet, int constant_time, uint32_t *invalid)
+{
+    const __m256i c62 = _mm256_set1_epi8(alphabet->c62);
+    const __m256i c63 = _mm256_set1_epi8(alphabet->c63);
+    const __m256i shift62 = _mm256_set1_epi8((char)(62 - alphabet->c62));
+    const __m256i shift63 = _mm256_set1_epi8((char)(63 - alphabet->c63));
+    const __m256i pack = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i compact = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+    __m256i all_valid = _mm256_set1_epi8(-1);
+    size_t i = 0;
+    /* 32 bytes are stored for every 24 that are decoded. stopping 8 characters early keeps the extra stores inside the output of the characters that follow */
+    while (len - i >= 40)
+    {
+        const __m256i c = _mm256_loadu_si256((const __m256i *)(src + i));
+        const __m256i upper = IN_RANGE_256(c, 'A', 26);
+        const __m256i lower = IN_RANGE_256(c, 'a', 26);
+        const __m256i digit = IN_RANGE_256(c, '0', 10);
+        const __m256i is62 = _mm256_cmpeq_epi8(c, c62);
+        const __m256i is63 = _mm256_cmpeq_epi8(c, c63);
+        const __m256i valid = _mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, _mm256_or_si256(is62, is63)));
+        if (!constant_time && (uint32_t)_mm256_movemask_epi8(valid) != 0xFFFFFFFFu)
+        {
+            break;
+        }
+        all_valid = _mm256_and_si256(all_valid, valid);
+        __m256i shift = _mm256_and_si256(upper, _mm256_set1_epi8(-65));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(lower, _mm256_set1_epi8(-71)));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(digit, _mm256_set1_epi8(4)));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(is62, shift62));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(is63, shift63));
+        const __m256i indices = _mm256_add_epi8(c, shift);
+        const __m256i merged = _mm256_maddubs_epi16(indices, _mm256_set1_epi32(0x01400140));
+        const __m256i packed = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+        const __m256i lanes = _mm256_shuffle_epi8(packed, pack);
+        _mm256_storeu_si256((__m256i *)(out + i / 4 * 3), _mm256_permutevar8x32_epi32(lanes, compact));
+        i += 32;
+    }
+    *invalid |= (uint32_t)_mm256_movemask_epi8(all_valid) ^ 0xFFFFFFFFu;
+    return i;
+}
+
+static size_t encode_vector(char *out, const uint8_t *src, size_t len, const b64_alphabet *alphabet)
+{
+    switch (x86_level())
+    {
+    case 2: return encode_avx2(out, src, len, alphabet);
+    case 1: return encode_ssse3(out, src, len, alphabet);
+    default: return 0;
+    }
+}
+
+static size_t decode_vector(uint8_t *out, const char *src, size_t len, const b64_alphabet *alphabet, int constant_time, uint32_t *invalid)
+{
+    size_t i = 0;
+    switch (x86_level())
+    {
+    case 2:
+        i = decode_avx2(out, src, len, alphabet, constant_time, invalid);
+        /* the avx2 kernel leaves up to 39 characters, finish whole 16 byte blocks with ssse3 */
+        return i + decode_ssse3(out + i / 4 * 3, src + i, len - i, alphabet, constant_time, invalid);
+    case 1: return decode_ssse3(out, src, len, alphabet, constant_time, invalid);
+    default: return 0;
+    }
+}
+
+#elif defined(CRAWDOG_BASE64_HAVE_NEON)
+
+static size_t encode_vector(char *out, const uint8_t *src, size_t len, const b64_alphabet *alphabet)
+{
+    uint8x16x4_t lut;
+    lut.val[0] = vld1q_u8((const uint8_t *)alphabet->encode);
+    lut.val[1] = vld1q_u8((const uint8_t *)alphabet->encode + 16);
+    lut.val[2] = vld1q_u8((const uint8_t *)alphabet->encode + 32);
+    lut.val[3] = vld1q_u8((const uint8_t *)alphabet->encode + 48);
+    const uint8x16_t mask = vdupq_n_u8(0x3F);
+    size_t i = 0;
+    while (len - i >= 48)
+    {
+        const uint8x16x3_t in = vld3q_u8(src + i);
+        uint8x16x4_t result;
+        result.val[0] = vshrq_n_u8(in.val[0], 2);
+        result.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+        result.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+        result.val[3] = vandq_u8(in.val[2], mask);
+        result.val[0] = vqtbl4q_u8(lut, result.val[0]);
+        result.val[1] = vqtbl4q_u8(lut, result.val[1]);
+        result.val[2] = vqtbl4q_u8(lut, result.val[2]);
+        result.val[3] = vqtbl4q_u8(lut, result.val[3]);
+        vst4q_u8((uint8_t *)out + i / 3 * 4, result);
+        i += 48;
+    }
+    return i;
+}
+
+/* translate one register of characters to indices, clearing *valid for any character outside the alphabet */
+static inline uint8x16_t neon_decode_lane(uint8x16_t c, const b64_alphabet *alphabet, uint8x16_t *valid)
+{
+    const uint8x16_t upper = vcltq_u8(vsubq_u8(c, vdupq_n_u8('A')), vdupq_n_u8(26));
+    const uint8x16_t lower = vcltq_u8(vsubq_u8(c, vdupq_n_u8('a')), vdupq_n_u8(26));
+    const uint8x16_t digit = vcltq_u8(vsubq_u8(c, vdupq_n_u8('0')), vdupq_n_u8(10));
+    const uint8x16_t is62 = vceqq_u8(c, vdupq_n_u8((uint8_t)alphabet->c62));
+    const uint8x16_t is63 = vceqq_u8(c, vdupq_n_u8((uint8_t)alphabet->c63));
+    *valid = vandq_u8(*valid, vorrq_u8(vorrq_u8(upper, lower), vorrq_u8(digit, vorrq_u8(is62, is63))));
+    uint8x16_t shift = vandq_u8(upper, vdupq_n_u8((uint8_t)-65));
+    shift = vorrq_u8(shift, vandq_u8(lower, vdupq_n_u8((uint8_t)-71)));
+    shift = vorrq_u8(shift, vandq_u8(digit, vdupq_n_u8(4)));
+    shift = vorrq_u8(shift, vandq_u8(is62, vdupq_n_u8((uint8_t)(62 - alphabet->c62))));
+    shift = vorrq_u8(shift, vandq_u8(is63, vdupq_n_u8((uint8_t)(63 - alphabet->c63))));
+    return vaddq_u8(c, shift);
+}
+
+static size_t decode_vector(uint8_t *out, const char *src, size_t len, const b64_alphabet *alphabet, int constant_time, uint32_t *invalid)
+{
+    uint8x16_t all_valid = vdupq_n_u8(0xFF);
+    size_t i = 0;
+    while (len - i >= 64)
+    {
+        const uint8x16x4_t c = vld4q_u8((const uint8_t *)src + i);
+        uint8x16_t valid = vdupq_n_u8(0xFF);
+        const uint8x16_t a = neon_decode_lane(c.val[0], alphabet, &valid);
+        const uint8x16_t b = neon_decode_lane(c.val[1], alphabet, &valid);
+        const uint8x16_t d2 = neon_decode_lane(c.val[2], alphabet, &valid);
+        const uint8x16_t d3 = neon_decode_lane(c.val[3], alphabet, &valid);
+        if (!constant_time && vminvq_u8(valid) == 0)
+        {
+            break;
+        }
+        all_valid = vandq_u8(all_valid, valid);
+        uint8x16x3_t result;
+        result.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+        result.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(d2, 2));
+        result.val[2] = vorrq_u8(vshlq_n_u8(d2, 6), d3);
+        vst3q_u8(out + i / 4 * 3, result);
+        i += 64;
+    }
+    *invalid |= (uint32_t)vminvq_u8(all_valid) ^ 0xFFu;
+    return i;
+}
+
+#else
+
+static size_t encode_vector(char *out, const uint8_t *src, size_t len, const b64_alphabet *alphabet)
+{
+    (void)out; (void)src; (void)len; (void)alphabet;
+    return 0;
+}
+
+static size_t decode_vector(uint8_t *out, const char *src, size_t len, const b64_alphabet *alphabet, int constant_time, uint32_t *invalid)
+{
+    (void)out; (void)src; (void)len; (void)alphabet; (void)constant_time; (void)invalid;
+    return 0;
+}
+
+#endif
+
+/* -- scalar codec -------------------------------------------------------------- */
+
+/*
+    The scalar codec maps characters through the alphabet tables. With
+    __CRAWDOG_BASE64_CONSTANT_TIME it computes them instead, with masks
+    built from range comparisons, so that neither the memory accessed nor
+    the branches taken depend on the data. The vector kernels already work
+    that way: their lookups are register shuffles.
+*/
+
+/* all ones when lo <= c <= hi, zero otherwise */
+static inline uint32_t ct_range_mask(uint32_t c, uint32_t lo, uint32_t hi)
+{
+    /* either difference wraps around to set the top bit when c is out of range */
+    return (((c - lo) | (hi - c)) >> 31) - 1;
+}
+
+static inline uint8_t ct_decode_index(uint8_t character, const b64_alphabet *alphabet)
+{
+    const uint32_t c = character;
+    uint32_t m;
+    uint32_t index = 0;
+    uint32_t valid = 0;
+    m = ct_range_mask(c, 'A', 'Z');
+    index |= m & (c - 'A');
+    valid |= m;
+    m = ct_range_mask(c, 'a', 'z');
+    index |= m & (c - 'a' + 26);
+    valid |= m;
+    m = ct_range_mask(c, '0', '9');
+    index |= m & (c - '0' + 52);
+    valid |= m;
+    m = ct_range_mask(c, (uint8_t)alphabet->c62, (uint8_t)alphabet->c62);
+    index |= m & 62;
+    valid |= m;
+    m = ct_range_mask(c, (uint8_t)alphabet->c63, (uint8_t)alphabet->c63);
+    index |= m & 63;
+    valid |= m;
+    /* 0xFF for characters outside the alphabet, like the tables */
+    return (uint8_t)(index | (~valid & 0xFF));
+}
+
+static inline char ct_encode_index(uint32_t index, const b64_alphabet *alphabet)
+{
+    uint32_t c = index + 'A';
+    c += ct_range_mask(index, 26, 63) & ('a' - 26 - 'A');
+    c += ct_range_mask(index, 52, 63) & (uint32_t)('0' - 52 - ('a' - 26));
+    c += ct_range_mask(index, 62, 62) & (uint32_t)((uint8_t)alphabet->c62 - ('0' + 10));
+    c += ct_range_mask(index, 63, 63) & (uint32_t)((uint8_t)alphabet->c63 - ('0' + 11));
+    return (char)c;
+}
+
+static inline uint8_t decode_index(char c, const b64_alphabet *alphabet, int flags)
+{
+    return (flags & __CRAWDOG_BASE64_CONSTANT_TIME) ? ct_decode_index((uint8_t)c, alphabet) : alphabet->decode[(uint8_t)c];
+}
+
+static inline char encode_index(uint32_t index, const b64_alphabet *alphabet, int flags)
+{
+    return (flags & __CRAWDOG_BASE64_CONSTANT_TIME) ? ct_encode_index(index, alphabet) : alphabet->encode[index];
+}
+
+static size_t encode_flags(char *out, const uint8_t *src, size_t len, int flags)
+{
+    const b64_alphabet *alphabet = alphabet_for(flags);
+    const int pad = !(flags & __CRAWDOG_BASE64_NO_PADDING);
+    size_t i = encode_vector(out, src, len, alphabet);
+    char *o = out + i / 3 * 4;
+    for (; len - i >= 3; i += 3)
+    {
+        const uint32_t v = ((uint32_t)src[i] << 16) | ((uint32_t)src[i + 1] << 8) | src[i + 2];
+        o[0] = encode_index(v >> 18, alphabet, flags);
+        o[1] = encode_index((v >> 12) & 0x3F, alphabet, flags);
+        o[2] = encode_index((v >> 6) & 0x3F, alphabet, flags);
+        o[3] = encode_index(v & 0x3F, alphabet, flags);
+        o += 4;
+    }
+    switch (len - i)
+    {
+    case 1:
+        *o++ = encode_index(src[i] >> 2, alphabet, flags);
+        *o++ = encode_index((src[i] & 0x03) << 4, alphabet, flags);
+        if (pad)
+        {
+            *o++ = '=';
+            *o++ = '=';
+        }
+        break;
+    case 2:
+        *o++ = encode_index(src[i] >> 2, alphabet, flags);
+        *o++ = encode_index(((src[i] & 0x03) << 4) | (src[i + 1] >> 4), alphabet, flags);
+        *o++ = encode_index((src[i + 1] & 0x0F) << 2, alphabet, flags);
+        if (pad)
+        {
+            *o++ = '=';
+        }
+        break;
+    default:
+        break;
+    }
+    return (size_t)(o - out);
+}
+
+/* find the first character in [start, end) that stops the decoder and classify it */
+static int locate_error(const char *src, size_t start, size_t end, int flags, size_t *error_offset)
+{
+    const b64_alphabet *alphabet = alphabet_for(flags);
+    for (size_t p = start; p < end; p++)
+    {
+        if (alphabet->decode[(uint8_t)src[p]] == 0xFF)
+        {
+            *error_offset = p;
+            /* a padding character where padding may appear, followed by more input */
+            if (src[p] == '=' && (p & 3) >= 2)
+            {
+                return __CRAWDOG_BASE64_INVALID_PADDING;
+            }
+            return __CRAWDOG_BASE64_INVALID_CHARACTER;
+        }
+    }
+    return __CRAWDOG_BASE64_OK;
+}
+
+/*  decode whole quartets, none of which may contain padding. the vector
+    kernels store whole registers and may write up to two bytes past the
+    decoded length, so they only run over the part of the input for which
+    that still fits in out_room */
+static int decode_body(uint8_t *out, size_t out_room, const char *src, size_t len, int flags, size_t *error_offset)
+{
+    const b64_alphabet *alphabet = alphabet_for(flags);
+    size_t vector_len = len;
+    if (len / 4 * 3 + 2 > out_room)
+    {
+        vector_len = out_room > 2 ? (out_room - 2) / 3 * 4 : 0;
+    }
+    uint32_t invalid = 0;
+    size_t i = decode_vector(out, src, vector_len, alphabet, 0, &invalid);
+    uint8_t *o = out + i / 4 * 3;
+    for (; i < len; i += 4)
+    {
+        const uint8_t a = decode_index(src[i], alphabet, flags);
+        const uint8_t b = decode_index(src[i + 1], alphabet, flags);
+        const uint8_t c = decode_index(src[i + 2], alphabet, flags);
+        const uint8_t d = decode_index(src[i + 3], alphabet, flags);
+        if ((a | b | c | d) & 0x80)
+        {
+            return locate_error(src, i, i + 4, flags, error_offset);
+        }
+        o[0] = (uint8_t)((a << 2) | (b >> 4));
+        o[1] = (uint8_t)((b << 4) | (c >> 2));
+        o[2] = (uint8_t)((c << 6) | d);
+        o += 3;
+    }
+    return __CRAWDOG_BASE64_OK;
+}
+
+/* decode the final quartet, which may end in one or two padding characters. returns the number of bytes written or an error */
+static int decode_final(uint8_t *out, const char *src, size_t offset, int flags, size_t *error_offset)
+{
+    const b64_alphabet *alphabet = alphabet_for(flags);
+    const char *q = src + offset;
+    const uint8_t a = decode_index(q[0], alphabet, flags);
+    const uint8_t b = decode_index(q[1], alphabet, flags);
+    if ((a | b) & 0x80)
+    {
+        return locate_error(src, offset, offset + 2, flags, error_offset);
+    }
+    out[0] = (uint8_t)((a << 2) | (b >> 4));
+    if (q[2] == '=')
+    {
+        if (q[3] != '=')
+        {
+            *error_offset = offset + 2;
+            return __CRAWDOG_BASE64_INVALID_CHARACTER;
+        }
+        return 1;
+    }
+    const uint8_t c = decode_index(q[2], alphabet, flags);
+    if (c & 0x80)
+    {
+        *error_offset = offset + 2;
+        return __CRAWDOG_BASE64_INVALID_CHARACTER;
+    }
+    out[1] = (uint8_t)((b << 4) | (c >> 2));
+    if (q[3] == '=')
+    {
+        return 2;
+    }
+    const uint8_t d = decode_index(q[3], alphabet, flags);
+    if (d & 0x80)
+    {
+        *error_offset = offset + 3;
+        return __CRAWDOG_BASE64_INVALID_CHARACTER;
+    }
+    out[2] = (uint8_t)((c << 6) | d);
+    return 3;
+}
+
+/* decode the two or three characters that end unpadded input. returns the number of bytes written or an error */
+static int decode_unpadded_tail(uint8_t *out, const char *src, size_t offset, size_t count, int flags, size_t *error_offset)
+{
+    const b64_alphabet *alphabet = alphabet_for(flags);
+    const char *q = src + offset;
+    if (count == 1)
+    {
+        int ret = locate_error(src, offset, offset + 1, flags, error_offset);
+        if (ret == __CRAWDOG_BASE64_OK)
+        {
+            *error_offset = offset + 1;
+            ret = __CRAWDOG_BASE64_INVALID_LENGTH;
+        }
+        return ret;
+    }
+    const uint8_t a = decode_index(q[0], alphabet, flags);
+    const uint8_t b = decode_index(q[1], alphabet, flags);
+    const uint8_t c = count == 3 ? decode_index(q[2], alphabet, flags) : 0;
+    if ((a | b | c) & 0x80)
+    {
+        return locate_error(src, offset, offset + count, flags, error_offset);
+    }
+    out[0] = (uint8_t)((a << 2) | (b >> 4));
+    if (count == 3)
+    {
+        out[1] = (uint8_t)((b << 4) | (c >> 2));
+    }
+    return (int)count - 1;
+}
+
+/*  decode without an early exit: the vector kernels run over invalid blocks, every
+    character goes through the same arithmetic, and invalid characters and misplaced
+    padding are accumulated until the whole input is decoded. only the length and the
+    number of padding characters, which the decoded length reveals anyway, decide the
+    branches taken. rejected input zeroes the output and is not located */
+static int decode_constant_time(uint8_t *out, size_t *out_len, const char *src, size_t len, int flags, size_t *error_offset)
+{
+    const b64_alphabet *alphabet = alphabet_for(flags);
+    const size_t partial = len & 3;
+    const int padding = !(flags & __CRAWDOG_BASE64_NO_PADDING);
+    if (padding ? partial != 0 : partial == 1)
+    {
+        *error_offset = len;
+        return __CRAWDOG_BASE64_INVALID_LENGTH;
+    }
+    /* with padding, the last whole quartet is decoded on its own */
+    const size_t body = padding ? len - 4 : len - partial;
+    const size_t room = __crawdog_base64_decoded_length(len);
+    size_t vector_len = body;
+    if (body / 4 * 3 + 2 > room)
+    {
+        vector_len = room > 2 ? (room - 2) / 3 * 4 : 0;
+    }
+    uint32_t invalid = 0;
+    size_t i = decode_vector(out, src, vector_len, alphabet, 1, &invalid);
+    uint8_t *o = out + i / 4 * 3;
+    for (; i < body; i += 4)
+    {
+        const uint8_t a = ct_decode_index((uint8_t)src[i], alphabet);
+        const uint8_t b = ct_decode_index((uint8_t)src[i + 1], alphabet);
+        const uint8_t c = ct_decode_index((uint8_t)src[i + 2], alphabet);
+        const uint8_t d = ct_decode_index((uint8_t)src[i + 3], alphabet);
+        invalid |= (a | b | c | d) & 0x80;
+        o[0] = (uint8_t)((a << 2) | (b >> 4));
+        o[1] = (uint8_t)((b << 4) | (c >> 2));
+        o[2] = (uint8_t)((c << 6) | d);
+        o += 3;
+    }
+    size_t tail = 0;
+    if (padding)
+    {
+        /* '=' may end the quartet, or fill its last two places */
+        const uint32_t pad3 = ct_range_mask((uint8_t)src[i + 3], '=', '=');
+        const uint32_t pad2 = ct_range_mask((uint8_t)src[i + 2], '=', '=') & pad3;
+        const uint8_t a = ct_decode_index((uint8_t)src[i], alphabet);
+        const uint8_t b = ct_decode_index((uint8_t)src[i + 1], alphabet);
+        const uint8_t c = ct_decode_index((uint8_t)src[i + 2], alphabet) & (uint8_t)~pad2;
+        const uint8_t d = ct_decode_index((uint8_t)src[i + 3], alphabet) & (uint8_t)~pad3;
+        invalid |= (a | b | c | d) & 0x80;
+        o[0] = (uint8_t)((a << 2) | (b >> 4));
+        o[1] = (uint8_t)((b << 4) | (c >> 2));
+        o[2] = (uint8_t)((c << 6) | d);
+        tail = 3 - (pad3 & 1) - (pad2 & 1);
+    }
+    else if (partial > 0)
+    {
+        const uint8_t a = ct_decode_index((uint8_t)src[i], alphabet);
+        const uint8_t b = ct_decode_index((uint8_t)src[i + 1], alphabet);
+        const uint8_t c = partial == 3 ? ct_decode_index((uint8_t)src[i + 2], alphabet) : 0;
+        invalid |= (a | b | c) & 0x80;
+        o[0] = (uint8_t)((a << 2) | (b >> 4));
+        if (partial == 3)
+        {
+            o[1] = (uint8_t)((b << 4) | (c >> 2));
+        }
+        tail = partial - 1;
+    }
+    if (invalid == 0)
+    {
+        *out_len = body / 4 * 3 + tail;
+        return __CRAWDOG_BASE64_OK;
+    }
+    for (i = 0; i < room; i++)
+    {
+        ((volatile uint8_t *)out)[i] = 0;
+    }
+    *error_offset = len;
+    return __CRAWDOG_BASE64_INVALID_CHARACTER;
+}
+
+static int decode_flags(uint8_t *out, size_t *out_len, const char *src, size_t len, int flags, size_t *error_offset)
+{
+    *out_len = 0;
+    if (len == 0)
+    {
+        return __CRAWDOG_BASE64_OK;
+    }
+    if (flags & __CRAWDOG_BASE64_CONSTANT_TIME)
+    {
+        return decode_constant_time(out, out_len, src, len, flags, error_offset);
+    }
+    const size_t partial = len & 3;
+    if (flags & __CRAWDOG_BASE64_NO_PADDING)
+    {
+        /* every whole quartet is body, and padding fails wherever it appears */
+        const size_t body = len - partial;
+        int ret = decode_body(out, __crawdog_base64_decoded_length(len), src, body, flags, error_offset);
+        if (ret != __CRAWDOG_BASE64_OK)
+        {
+            return ret;
+        }
+        if (partial)
+        {
+            ret = decode_unpadded_tail(out + body / 4 * 3, src, body, partial, flags, error_offset);
+            if (ret < 0)
+            {
+                return ret;
+            }
+        }
+        *out_len = body / 4 * 3 + (size_t)ret;
+        return __CRAWDOG_BASE64_OK;
+    }
+    /* the body excludes the last whole quartet, which is the only one that may be padded */
+    const size_t body = partial ? len - partial : len - 4;
+    int ret = decode_body(out, body / 4 * 3 + 3, src, body, flags, error_offset);
+    if (ret != __CRAWDOG_BASE64_OK)
+    {
+        return ret;
+    }
+    if (partial)
+    {
+        ret = locate_error(src, body, len, flags, error_offset);
+        if (ret == __CRAWDOG_BASE64_OK)
+        {
+            *error_offset = len;
+            ret = __CRAWDOG_BASE64_INVALID_LENGTH;
+        }
+        return ret;
+    }
+    ret = decode_final(out + body / 4 * 3, src, body, flags, error_offset);
+    if (ret < 0)
+    {
+        return ret;
+    }
+    *out_len = body / 4 * 3 + (size_t)ret;
+    return __CRAWDOG_BASE64_OK;
+}
+
+/* -- streaming codec -------------------------------------------------------------- */
+
+/* encode one group of up to three bytes, preceded by a line break when the current line is full. returns 0 when it does not fit */
+static int stream_encode_group(__crawdog_base64_stream *state, char *out, size_t out_cap, size_t *o, const uint8_t *group, size_t len)
+{
+    const int line_break = state->line_length != 0 && state->column == state->line_length;
+    if (out_cap - *o < (line_break ? 6u : 4u))
+    {
+        return 0;
+    }
+    if (line_break)
+    {
+        out[(*o)++] = '\r';
+        out[(*o)++] = '\n';
+        state->column = 0;
+    }
+    const size_t written = encode_flags(out + *o, group, len, state->flags);
+    *o += written;
+    state->column += written;
+    return 1;
+}
+
+static size_t stream_encode(__crawdog_base64_stream *state, char *out, size_t out_cap, size_t *written, const uint8_t *src, size_t len)
+{
+    size_t i = 0;
+    size_t o = 0;
+    /* complete the group carried over from the previous call */
+    if (state->carry_len > 0)
+    {
+        while (state->carry_len < 3 && i < len)
+        {
+            state->carry[state->carry_len++] = src[i++];
+        }
+        if (state->carry_len < 3 || !stream_encode_group(state, out, out_cap, &o, state->carry, 3))
+        {
+            state->offset += i;
+            *written = o;
+            return i;
+        }
+        state->carry_len = 0;
+    }
+    /* whole groups go through the bulk encoder, one line at a time */
+    while (len - i >= 3)
+    {
+        size_t groups = (len - i) / 3;
+        if (state->line_length != 0)
+        {
+            if (state->column == state->line_length)
+            {
+                if (out_cap - o < 2)
+                {
+                    break;
+                }
+                out[o++] = '\r';
+                out[o++] = '\n';
+                state->column = 0;
+            }
+            const size_t line_groups = (state->line_length - state->column) / 4;
+            groups = groups < line_groups ? groups : line_groups;
+        }
+        const size_t room = (out_cap - o) / 4;
+        groups = groups < room ? groups : room;
+        if (groups == 0)
+        {
+            break;
+        }
+        o += encode_flags(out + o, src + i, groups * 3, state->flags);
+        i += groups * 3;
+        state->column += groups * 4;
+    }
+    /* keep the bytes of an incomplete group for the next call */
+    if (len - i < 3)
+    {
+        while (i < len)
+        {
+            state->carry[state->carry_len++] = src[i++];
+        }
+    }
+    state->offset += i;
+    *written = o;
+    return i;
+}
+
+/* decode the carried quartet into out. returns the number of bytes written or an error with a stream offset */
+static int stream_decode_carry(__crawdog_base64_stream *state, uint8_t *out, size_t *error_offset)
+{
+    const char *quartet = (const char *)state->carry;
+    size_t index = 0;
+    int ret;
+    if (quartet[2] == '=' || quartet[3] == '=')
+    {
+        if (state->flags & __CRAWDOG_BASE64_NO_PADDING)
+        {
+            ret = locate_error(quartet, 0, 4, state->flags, &index);
+        }
+        else
+        {
+            ret = decode_final(out, quartet, 0, state->flags, &index);
+            state->finished = ret > 0;
+        }
+    }
+    else
+    {
+        ret = decode_body(out, 3, quartet, 4, state->flags, &index);
+        ret = ret == __CRAWDOG_BASE64_OK ? 3 : ret;
+    }
+    if (ret < 0)
+    {
+        *error_offset = state->carry_offset[index];
+        state->error_character = state->carry[index];
+    }
+    state->carry_len = 0;
+    return ret;
+}
+
+static int stream_decode(__crawdog_base64_stream *state, uint8_t *out, size_t out_cap, size_t *written, const char *src, size_t len, size_t *consumed, size_t *error_offset)
+{
+    const int ignore_line_breaks = state->flags & __CRAWDOG_BASE64_IGNORE_LINE_BREAKS;
+    /* without padding every whole quartet of a run is body, and padding fails wherever it appears */
+    const int padding = !(state->flags & __CRAWDOG_BASE64_NO_PADDING);
+    size_t i = 0;
+    size_t o = 0;
+    int ret = __CRAWDOG_BASE64_OK;
+    /* the next line break at or after i, found with memchr and reused until i passes it */
+    const char *next_cr = NULL;
+    const char *next_lf = NULL;
+    size_t break_at = 0;
+    while (i < len)
+    {
+        const char c = src[i];
+        if (ignore_line_breaks && (c == '\r' || c == '\n'))
+        {
+            i++;
+            continue;
+        }
+        if (state->finished)
+        {
+            *error_offset = state->offset + i;
+            state->error_character = (uint8_t)c;
+            ret = __CRAWDOG_BASE64_INVALID_PADDING;
+            break;
+        }
+        if (state->carry_len == 0)
+        {
+            size_t run = len - i;
+            if (ignore_line_breaks)
+            {
+                if (break_at <= i)
+                {
+                    if (next_cr == NULL || next_cr < src + i)
+                    {
+                        next_cr = memchr(src + i, '\r', len - i);
+                        next_cr = next_cr ? next_cr : src + len;
+                    }
+                    if (next_lf == NULL || next_lf < src + i)
+                    {
+                        next_lf = memchr(src + i, '\n', len - i);
+                        next_lf = next_lf ? next_lf : src + len;
+                    }
+                    break_at = (size_t)((next_cr < next_lf ? next_cr : next_lf) - src);
+                }
+                run = break_at - i;
+            }
+            const size_t quartets = run / 4;
+            if (quartets > 0)
+            {
+                /* only the last quartet of a run may be padded */
+                const int padded = padding && (src[i + quartets * 4 - 2] == '=' || src[i + quartets * 4 - 1] == '=');
+                size_t body = quartets - (size_t)padded;
+                const size_t room = (out_cap - o) / 3;
+                body = body < room ? body : room;
+                if (body > 0)
+                {
+                    ret = decode_body(out + o, out_cap - o, src + i, body * 4, state->flags, error_offset);
+                    if (ret != __CRAWDOG_BASE64_OK)
+                    {
+                        state->error_character = (uint8_t)src[i + *error_offset];
+                        *error_offset += state->offset + i;
+                        break;
+                    }
+                    o += body * 3;
+                    i += body * 4;
+                    continue;
+                }
+                if (quartets > 1 || !padded || out_cap - o < 2)
+                {
+                    break;
+                }
+                ret = decode_final(out + o, src, i, state->flags, error_offset);
+                if (ret < 0)
+                {
+                    state->error_character = (uint8_t)src[*error_offset];
+                    *error_offset += state->offset;
+                    break;
+                }
+                o += (size_t)ret;
+                i += 4;
+                state->finished = 1;
+                ret = __CRAWDOG_BASE64_OK;
+                continue;
+            }
+        }
+        /* a quartet split across calls or lines is collected one character at a time */
+        if (state->carry_len == 3)
+        {
+            /* the last character decides how many bytes the quartet decodes to */
+            const size_t needed = state->carry[2] == '=' ? 1 : (c == '=' ? 2 : 3);
+            if (out_cap - o < needed)
+            {
+                break;
+            }
+        }
+        state->carry[state->carry_len] = (uint8_t)c;
+        state->carry_offset[state->carry_len] = state->offset + i;
+        state->carry_len++;
+        i++;
+        if (state->carry_len == 4)
+        {
+            ret = stream_decode_carry(state, out + o, error_offset);
+            if (ret < 0)
+            {
+                break;
+            }
+            o += (size_t)ret;
+            ret = __CRAWDOG_BASE64_OK;
+        }
+    }
+    state->offset += i;
+    *written = o;
+    *consumed = i;
+    return ret;
+}
+
+/* -- public interface ------------------------------------------------------------ */
+
+size_t __crawdog_base64_encoded_length(size_t len, int flags)
+{
+    if (flags & __CRAWDOG_BASE64_NO_PADDING)
+    {
+        return len / 3 * 4 + (len % 3 ? len % 3 + 1 : 0);
+    }
+    return (len + 2) / 3 * 4;
+}
+
+size_t __crawdog_base64_decoded_length(size_t len)
+{
+    return (len + 3) / 4 * 3;
+}
+
+size_t __crawdog_base64_encode(char *out, const uint8_t *src, size_t len, int flags)
+{
+    return encode_flags(out, src, len, flags);
+}
+
+int __crawdog_base64_decode(uint8_t *out, size_t *out_len, const char *src, size_t len, int flags, size_t *error_offset)
+{
+    return decode_flags(out, out_len, src, len, flags, error_offset);
+}
+
+void __crawdog_base64_encode_stream_init(__crawdog_base64_stream *state, size_t line_length, int flags)
+{
+    memset(state, 0, sizeof(*state));
+    state->line_length = line_length / 4 * 4;
+    state->flags = flags;
+}
+
+size_t __crawdog_base64_encode_stream_update(__crawdog_base64_stream *state, char *out, size_t out_cap, size_t *written, const uint8_t *src, size_t len)
+{
+    return stream_encode(state, out, out_cap, written, src, len);
+}
+
+size_t __crawdog_base64_encode_stream_final(__crawdog_base64_stream *state, char *out)
+{
+    size_t o = 0;
+    if (state->carry_len > 0)
+    {
+        stream_encode_group(state, out, __CRAWDOG_BASE64_STREAM_FINAL_LENGTH, &o, state->carry, state->carry_len);
+        state->carry_len = 0;
+    }
+    return o;
+}
+
+void __crawdog_base64_decode_stream_init(__crawdog_base64_stream *state, int flags)
+{
+    memset(state, 0, sizeof(*state));
+    state->flags = flags;
+}
+
+int __crawdog_base64_decode_stream_update(__crawdog_base64_stream *state, uint8_t *out, size_t out_cap, size_t *written, const char *src, size_t len, size_t *consumed, size_t *error_offset)
+{
+    return stream_decode(state, out, out_cap, written, src, len, consumed, error_offset);
+}
+
+int __crawdog_base64_decode_stream_final(__crawdog_base64_stream *state, uint8_t *out, size_t *written, size_t *error_offset)
+{
+    *written = 0;
+    if (state->carry_len == 0)
+    {
+        return __CRAWDOG_BASE64_OK;
+    }
+    size_t index = 0;
+    int ret;
+    if (state->flags & __CRAWDOG_BASE64_NO_PADDING)
+    {
+        ret = decode_unpadded_tail(out, (const char *)state->carry, 0, state->carry_len, state->flags, &index);
+        if (ret >= 0)
+        {
+            *written = (size_t)ret;
+            state->carry_len = 0;
+            return __CRAWDOG_BASE64_OK;
+        }
+    }
+    else
+    {
+        ret = locate_error((const char *)state->carry, 0, state->carry_len, state->flags, &index);
+        if (ret == __CRAWDOG_BASE64_OK)
+        {
+            index = state->carry_len;
+            ret = __CRAWDOG_BASE64_INVALID_LENGTH;
+        }
+    }
+    if (ret == __CRAWDOG_BASE64_INVALID_LENGTH)
+    {
+        *error_offset = state->offset;
+        return ret;
+    }
+    *error_offset = state->carry_offset[index];
+    state->error_character = state->carry[index];
+    return ret;
+}
@@ -0,0 +1,173 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+#ifndef __CRAWDOG_BASE64_H
+#define __CRAWDOG_BASE64_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+    Bulk base64 (RFC 4648) codec.
+
+    Contiguous buffers are encoded and decoded 12, 24 or 48 bytes at a time
+    with SSSE3 or AVX2 (selected at runtime on x86-64) or NEON (aarch64),
+    following the vectorized algorithms of Muła & Lemire (arXiv:1704.00605).
+    Everything else, and the tail of every buffer, goes through a table
+    driven scalar codec. Decoding is strict: every character must be in the
+    alphabet, the length must be a multiple of four and '=' may only appear
+    as one or two padding characters at the very end.
+
+    Every function takes a combination of the flags below. Without padding
+    the encoder omits the trailing '=' characters and the decoder rejects
+    them, accepting any length other than one more than a multiple of four.
+
+    With __CRAWDOG_BASE64_CONSTANT_TIME the contiguous decoder has no early
+    exit. Invalid characters and misplaced padding are accumulated until the
+    whole input is decoded, rejected input zeroes the output, and the
+    offending character is not located. The streaming decoder only maps
+    characters without tables in this mode, it still stops at the first
+    invalid quartet.
+*/
+
+#define __CRAWDOG_BASE64_OK                     0
+#define __CRAWDOG_BASE64_INVALID_CHARACTER      -1  /* error_offset is the offending character, or len in constant time */
+#define __CRAWDOG_BASE64_INVALID_PADDING        -2  /* padding before the end of the input */
+#define __CRAWDOG_BASE64_INVALID_LENGTH         -3  /* the input ends in an incomplete quartet */
+
+#define __CRAWDOG_BASE64_URL                    0x1 /* the URL and filename safe alphabet of RFC 4648 section 5: '-' and '_' */
+#define __CRAWDOG_BASE64_NO_PADDING             0x2 /* omit padding when encoding, reject it when decoding */
+#define __CRAWDOG_BASE64_CONSTANT_TIME          0x4 /* no table lookups or branches that depend on the data, for secret material */
+#define __CRAWDOG_BASE64_IGNORE_LINE_BREAKS     0x8 /* stream decoding only: skip CR and LF */
+
+/*  The standard alphabet, and the 6 bit value of every character in it (0xFF for every other character)
+    Constant data, so that single characters convert without any table being built at run time
+*/
+extern const char __crawdog_base64_alphabet[64];
+extern const uint8_t __crawdog_base64_values[256];
+
+/* Return the character of the standard alphabet for the low 6 bits of value */
+static inline char __crawdog_base64_character(uint8_t value)
+{
+    return __crawdog_base64_alphabet[value & 0x3F];
+}
+
+/* Return the 6 bit value of a character of the standard alphabet, or 0xFF */
+static inline uint8_t __crawdog_base64_value(uint8_t character)
+{
+    return __crawdog_base64_values[character];
+}
+
+/* Return the number of characters needed to encode len bytes */
+size_t __crawdog_base64_encoded_length(size_t len, int flags);
+
+/* Return the largest number of bytes that len encoded characters can decode to */
+size_t __crawdog_base64_decoded_length(size_t len);
+
+/*  Encode len bytes into __crawdog_base64_encoded_length(len) characters
+    Returns the number of characters written
+*/
+size_t __crawdog_base64_encode(
+    char *out,                          /* OUT:[encoded length] characters */
+    const uint8_t *src,                 /* IN: [len] bytes to encode */
+    size_t len,
+    int flags);
+
+/*  Decode len characters
+    Returns __CRAWDOG_BASE64_OK and the number of bytes written in out_len, or one of the error codes
+*/
+int __crawdog_base64_decode(
+    uint8_t *out,                       /* OUT:[decoded length] bytes */
+    size_t *out_len,                    /* OUT: number of bytes written */
+    const char *src,                    /* IN: [len] characters to decode */
+    size_t len,
+    int flags,
+    size_t *error_offset);              /* OUT: offset of the offending character on error, len in constant time */
+
+/*
+    Streaming codec.
+
+    A stream state carries the zero to three bytes (encoding) or characters
+    (decoding) of a group that straddles two calls, so input can be fed in
+    chunks of any size and drained into output buffers of any size with
+    constant memory. Every update consumes as much input as it can write
+    output for and reports both counts; input that was not consumed is fed
+    again after the output has been drained. Whole groups still go through
+    the bulk codec.
+
+    The encoder can break lines with CRLF every line_length characters (64
+    for PEM, 76 for MIME). The decoder can skip CR and LF anywhere in the
+    input and is otherwise as strict as the contiguous decoder.
+*/
+
+/* the most characters that __crawdog_base64_encode_stream_final writes */
+#define __CRAWDOG_BASE64_STREAM_FINAL_LENGTH    6
+
+typedef struct {
+    uint8_t carry[4];                   /* the bytes or characters of an incomplete group */
+    size_t carry_len;
+    size_t carry_offset[4];             /* decoding: the stream offset of each carried character */
+    size_t offset;                      /* the number of bytes or characters consumed so far */
+    size_t line_length;                 /* encoding: characters per line, 0 for a single line */
+    size_t column;                      /* encoding: characters written to the current line */
+    int flags;
+    int finished;                       /* decoding: the padded final quartet has been read */
+    uint8_t error_character;            /* decoding: the offending character of the last error */
+} __crawdog_base64_stream;
+
+/* Begin encoding. line_length is rounded down to a multiple of four, 0 disables line breaks */
+void __crawdog_base64_encode_stream_init(
+    __crawdog_base64_stream *state,     /* OUT: stream state */
+    size_t line_length,
+    int flags);
+
+/*  Encode as much of src as fits in out. An output buffer of at least
+    six characters always makes progress.
+    Returns the number of bytes consumed from src
+*/
+size_t __crawdog_base64_encode_stream_update(
+    __crawdog_base64_stream *state,     /* IN/OUT: stream state */
+    char *out,                          /* OUT:[out_cap] characters */
+    size_t out_cap,
+    size_t *written,                    /* OUT: number of characters written */
+    const uint8_t *src,                 /* IN: [len] bytes to encode */
+    size_t len);
+
+/*  Encode the carried bytes. Every byte must have been consumed.
+    Returns the number of characters written
+*/
+size_t __crawdog_base64_encode_stream_final(
+    __crawdog_base64_stream *state,     /* IN/OUT: stream state */
+    char *out);                         /* OUT:[__CRAWDOG_BASE64_STREAM_FINAL_LENGTH] characters */
+
+/* Begin decoding. CR and LF are rejected unless flags include __CRAWDOG_BASE64_IGNORE_LINE_BREAKS */
+void __crawdog_base64_decode_stream_init(
+    __crawdog_base64_stream *state,     /* OUT: stream state */
+    int flags);
+
+/*  Decode as much of src as fits in out. An output buffer of at least
+    three bytes always makes progress.
+    Returns __CRAWDOG_BASE64_OK or one of the error codes, with the stream
+    offset of the offending character in error_offset and the character in
+    state->error_character
+*/
+int __crawdog_base64_decode_stream_update(
+    __crawdog_base64_stream *state,     /* IN/OUT: stream state */
+    uint8_t *out,                       /* OUT:[out_cap] bytes */
+    size_t out_cap,
+    size_t *written,                    /* OUT: number of bytes written */
+    const char *src,                    /* IN: [len] characters to decode */
+    size_t len,
+    size_t *consumed,                   /* OUT: number of characters consumed from src */
+    size_t *error_offset);              /* OUT: stream offset of the offending character on error */
+
+/*  End decoding, writing the bytes of an unpadded final quartet. Every
+    character must have been consumed.
+    Returns __CRAWDOG_BASE64_OK, or an error when the input ends inside a quartet
+*/
+int __crawdog_base64_decode_stream_final(
+    __crawdog_base64_stream *state,     /* IN/OUT: stream state */
+    uint8_t *out,                       /* OUT:[2] bytes */
+    size_t *written,                    /* OUT: number of bytes written */
+    size_t *error_offset);              /* OUT: stream offset of the offending character on error */
+
+#endif // __CRAWDOG_BASE64_H
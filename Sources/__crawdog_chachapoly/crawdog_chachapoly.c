@@ -8,6 +8,7 @@
 
 #include "crawdog_chachapoly.h"
 #include "crawdog_endianness.h"
+#include "__craw.h"
 
 #define U8V(x) ((unsigned char)(x))
 
@@ -44,31 +45,6 @@
     (p)[7] = U8V((v) >> 56 ); \
   } while (0)
 
-/**
- * Constant-time memory compare. This should help to protect against
- * side-channel attacks.
- *
- * \param av input 1
- * \param bv input 2
- * \param n bytes to compare
- * \return 0 if inputs are equal
- */
-static int memcmp_eq(const void *av, const void *bv, int n)
-{
-    const unsigned char *a = (const unsigned char*) av;
-    const unsigned char *b = (const unsigned char*) bv;
-    unsigned char res = 0;
-    int i;
-
-    for (i = 0; i < n; i++) {
-        res |= *a ^ *b;
-        a++;
-        b++;
-    }
-
-    return res;
-}
-
 /**
  * Poly1305 tag generation. This concatenates a string according to the rules
  * outlined in RFC 7539 and calculates the tag.
@@ -116,6 +92,100 @@ static void poly1305_get_tag(unsigned char *poly_key, const void *ad,
     __crawdog_poly1305_finish(&poly, tag);
 }
 
+/**
+ * Feed a chain of fragments to poly1305 followed by the padding to the next
+ * 16 byte boundary.
+ *
+ * \return the total length of the fragments in bytes
+ */
+static uint64_t poly1305_update_padded_vectors(struct __crawdog_poly1305_context *poly,
+        const struct iovec *iov, size_t count)
+{
+    const unsigned char pad[16] = { 0 };
+    uint64_t len = 0;
+    unsigned left_over;
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        __crawdog_poly1305_update(poly, (const unsigned char *)iov[i].iov_base, iov[i].iov_len);
+        len += iov[i].iov_len;
+    }
+    left_over = (unsigned)(len % 16);
+    if (left_over)
+        __crawdog_poly1305_update(poly, pad, 16 - left_over);
+    return len;
+}
+
+/**
+ * Poly1305 tag generation over fragmented associated data and ciphertext.
+ * Produces the same tag as poly1305_get_tag over the concatenated inputs.
+ */
+static void poly1305_get_tag_vectors(unsigned char *poly_key, const struct iovec *ad,
+        size_t ad_count, const struct iovec *ct, size_t ct_count, unsigned char *tag)
+{
+    struct __crawdog_poly1305_context poly;
+    unsigned char len_bytes[8];
+    uint64_t len;
+
+    __crawdog_poly1305_init(&poly, poly_key);
+
+    len = poly1305_update_padded_vectors(&poly, ad, ad_count);
+    U64TO8_LITTLE(len_bytes, len);
+
+    len = poly1305_update_padded_vectors(&poly, ct, ct_count);
+    __crawdog_poly1305_update(&poly, len_bytes, 8);
+    U64TO8_LITTLE(len_bytes, len);
+    __crawdog_poly1305_update(&poly, len_bytes, 8);
+
+    __crawdog_poly1305_finish(&poly, tag);
+}
+
+/**
+ * ChaCha20 over a chain of fragments into a contiguous output. Whole blocks
+ * are processed straight out of each fragment; a block that straddles two
+ * fragments is served from a saved keystream block.
+ */
+static void chacha_crypt_vectors(struct chacha_ctx *ctx, const struct iovec *iov,
+        size_t count, unsigned char *out)
+{
+    unsigned char keystream[__CRAWDOG_CHACHA_BLOCKLEN];
+    size_t used = __CRAWDOG_CHACHA_BLOCKLEN;
+    const unsigned char *m;
+    size_t len, full, step, i;
+
+    for (i = 0; i < count; i++) {
+        m = (const unsigned char *)iov[i].iov_base;
+        len = iov[i].iov_len;
+
+        /* finish a block started by the previous fragment */
+        while (len > 0 && used < __CRAWDOG_CHACHA_BLOCKLEN) {
+            *out++ = *m++ ^ keystream[used++];
+            len--;
+        }
+
+        /* whole blocks */
+        full = len - (len % __CRAWDOG_CHACHA_BLOCKLEN);
+        while (full > 0) {
+            step = full > 0x40000000 ? 0x40000000 : full;
+            __crawdog_chacha_encrypt_bytes(ctx, m, out, (uint32_t)step);
+            m += step;
+            out += step;
+            len -= step;
+            full -= step;
+        }
+
+        /* a partial block keeps the rest of its keystream for the next fragment */
+        if (len > 0) {
+            memset(keystream, 0, sizeof(keystream));
+            __crawdog_chacha_encrypt_bytes(ctx, keystream, keystream, sizeof(keystream));
+            for (used = 0; used < len; used++)
+                out[used] = m[used] ^ keystream[used];
+            out += len;
+        }
+    }
+    memset(keystream, 0, sizeof(keystream));
+}
+
 int __crawdog_chachapoly_init(struct __crawdog_chachapoly_ctx *ctx, const void *key, int key_len)
 {
     assert(key_len == 16 || key_len == 32);
@@ -141,7 +211,7 @@ int __crawdog_chachapoly_crypt(struct __crawdog_chachapoly_ctx *ctx, const void
     /* check tag if decrypting */
     if (encrypt == 0 && tag_len) {
         poly1305_get_tag(poly_key, ad, ad_len, input, input_len, calc_tag);
-        if (memcmp_eq(calc_tag, tag, tag_len) != 0) {
+        if (!__craw_equals_constant_time(calc_tag, tag, (size_t)tag_len)) {
             return __CRAWDOG_CHACHAPOLY_INVALID_MAC;
         }
     }
@@ -158,4 +228,44 @@ int __crawdog_chachapoly_crypt(struct __crawdog_chachapoly_ctx *ctx, const void
     }
 
     return __CRAWDOG_CHACHAPOLY_OK;
-}
\ No newline at end of file
+}
+
+int __crawdog_chachapoly_cryptv(struct __crawdog_chachapoly_ctx *ctx, const void *nonce,
+        const struct iovec *ad, size_t ad_count, const struct iovec *input, size_t input_count,
+        void *output, void *tag, int tag_len, int encrypt)
+{
+    unsigned char poly_key[__CRAWDOG_CHACHA_BLOCKLEN];
+    unsigned char calc_tag[__CRAWDOG_POLY1305_TAGLEN];
+    const unsigned char one[4] = { 1, 0, 0, 0 };
+    struct iovec ct;
+    size_t i;
+
+    /* initialize keystream and generate poly1305 key */
+    memset(poly_key, 0, sizeof(poly_key));
+    __crawdog_chacha_ivsetup(&ctx->cha_ctx, nonce, NULL);
+    __crawdog_chacha_encrypt_bytes(&ctx->cha_ctx, poly_key, poly_key, sizeof(poly_key));
+
+    /* check tag if decrypting, the ciphertext is the input chain */
+    if (encrypt == 0 && tag_len) {
+        poly1305_get_tag_vectors(poly_key, ad, ad_count, input, input_count, calc_tag);
+        if (!__craw_equals_constant_time(calc_tag, tag, (size_t)tag_len)) {
+            return __CRAWDOG_CHACHAPOLY_INVALID_MAC;
+        }
+    }
+
+    /* crypt data */
+    __crawdog_chacha_ivsetup(&ctx->cha_ctx, nonce, one);
+    chacha_crypt_vectors(&ctx->cha_ctx, input, input_count, (unsigned char *)output);
+
+    /* add tag if encrypting, the ciphertext is the contiguous output */
+    if (encrypt && tag_len) {
+        ct.iov_base = output;
+        ct.iov_len = 0;
+        for (i = 0; i < input_count; i++)
+            ct.iov_len += input[i].iov_len;
+        poly1305_get_tag_vectors(poly_key, ad, ad_count, &ct, 1, calc_tag);
+        memcpy(tag, calc_tag, tag_len);
+    }
+
+    return __CRAWDOG_CHACHAPOLY_OK;
+}
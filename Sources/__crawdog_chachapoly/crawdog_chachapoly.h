@@ -7,6 +7,7 @@
 
 #include "crawdog_chacha.h"
 #include "crawdog_poly1305.h"
+#include <sys/uio.h>
 
 #define __CRAWDOG_CHACHAPOLY_OK           0
 #define __CRAWDOG_CHACHAPOLY_INVALID_MAC  -1
@@ -48,4 +49,28 @@ int __crawdog_chachapoly_crypt(struct __crawdog_chachapoly_ctx *ctx, const void
         const void *ad, int ad_len, const void *input, int input_len,
         void *output, void *tag, int tag_len, int encrypt);
 
+/**
+ * Encrypt or decrypt a chain of input fragments with ChaCha20-Poly1305 into a
+ * contiguous output buffer. The result is identical to __crawdog_chachapoly_crypt
+ * over the concatenated associated data and input, without copying the
+ * fragments together first.
+ *
+ * \param ctx context data
+ * \param nonce nonce (12 bytes)
+ * \param ad associated data fragments
+ * \param ad_count number of associated data fragments
+ * \param input plaintext/ciphertext fragments
+ * \param input_count number of input fragments
+ * \param output plaintext/ciphertext output, at least as large as all input fragments together
+ * \param tag tag output
+ * \param tag_len tag length in bytes (0-16);
+          if 0, authentification is skipped
+ * \param encrypt decrypt if 0, else encrypt
+ * \return __CRAWDOG_CHACHAPOLY_OK if no error, __CRAWDOG_CHACHAPOLY_INVALID_MAC if auth
+ *         failed when decrypting
+ */
+int __crawdog_chachapoly_cryptv(struct __crawdog_chachapoly_ctx *ctx, const void *nonce,
+        const struct iovec *ad, size_t ad_count, const struct iovec *input, size_t input_count,
+        void *output, void *tag, int tag_len, int encrypt);
+
 #endif
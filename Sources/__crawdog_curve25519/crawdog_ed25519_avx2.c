@@ -0,0 +1,436 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+#include "crawdog_curve25519_mehdi.h"
+#include "crawdog_ed25519_avx2.h"
+
+#ifdef CRAWDOG_ED25519_HAVE_AVX2
+
+#include <immintrin.h>
+#include <string.h>
+
+#define AVX2_TARGET __attribute__((target("avx2")))
+
+extern const U_WORD _w_di[K_WORDS];
+extern const PA_POINT _w_base_folding8[256];
+
+/*
+    Field elements are stored in radix 2^25.5: ten unsigned limbs of
+    alternating 26 and 25 bits. Every limb is held in a 64-bit lane so a
+    4-way multiply can use vpmuludq (32x32->64) for all partial products.
+
+    Products and differences are carried, sums of two carried values are not.
+    Every multiply operand is therefore below 2^27.1 per limb, which keeps
+    19*g < 2^32 and the sum of the ten 64-bit partial products below 2^63.
+*/
+
+static const int _fe_pos[10] = { 0, 26, 51, 77, 102, 128, 153, 179, 204, 230 };
+
+#define FE_WIDTH(i)     (((i) & 1) ? 25 : 26)
+
+/* -- scalar conversions ---------------------------------------------------- */
+
+/* 32 byte little-endian value (< 2^256) to 10 limbs, bit 255 folded as 19 */
+static void fe10_FromBytes(uint64_t h[10], const uint8_t s[32])
+{
+    uint64_t w[4];
+    int i, j;
+
+    for (i = 0; i < 4; i++)
+    {
+        w[i] = 0;
+        for (j = 8; j-- > 0;) w[i] = (w[i] << 8) | s[i*8 + j];
+    }
+
+    for (i = 0; i < 10; i++)
+    {
+        int idx = _fe_pos[i] >> 6, off = _fe_pos[i] & 63;
+        uint64_t v = w[idx] >> off;
+        if (off + FE_WIDTH(i) > 64) v |= w[idx+1] << (64 - off);
+        h[i] = v & ((1ULL << FE_WIDTH(i)) - 1);
+    }
+    h[0] += 19 * (w[3] >> 63);
+}
+
+/* 10 carried limbs to the canonical 32 byte little-endian encoding */
+static void fe10_ToBytes(uint8_t s[32], const uint64_t f[10])
+{
+    int64_t h[10], q, c;
+    uint64_t w[4] = { 0, 0, 0, 0 };
+    int i, j;
+
+    for (i = 0; i < 10; i++) h[i] = (int64_t)f[i];
+
+    /* q = floor(h / p) */
+    q = (19 * h[9] + ((int64_t)1 << 24)) >> 25;
+    for (i = 0; i < 10; i++) q = (h[i] + q) >> FE_WIDTH(i);
+
+    /* h - q*p */
+    h[0] += 19 * q;
+    for (i = 0; i < 9; i++)
+    {
+        c = h[i] >> FE_WIDTH(i);
+        h[i+1] += c;
+        h[i] -= c * ((int64_t)1 << FE_WIDTH(i));
+    }
+    h[9] &= ((int64_t)1 << 25) - 1;
+
+    for (i = 0; i < 10; i++)
+    {
+        int idx = _fe_pos[i] >> 6, off = _fe_pos[i] & 63;
+        w[idx] |= (uint64_t)h[i] << off;
+        if (off + FE_WIDTH(i) > 64) w[idx+1] |= (uint64_t)h[i] >> (64 - off);
+    }
+    for (i = 0; i < 4; i++)
+        for (j = 0; j < 8; j++) s[i*8 + j] = (uint8_t)(w[i] >> (8*j));
+}
+
+static void fe10_FromWords(uint64_t h[10], const U_WORD *X)
+{
+    uint8_t s[32];
+    ecp_WordsToBytes(s, X);
+    fe10_FromBytes(h, s);
+}
+
+static void fe10_ToWords(U_WORD *Y, const uint64_t h[10])
+{
+    uint8_t s[32];
+    fe10_ToBytes(s, h);
+    ecp_BytesToWords(Y, s);
+}
+
+/* -- 4-way field arithmetic ------------------------------------------------ */
+
+typedef struct {
+    __m256i v[10];
+} FE4;
+
+/* lane selection for permutes: destination lane n takes source lane ln */
+#define LANES(l0,l1,l2,l3)  ((l0) | ((l1) << 2) | ((l2) << 4) | ((l3) << 6))
+
+/* 32-bit blend masks covering one 64-bit lane each */
+#define LANE0   0x03
+#define LANE1   0x0C
+#define LANE2   0x30
+#define LANE3   0xC0
+
+#define FE4_PERMUTE(r, a, imm) \
+    do { int _k; for (_k = 0; _k < 10; _k++) \
+        (r).v[_k] = _mm256_permute4x64_epi64((a).v[_k], (imm)); } while (0)
+
+/* r = a, with lanes in 'mask' taken from b */
+#define FE4_BLEND(r, a, b, mask) \
+    do { int _k; for (_k = 0; _k < 10; _k++) \
+        (r).v[_k] = _mm256_blend_epi32((a).v[_k], (b).v[_k], (mask)); } while (0)
+
+static AVX2_TARGET void fe4_Zero(FE4 *r)
+{
+    int i;
+    for (i = 0; i < 10; i++) r->v[i] = _mm256_setzero_si256();
+}
+
+static AVX2_TARGET void fe4_Pack(FE4 *r,
+    const uint64_t *l0, const uint64_t *l1, const uint64_t *l2, const uint64_t *l3)
+{
+    int i;
+    for (i = 0; i < 10; i++)
+        r->v[i] = _mm256_set_epi64x((long long)l3[i], (long long)l2[i], (long long)l1[i], (long long)l0[i]);
+}
+
+static AVX2_TARGET void fe4_Unpack(uint64_t l[4][10], const FE4 *a)
+{
+    uint64_t t[4];
+    int i, j;
+    for (i = 0; i < 10; i++)
+    {
+        _mm256_storeu_si256((__m256i*)t, a->v[i]);
+        for (j = 0; j < 4; j++) l[j][i] = t[j];
+    }
+}
+
+static AVX2_TARGET void fe4_Carry(FE4 *h)
+{
+    const __m256i m26 = _mm256_set1_epi64x(0x3ffffff);
+    const __m256i m25 = _mm256_set1_epi64x(0x1ffffff);
+    __m256i c;
+
+#define FE4_CARRY(i, j, bits, mask) \
+    c = _mm256_srli_epi64(h->v[i], bits); \
+    h->v[j] = _mm256_add_epi64(h->v[j], c); \
+    h->v[i] = _mm256_and_si256(h->v[i], mask)
+
+    FE4_CARRY(0, 1, 26, m26);
+    FE4_CARRY(4, 5, 26, m26);
+    FE4_CARRY(1, 2, 25, m25);
+    FE4_CARRY(5, 6, 25, m25);
+    FE4_CARRY(2, 3, 26, m26);
+    FE4_CARRY(6, 7, 26, m26);
+    FE4_CARRY(3, 4, 25, m25);
+    FE4_CARRY(7, 8, 25, m25);
+    FE4_CARRY(4, 5, 26, m26);
+    FE4_CARRY(8, 9, 26, m26);
+
+    /* 2^255 = 19 mod p */
+    c = _mm256_srli_epi64(h->v[9], 25);
+    h->v[9] = _mm256_and_si256(h->v[9], m25);
+    h->v[0] = _mm256_add_epi64(h->v[0], _mm256_add_epi64(c,
+        _mm256_add_epi64(_mm256_slli_epi64(c, 1), _mm256_slli_epi64(c, 4))));
+
+    FE4_CARRY(0, 1, 26, m26);
+
+#undef FE4_CARRY
+}
+
+/* r = a + b, left uncarried (limbs stay below 2^27.1 for carried inputs) */
+static AVX2_TARGET void fe4_Add(FE4 *r, const FE4 *a, const FE4 *b)
+{
+    int i;
+    for (i = 0; i < 10; i++) r->v[i] = _mm256_add_epi64(a->v[i], b->v[i]);
+}
+
+/* r = a + 4p - b, requires b to be a carried value or the sum of two */
+static AVX2_TARGET void fe4_Sub(FE4 *r, const FE4 *a, const FE4 *b)
+{
+    const __m256i p0 = _mm256_set1_epi64x(4*0x3ffffedLL);
+    const __m256i p_even = _mm256_set1_epi64x(4*0x3ffffffLL);
+    const __m256i p_odd = _mm256_set1_epi64x(4*0x1ffffffLL);
+    int i;
+
+    r->v[0] = _mm256_sub_epi64(_mm256_add_epi64(a->v[0], p0), b->v[0]);
+    for (i = 1; i < 10; i++)
+        r->v[i] = _mm256_sub_epi64(_mm256_add_epi64(a->v[i], (i & 1) ? p_odd : p_even), b->v[i]);
+    fe4_Carry(r);
+}
+
+/* r = f*g, lane by lane (ref10 schoolbook with 19x folding) */
+static AVX2_TARGET void fe4_Mul(FE4 *r, const FE4 *f, const FE4 *g)
+{
+    const __m256i v19 = _mm256_set1_epi64x(19);
+    __m256i f0 = f->v[0], f1 = f->v[1], f2 = f->v[2], f3 = f->v[3], f4 = f->v[4];
+    __m256i f5 = f->v[5], f6 = f->v[6], f7 = f->v[7], f8 = f->v[8], f9 = f->v[9];
+    __m256i g0 = g->v[0], g1 = g->v[1], g2 = g->v[2], g3 = g->v[3], g4 = g->v[4];
+    __m256i g5 = g->v[5], g6 = g->v[6], g7 = g->v[7], g8 = g->v[8], g9 = g->v[9];
+    __m256i f1_2 = _mm256_slli_epi64(f1, 1), f3_2 = _mm256_slli_epi64(f3, 1);
+    __m256i f5_2 = _mm256_slli_epi64(f5, 1), f7_2 = _mm256_slli_epi64(f7, 1);
+    __m256i f9_2 = _mm256_slli_epi64(f9, 1);
+    __m256i g1_19 = _mm256_mul_epu32(g1, v19), g2_19 = _mm256_mul_epu32(g2, v19);
+    __m256i g3_19 = _mm256_mul_epu32(g3, v19), g4_19 = _mm256_mul_epu32(g4, v19);
+    __m256i g5_19 = _mm256_mul_epu32(g5, v19), g6_19 = _mm256_mul_epu32(g6, v19);
+    __m256i g7_19 = _mm256_mul_epu32(g7, v19), g8_19 = _mm256_mul_epu32(g8, v19);
+    __m256i g9_19 = _mm256_mul_epu32(g9, v19);
+
+#define M(a,b)  _mm256_mul_epu32(a, b)
+#define A(a,b)  _mm256_add_epi64(a, b)
+    r->v[0] = A(A(A(M(f0,g0), M(f1_2,g9_19)), A(M(f2,g8_19), M(f3_2,g7_19))),
+                A(A(A(M(f4,g6_19), M(f5_2,g5_19)), A(M(f6,g4_19), M(f7_2,g3_19))), A(M(f8,g2_19), M(f9_2,g1_19))));
+    r->v[1] = A(A(A(M(f0,g1), M(f1,g0)), A(M(f2,g9_19), M(f3,g8_19))),
+                A(A(A(M(f4,g7_19), M(f5,g6_19)), A(M(f6,g5_19), M(f7,g4_19))), A(M(f8,g3_19), M(f9,g2_19))));
+    r->v[2] = A(A(A(M(f0,g2), M(f1_2,g1)), A(M(f2,g0), M(f3_2,g9_19))),
+                A(A(A(M(f4,g8_19), M(f5_2,g7_19)), A(M(f6,g6_19), M(f7_2,g5_19))), A(M(f8,g4_19), M(f9_2,g3_19))));
+    r->v[3] = A(A(A(M(f0,g3), M(f1,g2)), A(M(f2,g1), M(f3,g0))),
+                A(A(A(M(f4,g9_19), M(f5,g8_19)), A(M(f6,g7_19), M(f7,g6_19))), A(M(f8,g5_19), M(f9,g4_19))));
+    r->v[4] = A(A(A(M(f0,g4), M(f1_2,g3)), A(M(f2,g2), M(f3_2,g1))),
+                A(A(A(M(f4,g0), M(f5_2,g9_19)), A(M(f6,g8_19), M(f7_2,g7_19))), A(M(f8,g6_19), M(f9_2,g5_19))));
+    r->v[5] = A(A(A(M(f0,g5), M(f1,g4)), A(M(f2,g3), M(f3,g2))),
+                A(A(A(M(f4,g1), M(f5,g0)), A(M(f6,g9_19), M(f7,g8_19))), A(M(f8,g7_19), M(f9,g6_19))));
+    r->v[6] = A(A(A(M(f0,g6), M(f1_2,g5)), A(M(f2,g4), M(f3_2,g3))),
+                A(A(A(M(f4,g2), M(f5_2,g1)), A(M(f6,g0), M(f7_2,g9_19))), A(M(f8,g8_19), M(f9_2,g7_19))));
+    r->v[7] = A(A(A(M(f0,g7), M(f1,g6)), A(M(f2,g5), M(f3,g4))),
+                A(A(A(M(f4,g3), M(f5,g2)), A(M(f6,g1), M(f7,g0))), A(M(f8,g9_19), M(f9,g8_19))));
+    r->v[8] = A(A(A(M(f0,g8), M(f1_2,g7)), A(M(f2,g6), M(f3_2,g5))),
+                A(A(A(M(f4,g4), M(f5_2,g3)), A(M(f6,g2), M(f7_2,g1))), A(M(f8,g0), M(f9_2,g9_19))));
+    r->v[9] = A(A(A(M(f0,g9), M(f1,g8)), A(M(f2,g7), M(f3,g6))),
+                A(A(A(M(f4,g5), M(f5,g4)), A(M(f6,g3), M(f7,g2))), A(M(f8,g1), M(f9,g0))));
+#undef M
+#undef A
+
+    fe4_Carry(r);
+}
+
+/* -- 4-way point arithmetic ------------------------------------------------ */
+
+/*
+    Points are kept as (X, Y, Z, T) in lanes 0-3.
+    Cached points (addends) are kept as (Y-X, Y+X, 2*Z, 2d*T), which is the
+    lane-reordered form of PE_POINT.
+*/
+
+static AVX2_TARGET void edp4_FromExtPoint(FE4 *r, const Ext_POINT *p)
+{
+    uint64_t x[10], y[10], z[10], t[10];
+    fe10_FromWords(x, p->x);
+    fe10_FromWords(y, p->y);
+    fe10_FromWords(z, p->z);
+    fe10_FromWords(t, p->t);
+    fe4_Pack(r, x, y, z, t);
+}
+
+static AVX2_TARGET void edp4_ToExtPoint(Ext_POINT *r, const FE4 *p)
+{
+    uint64_t l[4][10];
+    fe4_Unpack(l, p);
+    fe10_ToWords(r->x, l[0]);
+    fe10_ToWords(r->y, l[1]);
+    fe10_ToWords(r->z, l[2]);
+    fe10_ToWords(r->t, l[3]);
+}
+
+static AVX2_TARGET void edp4_FromPE(FE4 *r, const PE_POINT *q)
+{
+    uint64_t ymx[10], ypx[10], z2[10], t2d[10];
+    fe10_FromWords(ymx, q->YmX);
+    fe10_FromWords(ypx, q->YpX);
+    fe10_FromWords(z2, q->Z2);
+    fe10_FromWords(t2d, q->T2d);
+    fe4_Pack(r, ymx, ypx, z2, t2d);
+}
+
+static AVX2_TARGET void edp4_FromPA(FE4 *r, const PA_POINT *q)
+{
+    static const uint64_t two[10] = { 2, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    uint64_t ymx[10], ypx[10], t2d[10];
+    fe10_FromWords(ymx, q->YmX);
+    fe10_FromWords(ypx, q->YpX);
+    fe10_FromWords(t2d, q->T2d);
+    fe4_Pack(r, ymx, ypx, two, t2d);
+}
+
+/*
+    Cost: 2 x 4M
+    Return: P = P + Q
+*/
+static AVX2_TARGET void edp4_AddCached(FE4 *p, const FE4 *q)
+{
+    FE4 t1, t2, s, d, l;
+
+    /* l = (Y1-X1, Y1+X1, Z1, T1) */
+    FE4_PERMUTE(t1, *p, LANES(1,1,2,3));
+    FE4_PERMUTE(t2, *p, LANES(0,0,2,3));
+    fe4_Add(&s, &t1, &t2);
+    fe4_Sub(&d, &t1, &t2);
+    FE4_BLEND(l, d, s, LANE1);
+    FE4_BLEND(l, l, *p, LANE2 | LANE3);
+
+    /* (A, B, D, C) = ((Y1-X1)*(Y2-X2), (Y1+X1)*(Y2+X2), Z1*2*Z2, T1*2d*T2) */
+    fe4_Mul(&l, &l, q);
+
+    /* s = (H, H, G, G), d = (E, E, F, F) */
+    FE4_PERMUTE(t1, l, LANES(1,1,2,2));
+    FE4_PERMUTE(t2, l, LANES(0,0,3,3));
+    fe4_Add(&s, &t1, &t2);
+    fe4_Sub(&d, &t1, &t2);
+
+    /* t1 = (E, G, F, E) */
+    FE4_PERMUTE(t1, d, LANES(0,0,2,0));
+    FE4_PERMUTE(t2, s, LANES(2,2,2,2));
+    FE4_BLEND(t1, t1, t2, LANE1);
+
+    /* t2 = (F, H, G, H) */
+    FE4_PERMUTE(t2, s, LANES(0,0,2,0));
+    FE4_PERMUTE(l, d, LANES(2,2,2,2));
+    FE4_BLEND(t2, t2, l, LANE0);
+
+    /* (X3, Y3, Z3, T3) = (E*F, G*H, F*G, E*H) */
+    fe4_Mul(p, &t1, &t2);
+}
+
+/*
+    Cost: 4S + 4M (as two 4-way multiplies)
+    Return: P = 2*P
+*/
+static AVX2_TARGET void edp4_DoublePoint(FE4 *p)
+{
+    FE4 zero, t, u, sq, a, b, sum_ab, dif_ba, m, w;
+
+    fe4_Zero(&zero);
+
+    /* (A, B, C, E') = (X1^2, Y1^2, Z1^2, (X1+Y1)^2) */
+    FE4_PERMUTE(t, *p, LANES(0,1,2,0));
+    FE4_PERMUTE(u, *p, LANES(1,1,1,1));
+    FE4_BLEND(u, zero, u, LANE3);
+    fe4_Add(&t, &t, &u);
+    fe4_Mul(&sq, &t, &t);
+
+    FE4_PERMUTE(a, sq, LANES(0,0,0,0));
+    FE4_PERMUTE(b, sq, LANES(1,1,1,1));
+    fe4_Add(&sum_ab, &a, &b);           /* A+B = -H */
+    fe4_Sub(&dif_ba, &b, &a);           /* B-A = G */
+
+    /* m = (E, H, H, E) where E = E'-A-B, H = -A-B */
+    FE4_PERMUTE(t, sq, LANES(3,3,3,3));
+    FE4_BLEND(t, zero, t, LANE0 | LANE3);
+    fe4_Sub(&m, &t, &sum_ab);
+
+    /* u = (E, H, G, E) */
+    FE4_BLEND(u, m, dif_ba, LANE2);
+
+    /* w = (F, G, F, H) where F = G - 2C */
+    FE4_PERMUTE(t, sq, LANES(2,2,2,2));
+    fe4_Add(&t, &t, &t);
+    FE4_BLEND(t, zero, t, LANE0 | LANE2);
+    fe4_Sub(&w, &dif_ba, &t);
+    FE4_PERMUTE(t, m, LANES(1,1,1,1));
+    FE4_BLEND(w, w, t, LANE3);
+
+    /* (X3, Y3, Z3, T3) = (E*F, H*G, G*F, E*H) */
+    fe4_Mul(p, &u, &w);
+}
+
+int edp_Avx2Available(void)
+{
+    static int available = -1;
+    if (available < 0)
+    {
+        __builtin_cpu_init();
+        available = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+    return available;
+}
+
+AVX2_TARGET void edp_PolyPointMultiplyAvx2(
+    Affine_POINT *r,
+    const U_WORD *a,
+    const U_WORD *b,
+    const PE_POINT *qtable)
+{
+    int i = 1;
+    Ext_POINT S;
+    const PE_POINT *q0;
+    uint8_t u[32], v[64];
+    FE4 P, B, Q[16];
+
+    ecp_8Folds(u, a);
+    ecp_4Folds(v, b);
+
+    /* Set initial value of S */
+    q0 = &qtable[v[0]];
+    ecp_SubReduce(S.x, q0->YpX, q0->YmX);   /* 2x */
+    ecp_AddReduce(S.y, q0->YpX, q0->YmX);   /* 2y */
+    ecp_MulReduce(S.t, q0->T2d, _w_di);     /* 2xy */
+    ecp_Copy(S.z, q0->Z2);                  /* 2z */
+
+    edp4_FromExtPoint(&P, &S);
+    for (i = 0; i < 16; i++) edp4_FromPE(&Q[i], &qtable[i]);
+
+    i = 1;
+    do
+    {   /* 31D + 31A */
+        edp4_DoublePoint(&P);
+        edp4_AddCached(&P, &Q[v[i]]);
+    } while (++i < 32);
+
+    do
+    {   /* 32D + 64A */
+        edp4_DoublePoint(&P);
+        edp4_FromPA(&B, &_w_base_folding8[u[i-32]]);
+        edp4_AddCached(&P, &B);
+        edp4_AddCached(&P, &Q[v[i]]);
+    } while (++i < 64);
+
+    edp4_ToExtPoint(&S, &P);
+
+    ecp_Inverse(S.z, S.z);
+    ecp_MulMod(r->x, S.x, S.z);
+    ecp_MulMod(r->y, S.y, S.z);
+}
+
+#endif // CRAWDOG_ED25519_HAVE_AVX2
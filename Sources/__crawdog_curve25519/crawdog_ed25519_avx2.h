@@ -0,0 +1,46 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+#ifndef __CRAWDOG_ED25519_AVX2_H
+#define __CRAWDOG_ED25519_AVX2_H
+
+#include "crawdog_curve25519_mehdi.h"
+
+/*
+    4-way parallel field backend for the ed25519 verification path.
+
+    The four coordinates of an extended point (X:Y:Z:T) are kept in the four
+    64-bit lanes of a set of AVX2 registers, using a radix 2^25.5 (10 limb)
+    representation for every lane. Point addition and doubling then map onto
+    the parallel formulas of Hisil, Wong, Carter & Dawson (eprint 2008/522),
+    and each costs two 4-way field multiplies: the addition multiplies the
+    operands and then forms (X3, Y3, Z3, T3), the doubling squares
+    (X1, Y1, Z1, X1+Y1) and then forms (X3, Y3, Z3, T3).
+
+    The backend is selected at runtime. It is only compiled for x86-64
+    targets with a gcc/clang compatible compiler; on every other target, or
+    when the host cpu lacks AVX2 (edp_Avx2Available() returns 0), callers
+    keep using the scalar mehdi arithmetic.
+*/
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CRAWDOG_ED25519_HAVE_AVX2
+#endif
+
+#ifdef CRAWDOG_ED25519_HAVE_AVX2
+
+/* Return non-zero when the AVX2 backend can be used on this host */
+int edp_Avx2Available(void);
+
+/*
+    Assumptions: qtable = pre-computed Q (see __crawdog_ed25519_verify_init)
+    Calculate: point R = a*P + b*Q  where P is base point
+*/
+void edp_PolyPointMultiplyAvx2(
+    Affine_POINT *r,
+    const U_WORD *a,
+    const U_WORD *b,
+    const PE_POINT *qtable);
+
+#endif // CRAWDOG_ED25519_HAVE_AVX2
+
+#endif // __CRAWDOG_ED25519_AVX2_H
@@ -0,0 +1,354 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+#include "crawdog_external_calls.h"
+#include "crawdog_curve25519_mehdi.h"
+#include "crawdog_ed25519_signature.h"
+#include <stdint.h>
+
+/* -- Multi-scalar multiplication ---------------------------------------------
+//
+//  R = SUM(k_i*P_i)  for i = 0,1,2,...n-1
+//
+//  Straus (small n): every point gets a table of [1..8]*P_i, the scalars are
+//  recoded into signed radix-16 digits and all points share the same 256
+//  doublings.
+//
+//  Pippenger (large n): the scalars are recoded into signed radix-2^w digits.
+//  For every window, each point is added into the bucket of its digit and
+//  the buckets are combined with a running sum:
+//
+//      SUM(j*B_j) = B_m + (B_m + B_m-1) + ... + (B_m + ... + B_1)
+//
+//  w is picked per call to minimize the total number of point additions.
+//
+//  Everything here runs in variable time, the inputs are assumed public
+//  (batch verification, aggregation of public keys and signatures).
+//
+// -------------------------------------------------------------------------
+*/
+
+extern const U_WORD _w_P[K_WORDS];
+extern const U_WORD _w_maxP[K_WORDS];
+extern const PA_POINT _w_base_folding8[256];
+
+#define _w_Zero     _w_base_folding8[0].T2d
+#define _w_One      _w_base_folding8[0].YpX
+
+static const U_WORD _w_d[K_WORDS] =
+    W256(0x135978A3,0x75EB4DCA,0x4141D8AB,0x00700A4D,0x7779E898,0x8CC74079,0x2B6FFE73,0x52036CEE);
+
+#define MSM_SCALAR_BITS     256
+#define MSM_STRAUS_WINDOW   4
+#define MSM_STRAUS_LIMIT    128     /* Straus wins below this many points */
+
+static void edp_SetIdentity(Ext_POINT *p)
+{
+    ecp_SetValue(p->x, 0);
+    ecp_SetValue(p->y, 1);
+    ecp_SetValue(p->z, 1);
+    ecp_SetValue(p->t, 0);
+}
+
+/* Return 1 when p is the encoding of a point on the curve, 0 otherwise */
+static int edp_UnpackValidPoint(Ext_POINT *r, const unsigned char *p)
+{
+    U_WORD u[K_WORDS], v[K_WORDS];
+    uint8_t parity = ecp_DecodeInt(r->y, p);
+
+    if (ecp_CmpLT(r->y, _w_P) == 0) return 0;      /* non-canonical y */
+
+    ed25519_CalculateX(r->x, r->y, parity);
+
+    /* x^2*(d*y^2 + 1) must equal y^2 - 1 */
+    ecp_SqrReduce(u, r->y);
+    ecp_MulReduce(v, u, _w_d);
+    ecp_AddReduce(v, v, _w_One);
+    ecp_SubReduce(u, u, _w_One);
+    ecp_SqrReduce(r->t, r->x);
+    ecp_MulReduce(v, v, r->t);
+    ecp_SubReduce(v, v, u);
+    ecp_Mod(v);
+    if (ecp_CmpNE(v, _w_Zero)) return 0;
+
+    /* x = 0 has no negative encoding */
+    if (ecp_CmpNE(r->x, _w_P) == 0) return 0;
+
+    ecp_MulMod(r->t, r->x, r->y);
+    ecp_SetValue(r->z, 1);
+    return 1;
+}
+
+static void edp_PackExtPoint(unsigned char *r, const Ext_POINT *p)
+{
+    U_WORD x[K_WORDS], y[K_WORDS], zi[K_WORDS];
+
+    ecp_Inverse(zi, p->z);
+    ecp_MulMod(x, p->x, zi);
+    ecp_MulMod(y, p->y, zi);
+    ed25519_PackPoint(r, y, x[0]);
+}
+
+/* r = -q for a pre-computed point */
+static void edp_NegatePE(PE_POINT *r, const PE_POINT *q)
+{
+    ecp_Copy(r->YpX, q->YmX);
+    ecp_Copy(r->YmX, q->YpX);
+    ecp_SubReduce(r->T2d, _w_maxP, q->T2d);
+    ecp_Copy(r->Z2, q->Z2);
+}
+
+/* P = P + (sign) ? -q : q */
+static void edp_AddSignedPoint(Ext_POINT *p, const PE_POINT *q, int negative)
+{
+    PE_POINT n;
+    if (negative)
+    {
+        edp_NegatePE(&n, q);
+        edp_AddPoint(p, p, &n);
+    }
+    else
+    {
+        edp_AddPoint(p, p, q);
+    }
+}
+
+/* P = P + Q, both in extended coordinates */
+static void edp_AddExtPoint(Ext_POINT *p, const Ext_POINT *q)
+{
+    PE_POINT t;
+    edp_ExtPoint2PE(&t, q);
+    edp_AddPoint(p, p, &t);
+}
+
+/* r = q in extended coordinates, scaled by 2Z: (2X*2Z, 2Y*2Z, 2Z*2Z, 2X*2Y). four multiplications, half of a point addition */
+static void edp_PE2ExtPoint(Ext_POINT *r, const PE_POINT *q)
+{
+    U_WORD x2[K_WORDS], y2[K_WORDS];
+    ecp_SubReduce(x2, q->YpX, q->YmX);
+    ecp_AddReduce(y2, q->YpX, q->YmX);
+    ecp_MulReduce(r->x, x2, q->Z2);
+    ecp_MulReduce(r->y, y2, q->Z2);
+    ecp_MulReduce(r->z, q->Z2, q->Z2);
+    ecp_MulReduce(r->t, x2, y2);
+}
+
+/*
+    Recode a 256-bit little-endian scalar into count signed radix 2^w digits.
+    Every digit but the last is in [-2^(w-1), 2^(w-1)), the last one absorbs the
+    final carry and is in [0, 2^(w-1)].
+*/
+static void edp_SignedDigits(int16_t *d, int count, const uint8_t *k, int w)
+{
+    int i, j, bit, v, carry = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        v = 0;
+        for (j = 0; j < w; j++)
+        {
+            bit = i*w + j;
+            if (bit < MSM_SCALAR_BITS) v |= ((k[bit >> 3] >> (bit & 7)) & 1) << j;
+        }
+        v += carry;
+        if (i == count - 1)
+        {
+            d[i] = (int16_t)v;
+            break;
+        }
+        carry = (v + (1 << (w - 1))) >> w;
+        d[i] = (int16_t)(v - (carry << w));
+    }
+}
+
+static int edp_DigitCount(int w)
+{
+    return (MSM_SCALAR_BITS + w) / w;
+}
+
+/* Pick the Pippenger window size with the fewest point additions for n points */
+static int edp_PippengerWindow(size_t n)
+{
+    int w, best = 2;
+    double cost, best_cost = 0;
+
+    for (w = 2; w <= 16; w++)
+    {
+        /* per window: n bucket additions + 2 additions per bucket for the running sum */
+        cost = (double)edp_DigitCount(w) * ((double)n + (double)(2 << (w - 1))) + MSM_SCALAR_BITS;
+        if (w == 2 || cost < best_cost)
+        {
+            best = w;
+            best_cost = cost;
+        }
+    }
+    return best;
+}
+
+static int edp_MsmStraus(Ext_POINT *r, const unsigned char *scalars, const PE_POINT *base, size_t n)
+{
+    const int count = edp_DigitCount(MSM_STRAUS_WINDOW);
+    PE_POINT *table;
+    int16_t *digits;
+    Ext_POINT T;
+    size_t i;
+    int j, d;
+
+    table = (PE_POINT*)mem_alloc(n*8*sizeof(PE_POINT));
+    digits = (int16_t*)mem_alloc(n*count*sizeof(int16_t));
+    if (table == 0 || digits == 0)
+    {
+        mem_free(table);
+        mem_free(digits);
+        return 0;
+    }
+
+    /* table[8*i + j] = (j+1)*P_i */
+    for (i = 0; i < n; i++)
+    {
+        PE_POINT *t = &table[8*i];
+        t[0] = base[i];
+        edp_PE2ExtPoint(&T, &t[0]);
+        for (j = 1; j < 8; j++)
+        {
+            edp_AddPoint(&T, &T, &t[0]);
+            edp_ExtPoint2PE(&t[j], &T);
+        }
+        edp_SignedDigits(&digits[i*count], count, &scalars[32*i], MSM_STRAUS_WINDOW);
+    }
+
+    edp_SetIdentity(r);
+    for (j = count - 1; j >= 0; j--)
+    {
+        if (j != count - 1)
+        {
+            edp_DoublePoint(r);
+            edp_DoublePoint(r);
+            edp_DoublePoint(r);
+            edp_DoublePoint(r);
+        }
+        for (i = 0; i < n; i++)
+        {
+            d = digits[i*count + j];
+            if (d > 0) edp_AddPoint(r, r, &table[8*i + d - 1]);
+            else if (d < 0) edp_AddSignedPoint(r, &table[8*i - d - 1], 1);
+        }
+    }
+
+    mem_free(table);
+    mem_free(digits);
+    return 1;
+}
+
+static int edp_MsmPippenger(Ext_POINT *r, const unsigned char *scalars, const PE_POINT *base, size_t n)
+{
+    const int w = edp_PippengerWindow(n);
+    const int count = edp_DigitCount(w);
+    const int buckets = 1 << (w - 1);
+    Ext_POINT *bucket, sum, acc;
+    uint8_t *used;
+    int16_t *digits;
+    size_t i;
+    int j, b, d, any;
+
+    bucket = (Ext_POINT*)mem_alloc(buckets*sizeof(Ext_POINT));
+    used = (uint8_t*)mem_alloc(buckets);
+    digits = (int16_t*)mem_alloc(n*count*sizeof(int16_t));
+    if (bucket == 0 || used == 0 || digits == 0)
+    {
+        mem_free(bucket);
+        mem_free(used);
+        mem_free(digits);
+        return 0;
+    }
+
+    for (i = 0; i < n; i++) edp_SignedDigits(&digits[i*count], count, &scalars[32*i], w);
+
+    edp_SetIdentity(r);
+    for (j = count - 1; j >= 0; j--)
+    {
+        if (j != count - 1)
+        {
+            for (b = 0; b < w; b++) edp_DoublePoint(r);
+        }
+
+        /* fill the buckets */
+        mem_clear(used, buckets);
+        for (i = 0; i < n; i++)
+        {
+            d = digits[i*count + j];
+            if (d == 0) continue;
+            b = ((d < 0) ? -d : d) - 1;
+            if (!used[b])
+            {
+                edp_SetIdentity(&bucket[b]);
+                used[b] = 1;
+            }
+            edp_AddSignedPoint(&bucket[b], &base[i], d < 0);
+        }
+
+        /* acc = SUM((b+1)*bucket[b]) using a running sum from the top bucket down */
+        any = 0;
+        for (b = buckets - 1; b >= 0; b--)
+        {
+            if (used[b])
+            {
+                if (any) edp_AddExtPoint(&sum, &bucket[b]);
+                else
+                {
+                    sum = bucket[b];
+                    acc = bucket[b];
+                    any = 1;
+                    continue;
+                }
+            }
+            if (any) edp_AddExtPoint(&acc, &sum);
+        }
+        if (any) edp_AddExtPoint(r, &acc);
+    }
+
+    mem_free(bucket);
+    mem_free(used);
+    mem_free(digits);
+    return 1;
+}
+
+int __crawdog_ed25519_multi_scalar_mult(
+    unsigned char *r,
+    const unsigned char *scalars,
+    const unsigned char *points,
+    size_t count,
+    int method)
+{
+    Ext_POINT P, R;
+    PE_POINT *base;
+    size_t i;
+    int rc;
+
+    base = (PE_POINT*)mem_alloc((count ? count : 1)*sizeof(PE_POINT));
+    if (base == 0) return 0;
+
+    for (i = 0; i < count; i++)
+    {
+        if (!edp_UnpackValidPoint(&P, &points[32*i]))
+        {
+            mem_free(base);
+            return 0;
+        }
+        edp_ExtPoint2PE(&base[i], &P);
+    }
+
+    if (method == __CRAWDOG_ED25519_MSM_AUTO)
+    {
+        method = (count < MSM_STRAUS_LIMIT) ? __CRAWDOG_ED25519_MSM_STRAUS : __CRAWDOG_ED25519_MSM_PIPPENGER;
+    }
+
+    if (method == __CRAWDOG_ED25519_MSM_STRAUS)
+        rc = edp_MsmStraus(&R, scalars, base, count);
+    else
+        rc = edp_MsmPippenger(&R, scalars, base, count);
+
+    if (rc) edp_PackExtPoint(r, &R);
+
+    mem_free(base);
+    return rc;
+}
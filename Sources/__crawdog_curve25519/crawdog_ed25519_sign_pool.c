@@ -0,0 +1,194 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+#include "crawdog_external_calls.h"
+#include "crawdog_curve25519_mehdi.h"
+#include "crawdog_ed25519_signature.h"
+#include "crawdog_sha512.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <unistd.h>
+
+/* -- Signing pool ------------------------------------------------------------
+//
+//  A fixed set of blinding contexts, each guarded by its own lock. A signer
+//  starts probing at a slot derived from its thread identity, so a thread
+//  keeps hitting the same (cache-warm) context as long as it is not
+//  contended, and falls over to any free slot when it is.
+//
+//  Contexts are replaced rather than re-seeded in place: a replacement is
+//  built without holding any lock and swapped in under the slot lock, so a
+//  refresh never stalls the other signers.
+//
+// -------------------------------------------------------------------------
+*/
+
+typedef struct {
+    pthread_mutex_t lock;
+    void *blinding;             /* EDP_BLINDING_CTX */
+    uint64_t uses;              /* signatures since the last refresh */
+} EDP_SIGN_POOL_SLOT;
+
+typedef struct {
+    size_t count;
+    uint64_t refresh_interval;
+    EDP_SIGN_POOL_SLOT slots[];
+} EDP_SIGN_POOL;
+
+/* derive an independent blinding seed for every slot from the caller seed */
+static void *edp_PoolSlotBlinding(
+    void *context,
+    const unsigned char *seed,
+    size_t size,
+    size_t slot)
+{
+    struct __crawdog_sha512_context H;
+    uint8_t digest[__CRAWDOG_SHA512_HASH_SIZE];
+    uint64_t index = slot;
+    void *blinding;
+
+    __crawdog_sha512_init(&H);
+    __crawdog_sha512_update(&H, seed, (uint32_t)size);
+    __crawdog_sha512_update(&H, &index, sizeof(index));
+    __crawdog_sha512_finish(&H, (__crawdog_sha512_output*)&digest);
+
+    blinding = __crawdog_ed25519_blinding_init(context, digest, sizeof(digest));
+
+    mem_clear(digest, sizeof(digest));
+    mem_clear(&H, sizeof(H));
+    return blinding;
+}
+
+static size_t edp_PoolThreadSlot(const EDP_SIGN_POOL *pool)
+{
+    uint64_t h = (uint64_t)(uintptr_t)pthread_self();
+    /* pthread identities are usually aligned addresses, mix the high bits down */
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    return (size_t)(h % pool->count);
+}
+
+void *__crawdog_ed25519_signing_pool_init(
+    size_t slots,
+    const unsigned char *seed,
+    size_t size,
+    uint64_t refresh_interval)
+{
+    EDP_SIGN_POOL *pool;
+    size_t i;
+
+    if (slots == 0)
+    {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        slots = (online > 0) ? (size_t)online : 1;
+    }
+
+    pool = (EDP_SIGN_POOL*)mem_alloc(sizeof(EDP_SIGN_POOL) + slots*sizeof(EDP_SIGN_POOL_SLOT));
+    if (pool == 0) return 0;
+
+    pool->count = slots;
+    pool->refresh_interval = refresh_interval;
+
+    for (i = 0; i < slots; i++)
+    {
+        pool->slots[i].uses = 0;
+        pool->slots[i].blinding = edp_PoolSlotBlinding(0, seed, size, i);
+        if (pool->slots[i].blinding == 0 || pthread_mutex_init(&pool->slots[i].lock, 0) != 0)
+        {
+            __crawdog_ed25519_blinding_finish(pool->slots[i].blinding);
+            while (i-- > 0)
+            {
+                pthread_mutex_destroy(&pool->slots[i].lock);
+                __crawdog_ed25519_blinding_finish(pool->slots[i].blinding);
+            }
+            mem_free(pool);
+            return 0;
+        }
+    }
+    return pool;
+}
+
+size_t __crawdog_ed25519_signing_pool_size(const void *context)
+{
+    return ((const EDP_SIGN_POOL*)context)->count;
+}
+
+int __crawdog_ed25519_signing_pool_sign(
+    void *context,
+    unsigned char *signature,
+    const unsigned char *privKey,
+    const unsigned char *msg,
+    size_t msg_size,
+    size_t *slot_used)
+{
+    EDP_SIGN_POOL *pool = (EDP_SIGN_POOL*)context;
+    EDP_SIGN_POOL_SLOT *slot = 0;
+    size_t start = edp_PoolThreadSlot(pool), i;
+    int refresh;
+
+    for (i = 0; i < pool->count; i++)
+    {
+        EDP_SIGN_POOL_SLOT *candidate = &pool->slots[(start + i) % pool->count];
+        if (pthread_mutex_trylock(&candidate->lock) == 0)
+        {
+            slot = candidate;
+            break;
+        }
+    }
+    if (slot == 0)
+    {
+        /* every slot is busy: wait on our home slot */
+        slot = &pool->slots[start];
+        pthread_mutex_lock(&slot->lock);
+    }
+
+    __crawdog_ed25519_sign_message(signature, privKey, slot->blinding, msg, msg_size);
+    slot->uses++;
+    refresh = (pool->refresh_interval != 0 && slot->uses >= pool->refresh_interval);
+
+    pthread_mutex_unlock(&slot->lock);
+
+    if (slot_used) *slot_used = (size_t)(slot - pool->slots);
+    return refresh;
+}
+
+int __crawdog_ed25519_signing_pool_refresh(
+    void *context,
+    size_t slot,
+    const unsigned char *seed,
+    size_t size)
+{
+    EDP_SIGN_POOL *pool = (EDP_SIGN_POOL*)context;
+    void *fresh, *stale;
+
+    if (slot >= pool->count) return 0;
+
+    /* the expensive part happens without holding the slot lock */
+    fresh = edp_PoolSlotBlinding(0, seed, size, slot);
+    if (fresh == 0) return 0;
+
+    pthread_mutex_lock(&pool->slots[slot].lock);
+    stale = pool->slots[slot].blinding;
+    pool->slots[slot].blinding = fresh;
+    pool->slots[slot].uses = 0;
+    pthread_mutex_unlock(&pool->slots[slot].lock);
+
+    __crawdog_ed25519_blinding_finish(stale);
+    return 1;
+}
+
+void __crawdog_ed25519_signing_pool_finish(void *context)
+{
+    EDP_SIGN_POOL *pool = (EDP_SIGN_POOL*)context;
+    size_t i;
+
+    if (pool)
+    {
+        for (i = 0; i < pool->count; i++)
+        {
+            pthread_mutex_destroy(&pool->slots[i].lock);
+            __crawdog_ed25519_blinding_finish(pool->slots[i].blinding);
+        }
+        mem_free(pool);
+    }
+}
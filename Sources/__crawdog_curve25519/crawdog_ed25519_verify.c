@@ -5,6 +5,7 @@
 #include "crawdog_curve25519_mehdi.h"
 #include "crawdog_ed25519_signature.h"
 #include "crawdog_sha512.h"
+#include "crawdog_ed25519_avx2.h"
 
 /*
  * Arithmetic on twisted Edwards curve y^2 - x^2 = 1 + dx^2y^2
@@ -218,6 +219,7 @@ void __crawdog_ed25519_verify_finish(void *ctx)
 /*
     Assumptions: qtable = pre-computed Q
     Calculate: point R = a*P + b*Q  where P is base point
+    Dispatches to the 4-way AVX2 backend when the host supports it.
 */
 static void edp_PolyPointMultiply(
     Affine_POINT *r, 
@@ -230,6 +232,14 @@ static void edp_PolyPointMultiply(
     const PE_POINT *q0;
     uint8_t u[32], v[64];
 
+#ifdef CRAWDOG_ED25519_HAVE_AVX2
+    if (edp_Avx2Available())
+    {
+        edp_PolyPointMultiplyAvx2(r, a, b, qtable);
+        return;
+    }
+#endif
+
     ecp_8Folds(u, a);
     ecp_4Folds(v, b);
 
@@ -0,0 +1,623 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+#include "crawdog_external_calls.h"
+#include "crawdog_curve25519_mehdi.h"
+#include "crawdog_ristretto255.h"
+#include "crawdog_sha512.h"
+#include <stdint.h>
+
+/*
+ * ristretto255 prime order group (RFC 9496) on top of the ed25519 arithmetic.
+ *
+ * Group elements live internally as extended edwards points (Ext_POINT) and
+ * are only converted to/from their canonical 32 byte encoding at the API
+ * boundary. All field operations go through the same ecp_* routines as
+ * X25519 and ed25519, the group law is edp_AddPoint/edp_DoublePoint.
+ *
+ * Field values produced by the ecp_*Reduce functions are only partially
+ * reduced (< 2^256), so every sign or equality test below reduces a copy
+ * with ecp_Mod first.
+ *
+ * Scalars are handled with the mod BPO (l) helpers of crawdog_curve25519_order.c.
+ */
+
+extern const U_WORD _w_P[K_WORDS];
+extern const U_WORD _w_maxP[K_WORDS];
+extern const U_WORD _w_I[K_WORDS];          /* sqrt(-1) */
+extern const U_WORD _w_2d[K_WORDS];
+extern const U_WORD _w_NxBPO[16][K_WORDS];
+extern EDP_BLINDING_CTX edp_custom_blinding;
+
+#define _w_BPO _w_NxBPO[1]
+
+static const U_WORD _w_Zero[K_WORDS] = W256(0,0,0,0,0,0,0,0);
+static const U_WORD _w_One[K_WORDS] = W256(1,0,0,0,0,0,0,0);
+
+static const U_WORD _w_d[K_WORDS] =
+    W256(0x135978A3,0x75EB4DCA,0x4141D8AB,0x00700A4D,0x7779E898,0x8CC74079,0x2B6FFE73,0x52036CEE);
+static const U_WORD _w_SqrtAdMinusOne[K_WORDS] = /* sqrt(a*d - 1) */
+    W256(0x497B2E1B,0x7E97F6A0,0x1B7854BD,0xAF9D8E0C,0x31F5D1FD,0x0F3CFCC9,0x2B8348AC,0x376931BF);
+static const U_WORD _w_InvSqrtAMinusD[K_WORDS] = /* 1/sqrt(a - d) */
+    W256(0x805D40EA,0x99C8FDAA,0x5A4172BE,0x9D2F1617,0xFE01D840,0x16C27B91,0xCFAFFCA2,0x786C8905);
+static const U_WORD _w_OneMinusDSq[K_WORDS] = /* 1 - d^2 */
+    W256(0x945FC176,0xE27C09C1,0xCD5E350F,0x2C81A138,0xBE70DFE4,0x9994ABDD,0xB2B3E0D7,0x029072A8);
+static const U_WORD _w_DMinusOneSq[K_WORDS] = /* (d - 1)^2 */
+    W256(0x44ED4D20,0x31AD5AAA,0xB01E1999,0xD29E4A2C,0x529B4EEB,0x4CDCD32F,0xF66C2241,0x5968B37A);
+static const uint8_t _b_BPOm2[K_BYTES] = { /* l - 2, little-endian */
+    0xEB,0xD3,0xF5,0x5C,0x1A,0x63,0x12,0x58,0xD6,0x9C,0xF7,0xA2,0xDE,0xF9,0xDE,0x14,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10 };
+
+/* -- field helpers ------------------------------------------------------- */
+
+/* Return 1 if x mod p is odd ("negative"), 0 otherwise */
+static U_WORD fe_IsNegative(const U_WORD *x)
+{
+    U_WORD t[K_WORDS];
+    ecp_Copy(t, x);
+    ecp_Mod(t);
+    return t[0] & 1;
+}
+
+/* Return 1 if x = 0 mod p, 0 otherwise */
+static U_WORD fe_IsZero(const U_WORD *x)
+{
+    U_WORD t[K_WORDS], acc;
+    ecp_Copy(t, x);
+    ecp_Mod(t);
+    acc = t[0] | t[1] | t[2] | t[3] | t[4] | t[5] | t[6] | t[7];
+    return 1 ^ ((acc | ((U_WORD)0 - acc)) >> (sizeof(U_WORD)*8 - 1));
+}
+
+/* Return 1 if x = y mod p, 0 otherwise */
+static U_WORD fe_IsEqual(const U_WORD *x, const U_WORD *y)
+{
+    U_WORD t[K_WORDS];
+    ecp_SubReduce(t, x, y);
+    return fe_IsZero(t);
+}
+
+/* Y = (flag) ? X : Y, flag must be 0 or 1 */
+static void fe_CondCopy(U_WORD *Y, const U_WORD *X, U_WORD flag)
+{
+    size_t i;
+    U_WORD mask = (U_WORD)0 - flag;
+    for (i = 0; i < K_WORDS; i++) Y[i] ^= mask & (Y[i] ^ X[i]);
+}
+
+/* Y = -X */
+static void fe_Neg(U_WORD *Y, const U_WORD *X)
+{
+    ecp_SubReduce(Y, _w_maxP, X);
+}
+
+/* Y = (flag) ? -Y : Y */
+static void fe_CondNeg(U_WORD *Y, U_WORD flag)
+{
+    U_WORD t[K_WORDS];
+    fe_Neg(t, Y);
+    fe_CondCopy(Y, t, flag);
+}
+
+/* Y = |Y| (the non-negative square root representative) */
+static void fe_Abs(U_WORD *Y)
+{
+    fe_CondNeg(Y, fe_IsNegative(Y));
+}
+
+/*
+    Calculate r = sqrt(u/v) when u/v is square, r = sqrt(i*u/v) otherwise.
+    Return 1 when u/v was square.
+*/
+static U_WORD fe_SqrtRatioM1(U_WORD *r, const U_WORD *u, const U_WORD *v)
+{
+    U_WORD v3[K_WORDS], v7[K_WORDS], t[K_WORDS], check[K_WORDS], nu[K_WORDS];
+    U_WORD correct, flipped, flipped_i;
+
+    ecp_SqrReduce(v3, v);
+    ecp_MulReduce(v3, v3, v);           /* v^3 */
+    ecp_SqrReduce(v7, v3);
+    ecp_MulReduce(v7, v7, v);           /* v^7 */
+    ecp_MulReduce(t, u, v7);
+    ecp_ModExp2523(t, t);               /* (u*v^7)^((p-5)/8) */
+    ecp_MulReduce(r, u, v3);
+    ecp_MulReduce(r, r, t);             /* r = u*v^3 * (u*v^7)^((p-5)/8) */
+
+    ecp_SqrReduce(check, r);
+    ecp_MulReduce(check, check, v);     /* check = v*r^2 */
+
+    fe_Neg(nu, u);
+    correct = fe_IsEqual(check, u);
+    flipped = fe_IsEqual(check, nu);
+    ecp_MulReduce(nu, nu, _w_I);
+    flipped_i = fe_IsEqual(check, nu);
+
+    ecp_MulReduce(t, r, _w_I);
+    fe_CondCopy(r, t, flipped | flipped_i);
+    fe_Abs(r);
+
+    return correct | flipped;
+}
+
+/* -- group helpers ------------------------------------------------------- */
+
+static void r255_SetIdentity(Ext_POINT *p)
+{
+    ecp_SetValue(p->x, 0);
+    ecp_SetValue(p->y, 1);
+    ecp_SetValue(p->z, 1);
+    ecp_SetValue(p->t, 0);
+}
+
+/* Return 1 when s decodes to a group element stored in p, 0 otherwise */
+static int r255_Decode(Ext_POINT *p, const unsigned char *s)
+{
+    U_WORD S[K_WORDS], ss[K_WORDS], u1[K_WORDS], u2[K_WORDS], u2sqr[K_WORDS];
+    U_WORD v[K_WORDS], t[K_WORDS], invsqrt[K_WORDS], den_x[K_WORDS], den_y[K_WORDS];
+    U_WORD was_square;
+
+    ecp_BytesToWords(S, s);
+
+    /* reject non-canonical and negative field encodings */
+    if (ecp_CmpLT(S, _w_P) == 0 || (S[0] & 1) != 0) return 0;
+
+    ecp_SqrReduce(ss, S);
+    ecp_SubReduce(u1, _w_One, ss);      /* u1 = 1 - s^2 */
+    ecp_AddReduce(u2, _w_One, ss);      /* u2 = 1 + s^2 */
+    ecp_SqrReduce(u2sqr, u2);
+
+    ecp_SqrReduce(v, u1);
+    ecp_MulReduce(v, v, _w_d);
+    fe_Neg(v, v);
+    ecp_SubReduce(v, v, u2sqr);         /* v = -(d*u1^2) - u2^2 */
+
+    ecp_MulReduce(t, v, u2sqr);
+    was_square = fe_SqrtRatioM1(invsqrt, _w_One, t);
+
+    ecp_MulReduce(den_x, invsqrt, u2);
+    ecp_MulReduce(den_y, invsqrt, den_x);
+    ecp_MulReduce(den_y, den_y, v);
+
+    ecp_AddReduce(p->x, S, S);
+    ecp_MulReduce(p->x, p->x, den_x);
+    fe_Abs(p->x);                       /* x = |2*s*den_x| */
+    ecp_MulReduce(p->y, u1, den_y);     /* y = u1*den_y */
+    ecp_SetValue(p->z, 1);
+    ecp_MulReduce(p->t, p->x, p->y);
+
+    return (was_square & (fe_IsNegative(p->t) ^ 1) & (fe_IsZero(p->y) ^ 1)) != 0;
+}
+
+static void r255_Encode(unsigned char *s, const Ext_POINT *p)
+{
+    U_WORD u1[K_WORDS], u2[K_WORDS], t[K_WORDS], invsqrt[K_WORDS];
+    U_WORD den1[K_WORDS], den2[K_WORDS], z_inv[K_WORDS];
+    U_WORD x[K_WORDS], y[K_WORDS], den_inv[K_WORDS];
+    U_WORD rotate;
+
+    ecp_AddReduce(u1, p->z, p->y);
+    ecp_SubReduce(t, p->z, p->y);
+    ecp_MulReduce(u1, u1, t);           /* u1 = (z + y)*(z - y) */
+    ecp_MulReduce(u2, p->x, p->y);      /* u2 = x*y */
+
+    ecp_SqrReduce(t, u2);
+    ecp_MulReduce(t, t, u1);
+    (void)fe_SqrtRatioM1(invsqrt, _w_One, t);
+
+    ecp_MulReduce(den1, invsqrt, u1);
+    ecp_MulReduce(den2, invsqrt, u2);
+    ecp_MulReduce(z_inv, den1, den2);
+    ecp_MulReduce(z_inv, z_inv, p->t);
+
+    ecp_MulReduce(t, p->t, z_inv);
+    rotate = fe_IsNegative(t);
+
+    ecp_Copy(x, p->x);
+    ecp_Copy(y, p->y);
+    ecp_Copy(den_inv, den2);
+
+    ecp_MulReduce(t, p->y, _w_I);       /* iy0 */
+    fe_CondCopy(x, t, rotate);
+    ecp_MulReduce(t, p->x, _w_I);       /* ix0 */
+    fe_CondCopy(y, t, rotate);
+    ecp_MulReduce(t, den1, _w_InvSqrtAMinusD);
+    fe_CondCopy(den_inv, t, rotate);
+
+    ecp_MulReduce(t, x, z_inv);
+    fe_CondNeg(y, fe_IsNegative(t));
+
+    ecp_SubReduce(t, p->z, y);
+    ecp_MulReduce(t, den_inv, t);
+    fe_Abs(t);
+    ecp_Mod(t);
+    ecp_WordsToBytes(s, t);
+}
+
+/* RFC 9496 MAP: field element to group element */
+static void r255_Map(Ext_POINT *p, const U_WORD *t)
+{
+    U_WORD r[K_WORDS], u[K_WORDS], v[K_WORDS], s[K_WORDS], s_prime[K_WORDS];
+    U_WORD c[K_WORDS], n[K_WORDS], w0[K_WORDS], w1[K_WORDS], w2[K_WORDS], w3[K_WORDS];
+    U_WORD tmp[K_WORDS], was_square;
+
+    ecp_SqrReduce(r, t);
+    ecp_MulReduce(r, r, _w_I);          /* r = i*t^2 */
+
+    ecp_AddReduce(u, r, _w_One);
+    ecp_MulReduce(u, u, _w_OneMinusDSq);/* u = (r + 1)*(1 - d^2) */
+
+    ecp_MulReduce(v, r, _w_d);
+    ecp_AddReduce(v, v, _w_One);
+    fe_Neg(v, v);                       /* -1 - r*d */
+    ecp_AddReduce(tmp, r, _w_d);
+    ecp_MulReduce(v, v, tmp);           /* v = (-1 - r*d)*(r + d) */
+
+    was_square = fe_SqrtRatioM1(s, u, v);
+
+    ecp_MulReduce(s_prime, s, t);
+    fe_Abs(s_prime);
+    fe_Neg(s_prime, s_prime);           /* s' = -|s*t| */
+    fe_CondCopy(s, s_prime, was_square ^ 1);
+
+    fe_Neg(c, _w_One);
+    fe_CondCopy(c, r, was_square ^ 1);
+
+    ecp_SubReduce(n, r, _w_One);
+    ecp_MulReduce(n, n, c);
+    ecp_MulReduce(n, n, _w_DMinusOneSq);
+    ecp_SubReduce(n, n, v);             /* N = c*(r - 1)*(d - 1)^2 - v */
+
+    ecp_AddReduce(w0, s, s);
+    ecp_MulReduce(w0, w0, v);           /* w0 = 2*s*v */
+    ecp_MulReduce(w1, n, _w_SqrtAdMinusOne);
+    ecp_SqrReduce(tmp, s);
+    ecp_SubReduce(w2, _w_One, tmp);     /* w2 = 1 - s^2 */
+    ecp_AddReduce(w3, _w_One, tmp);     /* w3 = 1 + s^2 */
+
+    ecp_MulReduce(p->x, w0, w3);
+    ecp_MulReduce(p->y, w2, w1);
+    ecp_MulReduce(p->z, w1, w3);
+    ecp_MulReduce(p->t, w0, w2);
+}
+
+/* r = -p */
+static void r255_Negate(Ext_POINT *r, const Ext_POINT *p)
+{
+    fe_Neg(r->x, p->x);
+    ecp_Copy(r->y, p->y);
+    ecp_Copy(r->z, p->z);
+    fe_Neg(r->t, p->t);
+}
+
+/* Select table[index] into r without a secret dependent memory access pattern */
+static void r255_Select(PE_POINT *r, const PE_POINT *table, U_WORD index)
+{
+    U_WORD i;
+    memcpy(r, &table[0], sizeof(PE_POINT));
+    for (i = 1; i < 16; i++)
+    {
+        U_WORD match = ((i ^ index) - 1) >> (sizeof(U_WORD)*8 - 1);
+        fe_CondCopy(r->YpX, table[i].YpX, match);
+        fe_CondCopy(r->YmX, table[i].YmX, match);
+        fe_CondCopy(r->T2d, table[i].T2d, match);
+        fe_CondCopy(r->Z2, table[i].Z2, match);
+    }
+}
+
+/*
+    Constant time fixed-window (4-bit) scalar multiply.
+    Assumptions: k is reduced mod l (k < 2^253)
+    Return: r = k*p
+*/
+static void r255_ScalarMult(Ext_POINT *r, const U_WORD *k, const Ext_POINT *p)
+{
+    PE_POINT table[16], q;
+    Ext_POINT t;
+    uint8_t e[K_BYTES];
+    int i;
+
+    /* table[i] = i*p */
+    r255_SetIdentity(&t);
+    edp_ExtPoint2PE(&table[0], &t);
+    edp_ExtPoint2PE(&table[1], p);
+    memcpy(&t, p, sizeof(Ext_POINT));
+    for (i = 2; i < 16; i++)
+    {
+        edp_AddPoint(&t, &t, &table[1]);
+        edp_ExtPoint2PE(&table[i], &t);
+    }
+
+    ecp_WordsToBytes(e, k);
+
+    r255_SetIdentity(r);
+    for (i = 63; i >= 0; i--)
+    {
+        edp_DoublePoint(r);
+        edp_DoublePoint(r);
+        edp_DoublePoint(r);
+        edp_DoublePoint(r);
+        r255_Select(&q, table, (e[i >> 1] >> ((i & 1) << 2)) & 15);
+        edp_AddPoint(r, r, &q);
+    }
+
+    mem_clear(table, sizeof(table));
+    mem_clear(&q, sizeof(q));
+    mem_clear(&t, sizeof(t));
+    mem_clear(e, sizeof(e));
+}
+
+/* Load a 32 byte scalar, reduced mod l */
+static void r255_LoadScalar(U_WORD *Y, const unsigned char *k)
+{
+    ecp_BytesToWords(Y, k);
+    eco_Mod(Y);
+}
+
+/* -- group API ----------------------------------------------------------- */
+
+int __crawdog_ristretto255_is_valid(const unsigned char *p)
+{
+    Ext_POINT P;
+    return r255_Decode(&P, p);
+}
+
+int __crawdog_ristretto255_add(unsigned char *r, const unsigned char *p, const unsigned char *q)
+{
+    Ext_POINT P, Q;
+    PE_POINT T;
+
+    if (!r255_Decode(&P, p) || !r255_Decode(&Q, q)) return 0;
+
+    edp_ExtPoint2PE(&T, &Q);
+    edp_AddPoint(&P, &P, &T);
+    r255_Encode(r, &P);
+    return 1;
+}
+
+int __crawdog_ristretto255_sub(unsigned char *r, const unsigned char *p, const unsigned char *q)
+{
+    Ext_POINT P, Q, N;
+    PE_POINT T;
+
+    if (!r255_Decode(&P, p) || !r255_Decode(&Q, q)) return 0;
+
+    r255_Negate(&N, &Q);
+    edp_ExtPoint2PE(&T, &N);
+    edp_AddPoint(&P, &P, &T);
+    r255_Encode(r, &P);
+    return 1;
+}
+
+int __crawdog_ristretto255_scalarmult(unsigned char *r, const unsigned char *k, const unsigned char *p)
+{
+    Ext_POINT P, R;
+    U_WORD K[K_WORDS];
+
+    if (!r255_Decode(&P, p)) return 0;
+
+    r255_LoadScalar(K, k);
+    r255_ScalarMult(&R, K, &P);
+    r255_Encode(r, &R);
+
+    mem_clear(K, sizeof(K));
+    mem_clear(&R, sizeof(R));
+    return 1;
+}
+
+void __crawdog_ristretto255_scalarmult_base(unsigned char *r, const unsigned char *k)
+{
+    Ext_POINT S;
+    U_WORD K[K_WORDS];
+
+    /* Same blinded folding path as ed25519 key generation: (k + b)*B + (-b*B) */
+    r255_LoadScalar(K, k);
+    eco_AddReduce(K, K, edp_custom_blinding.bl);
+    edp_BasePointMult(&S, K, edp_custom_blinding.zr);
+    edp_AddPoint(&S, &S, &edp_custom_blinding.BP);
+    r255_Encode(r, &S);
+
+    mem_clear(K, sizeof(K));
+    mem_clear(&S, sizeof(S));
+}
+
+void __crawdog_ristretto255_from_uniform(unsigned char *r, const unsigned char *uniform)
+{
+    Ext_POINT P, Q;
+    PE_POINT T;
+    U_WORD t[K_WORDS];
+
+    ecp_BytesToWords(t, uniform);
+    t[K_WORDS-1] &= ((U_WORD)~0) >> 1;  /* mask the top bit, mod p is implied */
+    r255_Map(&P, t);
+
+    ecp_BytesToWords(t, uniform + 32);
+    t[K_WORDS-1] &= ((U_WORD)~0) >> 1;
+    r255_Map(&Q, t);
+
+    edp_ExtPoint2PE(&T, &Q);
+    edp_AddPoint(&P, &P, &T);
+    r255_Encode(r, &P);
+}
+
+/* sha512 update for sizes above the 32-bit length of __crawdog_sha512_update */
+static void r255_HashUpdate(struct __crawdog_sha512_context *H, const unsigned char *data, size_t size)
+{
+    while (size > 0x80000000)
+    {
+        __crawdog_sha512_update(H, data, 0x80000000);
+        data += 0x80000000;
+        size -= 0x80000000;
+    }
+    __crawdog_sha512_update(H, data, (uint32_t)size);
+}
+
+int __crawdog_ristretto255_expand_message_xmd(
+    unsigned char *out,
+    size_t out_size,
+    const unsigned char *msg,
+    size_t msg_size,
+    const unsigned char *dst,
+    size_t dst_size)
+{
+    struct __crawdog_sha512_context H;
+    uint8_t b0[__CRAWDOG_SHA512_HASH_SIZE], bi[__CRAWDOG_SHA512_HASH_SIZE];
+    uint8_t zpad[__CRAWDOG_SHA512_BLOCK_SIZE] = { 0 };
+    uint8_t lib_str[3], dst_len, i;
+    size_t ell, n, j;
+
+    ell = (out_size + __CRAWDOG_SHA512_HASH_SIZE - 1) / __CRAWDOG_SHA512_HASH_SIZE;
+    if (ell > 255 || out_size > 65535 || dst_size > 255) return 0;
+
+    dst_len = (uint8_t)dst_size;
+    lib_str[0] = (uint8_t)(out_size >> 8);
+    lib_str[1] = (uint8_t)out_size;
+    lib_str[2] = 0;
+
+    /* b_0 = H(Z_pad || msg || l_i_b_str || 0 || DST_prime) */
+    __crawdog_sha512_init(&H);
+    __crawdog_sha512_update(&H, zpad, sizeof(zpad));
+    r255_HashUpdate(&H, msg, msg_size);
+    __crawdog_sha512_update(&H, lib_str, 3);
+    __crawdog_sha512_update(&H, dst, dst_len);
+    __crawdog_sha512_update(&H, &dst_len, 1);
+    __crawdog_sha512_finish(&H, (__crawdog_sha512_output*)&b0);
+
+    /* b_i = H((b_0 xor b_(i-1)) || i || DST_prime), b_1 = H(b_0 || 1 || DST_prime) */
+    memset(bi, 0, sizeof(bi));
+    for (i = 1; out_size > 0; i++)
+    {
+        for (j = 0; j < sizeof(bi); j++) bi[j] ^= b0[j];
+        __crawdog_sha512_init(&H);
+        __crawdog_sha512_update(&H, bi, sizeof(bi));
+        __crawdog_sha512_update(&H, &i, 1);
+        __crawdog_sha512_update(&H, dst, dst_len);
+        __crawdog_sha512_update(&H, &dst_len, 1);
+        __crawdog_sha512_finish(&H, (__crawdog_sha512_output*)&bi);
+
+        n = (out_size < sizeof(bi)) ? out_size : sizeof(bi);
+        memcpy(out, bi, n);
+        out += n;
+        out_size -= n;
+    }
+
+    mem_clear(b0, sizeof(b0));
+    mem_clear(bi, sizeof(bi));
+    mem_clear(&H, sizeof(H));
+    return 1;
+}
+
+int __crawdog_ristretto255_hash_to_group(
+    unsigned char *r,
+    const unsigned char *msg,
+    size_t msg_size,
+    const unsigned char *dst,
+    size_t dst_size)
+{
+    uint8_t uniform[__CRAWDOG_RISTRETTO255_UNIFORM_SIZE];
+
+    if (!__crawdog_ristretto255_expand_message_xmd(uniform, sizeof(uniform), msg, msg_size, dst, dst_size)) return 0;
+    __crawdog_ristretto255_from_uniform(r, uniform);
+    return 1;
+}
+
+/* -- scalar API ---------------------------------------------------------- */
+
+int __crawdog_ristretto255_scalar_is_canonical(const unsigned char *s)
+{
+    U_WORD S[K_WORDS];
+    ecp_BytesToWords(S, s);
+    return ecp_CmpLT(S, _w_BPO) != 0;
+}
+
+void __crawdog_ristretto255_scalar_reduce(unsigned char *r, const unsigned char *s)
+{
+    U_WORD R[K_WORDS];
+    eco_DigestToWords(R, s);
+    eco_Mod(R);
+    ecp_WordsToBytes(r, R);
+    mem_clear(R, sizeof(R));
+}
+
+void __crawdog_ristretto255_scalar_add(unsigned char *r, const unsigned char *a, const unsigned char *b)
+{
+    U_WORD A[K_WORDS], B[K_WORDS];
+    r255_LoadScalar(A, a);
+    r255_LoadScalar(B, b);
+    eco_AddReduce(A, A, B);
+    eco_Mod(A);
+    ecp_WordsToBytes(r, A);
+    mem_clear(A, sizeof(A));
+    mem_clear(B, sizeof(B));
+}
+
+void __crawdog_ristretto255_scalar_negate(unsigned char *r, const unsigned char *a)
+{
+    U_WORD A[K_WORDS];
+    r255_LoadScalar(A, a);
+    ecp_Sub(A, _w_BPO, A);              /* l - a, a = 0 yields l */
+    eco_Mod(A);
+    ecp_WordsToBytes(r, A);
+    mem_clear(A, sizeof(A));
+}
+
+void __crawdog_ristretto255_scalar_sub(unsigned char *r, const unsigned char *a, const unsigned char *b)
+{
+    U_WORD A[K_WORDS], B[K_WORDS];
+    r255_LoadScalar(A, a);
+    r255_LoadScalar(B, b);
+    ecp_Sub(B, _w_BPO, B);
+    eco_AddReduce(A, A, B);
+    eco_Mod(A);
+    ecp_WordsToBytes(r, A);
+    mem_clear(A, sizeof(A));
+    mem_clear(B, sizeof(B));
+}
+
+void __crawdog_ristretto255_scalar_mul(unsigned char *r, const unsigned char *a, const unsigned char *b)
+{
+    U_WORD A[K_WORDS], B[K_WORDS];
+    r255_LoadScalar(A, a);
+    r255_LoadScalar(B, b);
+    eco_MulReduce(A, A, B);
+    eco_Mod(A);
+    ecp_WordsToBytes(r, A);
+    mem_clear(A, sizeof(A));
+    mem_clear(B, sizeof(B));
+}
+
+int __crawdog_ristretto255_scalar_invert(unsigned char *r, const unsigned char *a)
+{
+    U_WORD A[K_WORDS], Y[K_WORDS];
+    int i;
+
+    r255_LoadScalar(A, a);
+
+    /* Y = a^(l-2), the exponent is public so square-and-multiply leaks nothing about a */
+    ecp_SetValue(Y, 1);
+    for (i = 252; i >= 0; i--)
+    {
+        eco_MulReduce(Y, Y, Y);
+        if ((_b_BPOm2[i >> 3] >> (i & 7)) & 1) eco_MulReduce(Y, Y, A);
+    }
+    eco_Mod(Y);
+    ecp_WordsToBytes(r, Y);
+
+    i = ecp_CmpNE(A, _w_Zero) != 0;
+    mem_clear(A, sizeof(A));
+    mem_clear(Y, sizeof(Y));
+    return i;
+}
+
+int __crawdog_ristretto255_hash_to_scalar(
+    unsigned char *r,
+    const unsigned char *msg,
+    size_t msg_size,
+    const unsigned char *dst,
+    size_t dst_size)
+{
+    uint8_t uniform[__CRAWDOG_RISTRETTO255_UNIFORM_SIZE];
+
+    if (!__crawdog_ristretto255_expand_message_xmd(uniform, sizeof(uniform), msg, msg_size, dst, dst_size)) return 0;
+    __crawdog_ristretto255_scalar_reduce(r, uniform);
+    mem_clear(uniform, sizeof(uniform));
+    return 1;
+}
@@ -5,6 +5,7 @@
 #define __CRAWDOG_ED25519_SIGNATURE_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 /* -- ed25519-sign ------------------------------------------------------------- */
 
@@ -36,6 +37,66 @@ void *__crawdog_ed25519_blinding_init(
 void __crawdog_ed25519_blinding_finish(
     void *context);                     /* IN: blinding context */
 
+/* -- ed25519-sign-pool -------------------------------------------------------- */
+
+/*  Create a pool of independently seeded blinding contexts for concurrent signing.
+    Pass 0 slots to size the pool by the number of online processors.
+    Every slot requests a refresh after refresh_interval signatures (0 = never).
+    Returns null on failure.
+*/
+void *__crawdog_ed25519_signing_pool_init(
+    size_t slots,                       /* IN: number of blinding contexts (0 = cpu count) */
+    const unsigned char *seed,          /* IN: [size bytes] random blinding seed */
+    size_t size,                        /* IN: size of blinding seed */
+    uint64_t refresh_interval);         /* IN: signatures per context between refreshes */
+
+/* Number of blinding contexts held by the pool */
+size_t __crawdog_ed25519_signing_pool_size(
+    const void *context);               /* IN: signing pool */
+
+/*  Sign a message with any available blinding context of the pool. Thread safe.
+    Returns 1 when the slot that was used is due for __crawdog_ed25519_signing_pool_refresh, 0 otherwise.
+*/
+int __crawdog_ed25519_signing_pool_sign(
+    void *context,                      /* IN: signing pool */
+    unsigned char *signature,           /* OUT:[64 bytes] signature (R,S) */
+    const unsigned char *privKey,       /* IN: [64 bytes] private key (sk,pk) */
+    const unsigned char *msg,           /* IN: [msg_size bytes] message to sign */
+    size_t msg_size,                    /* IN: size of message */
+    size_t *slot_used);                 /* OUT: [optional] index of the slot that signed */
+
+/*  Replace the blinding context of one slot with a freshly seeded one. Thread safe.
+    The new context is built before the slot is locked, signers are never held up by the seeding.
+    Returns 1 for SUCCESS and 0 for FAILURE
+*/
+int __crawdog_ed25519_signing_pool_refresh(
+    void *context,                      /* IN: signing pool */
+    size_t slot,                        /* IN: slot index */
+    const unsigned char *seed,          /* IN: [size bytes] random blinding seed */
+    size_t size);                       /* IN: size of blinding seed */
+
+/* Clear and free the pool and all of its blinding contexts */
+void __crawdog_ed25519_signing_pool_finish(
+    void *context);                     /* IN: signing pool */
+
+/* -- ed25519-msm -------------------------------------------------------------- */
+
+#define __CRAWDOG_ED25519_MSM_AUTO            0   /* pick by number of points */
+#define __CRAWDOG_ED25519_MSM_STRAUS          1
+#define __CRAWDOG_ED25519_MSM_PIPPENGER       2
+
+/*  Multi-scalar multiplication: r = SUM(scalars[i]*points[i]) for i = 0 .. count-1
+    Scalars are 32 byte little-endian numbers and are used as given (not reduced mod l).
+    Runs in variable time, inputs are treated as public.
+    Returns 1 for SUCCESS and 0 when a point does not decode or memory can not be allocated.
+*/
+int __crawdog_ed25519_multi_scalar_mult(
+    unsigned char *r,                   /* OUT:[32 bytes] encoded point */
+    const unsigned char *scalars,       /* IN: [count*32 bytes] scalars */
+    const unsigned char *points,        /* IN: [count*32 bytes] encoded points */
+    size_t count,                       /* IN: number of scalar/point pairs */
+    int method);                        /* IN: __CRAWDOG_ED25519_MSM_* */
+
 /* -- ed25519-verify ----------------------------------------------------------- */
 
 /*  Single-phased signature validation.
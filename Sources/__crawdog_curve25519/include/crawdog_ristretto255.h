@@ -0,0 +1,125 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+#ifndef __CRAWDOG_RISTRETTO255_H
+#define __CRAWDOG_RISTRETTO255_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* -- ristretto255 (RFC 9496) ------------------------------------------------- */
+
+#define __CRAWDOG_RISTRETTO255_ELEMENT_SIZE     32
+#define __CRAWDOG_RISTRETTO255_SCALAR_SIZE      32
+#define __CRAWDOG_RISTRETTO255_UNIFORM_SIZE     64
+
+/* Return 1 when p is the canonical encoding of a group element, 0 otherwise */
+int __crawdog_ristretto255_is_valid(
+    const unsigned char *p);            /* IN: [32 bytes] encoded element */
+
+/*  Calculate r = p + q
+    Returns 1 for SUCCESS and 0 when either input is not a valid encoding
+*/
+int __crawdog_ristretto255_add(
+    unsigned char *r,                   /* OUT:[32 bytes] encoded element */
+    const unsigned char *p,             /* IN: [32 bytes] encoded element */
+    const unsigned char *q);            /* IN: [32 bytes] encoded element */
+
+/*  Calculate r = p - q
+    Returns 1 for SUCCESS and 0 when either input is not a valid encoding
+*/
+int __crawdog_ristretto255_sub(
+    unsigned char *r,                   /* OUT:[32 bytes] encoded element */
+    const unsigned char *p,             /* IN: [32 bytes] encoded element */
+    const unsigned char *q);            /* IN: [32 bytes] encoded element */
+
+/*  Calculate r = k*p in constant time (k is reduced mod l first)
+    Returns 1 for SUCCESS and 0 when p is not a valid encoding
+*/
+int __crawdog_ristretto255_scalarmult(
+    unsigned char *r,                   /* OUT:[32 bytes] encoded element */
+    const unsigned char *k,             /* IN: [32 bytes] scalar */
+    const unsigned char *p);            /* IN: [32 bytes] encoded element */
+
+/* Calculate r = k*B where B is the ristretto255 generator (k is reduced mod l first) */
+void __crawdog_ristretto255_scalarmult_base(
+    unsigned char *r,                   /* OUT:[32 bytes] encoded element */
+    const unsigned char *k);            /* IN: [32 bytes] scalar */
+
+/* Map 64 uniformly random bytes to a group element (RFC 9496 element derivation) */
+void __crawdog_ristretto255_from_uniform(
+    unsigned char *r,                   /* OUT:[32 bytes] encoded element */
+    const unsigned char *uniform);      /* IN: [64 bytes] uniform bytes */
+
+/*  RFC 9380 expand_message_xmd using SHA-512
+    Returns 1 for SUCCESS and 0 when out_size > 16320 or dst_size > 255
+*/
+int __crawdog_ristretto255_expand_message_xmd(
+    unsigned char *out,                 /* OUT:[out_size bytes] uniform bytes */
+    size_t out_size,                    /* IN: number of bytes to produce */
+    const unsigned char *msg,           /* IN: [msg_size bytes] message */
+    size_t msg_size,                    /* IN: size of message */
+    const unsigned char *dst,           /* IN: [dst_size bytes] domain separation tag */
+    size_t dst_size);                   /* IN: size of domain separation tag */
+
+/*  Hash a message to a group element (ristretto255_XMD:SHA-512_R255MAP_RO_)
+    Returns 1 for SUCCESS and 0 when dst_size > 255
+*/
+int __crawdog_ristretto255_hash_to_group(
+    unsigned char *r,                   /* OUT:[32 bytes] encoded element */
+    const unsigned char *msg,           /* IN: [msg_size bytes] message */
+    size_t msg_size,                    /* IN: size of message */
+    const unsigned char *dst,           /* IN: [dst_size bytes] domain separation tag */
+    size_t dst_size);                   /* IN: size of domain separation tag */
+
+/* -- ristretto255 scalars (mod l) -------------------------------------------- */
+
+/* Return 1 when s is fully reduced mod l, 0 otherwise */
+int __crawdog_ristretto255_scalar_is_canonical(
+    const unsigned char *s);            /* IN: [32 bytes] scalar */
+
+/* r = s mod l, where s is a 512-bit little-endian number */
+void __crawdog_ristretto255_scalar_reduce(
+    unsigned char *r,                   /* OUT:[32 bytes] scalar */
+    const unsigned char *s);            /* IN: [64 bytes] wide scalar */
+
+/* r = a + b mod l */
+void __crawdog_ristretto255_scalar_add(
+    unsigned char *r,                   /* OUT:[32 bytes] scalar */
+    const unsigned char *a,             /* IN: [32 bytes] scalar */
+    const unsigned char *b);            /* IN: [32 bytes] scalar */
+
+/* r = a - b mod l */
+void __crawdog_ristretto255_scalar_sub(
+    unsigned char *r,                   /* OUT:[32 bytes] scalar */
+    const unsigned char *a,             /* IN: [32 bytes] scalar */
+    const unsigned char *b);            /* IN: [32 bytes] scalar */
+
+/* r = a * b mod l */
+void __crawdog_ristretto255_scalar_mul(
+    unsigned char *r,                   /* OUT:[32 bytes] scalar */
+    const unsigned char *a,             /* IN: [32 bytes] scalar */
+    const unsigned char *b);            /* IN: [32 bytes] scalar */
+
+/* r = -a mod l */
+void __crawdog_ristretto255_scalar_negate(
+    unsigned char *r,                   /* OUT:[32 bytes] scalar */
+    const unsigned char *a);            /* IN: [32 bytes] scalar */
+
+/*  r = 1/a mod l (constant time)
+    Returns 1 for SUCCESS and 0 when a = 0 mod l
+*/
+int __crawdog_ristretto255_scalar_invert(
+    unsigned char *r,                   /* OUT:[32 bytes] scalar */
+    const unsigned char *a);            /* IN: [32 bytes] scalar */
+
+/*  Hash a message to a scalar: expand_message_xmd(SHA-512) to 64 bytes, reduced mod l
+    Returns 1 for SUCCESS and 0 when dst_size > 255
+*/
+int __crawdog_ristretto255_hash_to_scalar(
+    unsigned char *r,                   /* OUT:[32 bytes] scalar */
+    const unsigned char *msg,           /* IN: [msg_size bytes] message */
+    size_t msg_size,                    /* IN: size of message */
+    const unsigned char *dst,           /* IN: [dst_size bytes] domain separation tag */
+    size_t dst_size);                   /* IN: size of domain separation tag */
+
+#endif // __CRAWDOG_RISTRETTO255_H
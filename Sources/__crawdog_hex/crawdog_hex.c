@@ -0,0 +1,362 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+#include "crawdog_hex.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CRAWDOG_HEX_HAVE_X86
+#include <immintrin.h>
+#define SSSE3_TARGET __attribute__((target("ssse3")))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define CRAWDOG_HEX_HAVE_NEON
+#include <arm_neon.h>
+#endif
+
+/* -- tables --------------------------------------------------------------------- */
+
+const char __crawdog_hex_digits[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+static const char _upper[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+
+/* nibble values of both cases, 0xFF for every other character */
+const uint8_t __crawdog_hex_values[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+/* -- vector kernels ------------------------------------------------------------ */
+
+/*
+    Every kernel works on whole blocks and returns the number of input bytes
+    it consumed, leaving the rest to the scalar codec.
+
+    Encoding splits every byte into its two nibbles, maps both through a 16
+    entry shuffle and interleaves the results.
+
+    Decoding folds letters to lower case, classifies every character as a
+    digit or a letter with unsigned range comparisons and subtracts the
+    matching offset. A block with an invalid character stops the kernel so
+    that the scalar codec can report the exact offset. Pairs of nibbles are
+    then merged with one multiply-add and packed back to bytes.
+
+    In constant time mode the kernels never stop early. Invalid lanes are
+    OR-ed into an accumulator that is only inspected once the whole input
+    has been decoded.
+*/
+
+#ifdef CRAWDOG_HEX_HAVE_X86
+
+static int _x86_level = -1;            /* 0 = none, 1 = ssse3, 2 = avx2 */
+
+static int x86_level(void)
+{
+    if (_x86_level < 0)
+    {
+        __builtin_cpu_init();
+        _x86_level = __builtin_cpu_supports("avx2") ? 2 : (__builtin_cpu_supports("ssse3") ? 1 : 0);
+    }
+    return _x86_level;
+}
+
+SSSE3_TARGET static size_t encode_ssse3(char *out, const uint8_t *src, size_t len, const char *digits)
+{
+    const __m128i lut = _mm_loadu_si128((const __m128i *)digits);
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    size_t i = 0;
+    while (len - i >= 16)
+    {
+        const __m128i in = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(in, 4), mask));
+        const __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(in, mask));
+        _mm_storeu_si128((__m128i *)(out + i * 2), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i *)(out + i * 2 + 16), _mm_unpackhi_epi8(hi, lo));
+        i += 16;
+    }
+    return i;
+}
+
+AVX2_TARGET static size_t encode_avx2(char *out, const uint8_t *src, size_t len, const char *digits)
+{
+    const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)digits));
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    size_t i = 0;
+    while (len - i >= 32)
+    {
+        const __m256i in = _mm256_loadu_si256((const __m256i *)(src + i));
+        const __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(in, 4), mask));
+        const __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(in, mask));
+        /* the unpacks interleave within each 128 bit lane, the permutes put the lanes back in order */
+        const __m256i first = _mm256_unpacklo_epi8(hi, lo);
+        const __m256i second = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256((__m256i *)(out + i * 2), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256((__m256i *)(out + i * 2 + 32), _mm256_permute2x128_si256(first, second, 0x31));
+        i += 32;
+    }
+    return i;
+}
+
+/* all ones in every lane where (c - lo) is below n, unsigned */
+#define IN_RANGE_128(c, lo, n) \
+    _mm_cmpeq_epi8(_mm_min_epu8(_mm_sub_epi8((c), _mm_set1_epi8(lo)), _mm_set1_epi8((n) - 1)), _mm_sub_epi8((c), _mm_set1_epi8(lo)))
+#define IN_RANGE_256(c, lo, n) \
+    _mm256_cmpeq_epi8(_mm256_min_epu8(_mm256_sub_epi8((c), _mm256_set1_epi8(lo)), _mm256_set1_epi8((n) - 1)), _mm256_sub_epi8((c), _mm256_set1_epi8(lo)))
+
+/* map 16 characters to nibbles, clearing *valid in every lane that is not a hex digit */
+SSSE3_TARGET static inline __m128i nibbles_128(__m128i c, __m128i *valid)
+{
+    const __m128i folded = _mm_or_si128(c, _mm_set1_epi8(0x20));
+    const __m128i digit = IN_RANGE_128(c, '0', 10);
+    const __m128i letter = IN_RANGE_128(folded, 'a', 6);
+    *valid = _mm_and_si128(*valid, _mm_or_si128(digit, letter));
+    return _mm_or_si128(
+        _mm_and_si128(digit, _mm_sub_epi8(c, _mm_set1_epi8('0'))),
+        _mm_and_si128(letter, _mm_sub_epi8(folded, _mm_set1_epi8('a' - 10))));
+}
+
+AVX2_TARGET static inline __m256i nibbles_256(__m256i c, __m256i *valid)
+{
+    const __m256i folded = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+    const __m256i digit = IN_RANGE_256(c, '0', 10);
+    const __m256i letter = IN_RANGE_256(folded, 'a', 6);
+    *valid = _mm256_and_si256(*valid, _mm256_or_si256(digit, letter));
+    return _mm256_or_si256(
+        _mm256_and_si256(digit, _mm256_sub_epi8(c, _mm256_set1_epi8('0'))),
+        _mm256_and_si256(letter, _mm256_sub_epi8(folded, _mm256_set1_epi8('a' - 10))));
+}
+
+SSSE3_TARGET static size_t decode_ssse3(uint8_t *out, const char *src, size_t len, int constant_time, uint32_t *invalid)
+{
+    /* every pair of nibbles becomes high * 16 + low */
+    const __m128i merge = _mm_set1_epi16(0x0110);
+    __m128i all_valid = _mm_set1_epi8(-1);
+    size_t i = 0;
+    while (len - i >= 32)
+    {
+        __m128i valid = _mm_set1_epi8(-1);
+        const __m128i a = nibbles_128(_mm_loadu_si128((const __m128i *)(src + i)), &valid);
+        const __m128i b = nibbles_128(_mm_loadu_si128((const __m128i *)(src + i + 16)), &valid);
+        if (!constant_time && _mm_movemask_epi8(valid) != 0xFFFF)
+        {
+            break;
+        }
+        all_valid = _mm_and_si128(all_valid, valid);
+        const __m128i packed = _mm_packus_epi16(_mm_maddubs_epi16(a, merge), _mm_maddubs_epi16(b, merge));
+        _mm_storeu_si128((__m128i *)(out + i / 2), packed);
+        i += 32;
+    }
+    *invalid |= (uint32_t)_mm_movemask_epi8(all_valid) ^ 0xFFFFu;
+    return i;
+}
+
+AVX2_TARGET static size_t decode_avx2(uint8_t *out, const char *src, size_t len, int constant_time, uint32_t *invalid)
+{
+    const __m256i merge = _mm256_set1_epi16(0x0110);
+    __m256i all_valid = _mm256_set1_epi8(-1);
+    size_t i = 0;
+    while (len - i >= 64)
+    {
+        __m256i valid = _mm256_set1_epi8(-1);
+        const __m256i a = nibbles_256(_mm256_loadu_si256((const __m256i *)(src + i)), &valid);
+        const __m256i b = nibbles_256(_mm256_loadu_si256((const __m256i *)(src + i + 32)), &valid);
+        if (!constant_time && (uint32_t)_mm256_movemask_epi8(valid) != 0xFFFFFFFFu)
+        {
+            break;
+        }
+        all_valid = _mm256_and_si256(all_valid, valid);
+        /* the pack interleaves 64 bit quarters of a and b within each lane, the permute puts them back in order */
+        const __m256i packed = _mm256_packus_epi16(_mm256_maddubs_epi16(a, merge), _mm256_maddubs_epi16(b, merge));
+        _mm256_storeu_si256((__m256i *)(out + i / 2), _mm256_permute4x64_epi64(packed, 0xD8));
+        i += 64;
+    }
+    *invalid |= (uint32_t)_mm256_movemask_epi8(all_valid) ^ 0xFFFFFFFFu;
+    return i;
+}
+
+static size_t encode_vector(char *out, const uint8_t *src, size_t len, const char *digits)
+{
+    switch (x86_level())
+    {
+    case 2: return encode_avx2(out, src, len, digits);
+    case 1: return encode_ssse3(out, src, len, digits);
+    default: return 0;
+    }
+}
+
+static size_t decode_vector(uint8_t *out, const char *src, size_t len, int constant_time, uint32_t *invalid)
+{
+    size_t i = 0;
+    switch (x86_level())
+    {
+    case 2:
+        i = decode_avx2(out, src, len, constant_time, invalid);
+        /* the avx2 kernel leaves up to 63 characters, finish whole 32 character blocks with ssse3 */
+        return i + decode_ssse3(out + i / 2, src + i, len - i, constant_time, invalid);
+    case 1: return decode_ssse3(out, src, len, constant_time, invalid);
+    default: return 0;
+    }
+}
+
+#elif defined(CRAWDOG_HEX_HAVE_NEON)
+
+static size_t encode_vector(char *out, const uint8_t *src, size_t len, const char *digits)
+{
+    const uint8x16_t lut = vld1q_u8((const uint8_t *)digits);
+    const uint8x16_t mask = vdupq_n_u8(0x0F);
+    size_t i = 0;
+    while (len - i >= 16)
+    {
+        const uint8x16_t in = vld1q_u8(src + i);
+        uint8x16x2_t result;
+        result.val[0] = vqtbl1q_u8(lut, vshrq_n_u8(in, 4));
+        result.val[1] = vqtbl1q_u8(lut, vandq_u8(in, mask));
+        vst2q_u8((uint8_t *)out + i * 2, result);
+        i += 16;
+    }
+    return i;
+}
+
+/* map 16 characters to nibbles, clearing *valid in every lane that is not a hex digit */
+static inline uint8x16_t neon_nibbles(uint8x16_t c, uint8x16_t *valid)
+{
+    const uint8x16_t digit_value = vsubq_u8(c, vdupq_n_u8('0'));
+    const uint8x16_t letter_value = vsubq_u8(vorrq_u8(c, vdupq_n_u8(0x20)), vdupq_n_u8('a' - 10));
+    const uint8x16_t digit = vcltq_u8(digit_value, vdupq_n_u8(10));
+    const uint8x16_t letter = vcltq_u8(vsubq_u8(letter_value, vdupq_n_u8(10)), vdupq_n_u8(6));
+    *valid = vandq_u8(*valid, vorrq_u8(digit, letter));
+    return vorrq_u8(vandq_u8(digit, digit_value), vandq_u8(letter, letter_value));
+}
+
+static size_t decode_vector(uint8_t *out, const char *src, size_t len, int constant_time, uint32_t *invalid)
+{
+    uint8x16_t all_valid = vdupq_n_u8(0xFF);
+    size_t i = 0;
+    while (len - i >= 32)
+    {
+        const uint8x16x2_t c = vld2q_u8((const uint8_t *)src + i);
+        uint8x16_t valid = vdupq_n_u8(0xFF);
+        const uint8x16_t hi = neon_nibbles(c.val[0], &valid);
+        const uint8x16_t lo = neon_nibbles(c.val[1], &valid);
+        if (!constant_time && vminvq_u8(valid) == 0)
+        {
+            break;
+        }
+        all_valid = vandq_u8(all_valid, valid);
+        vst1q_u8(out + i / 2, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+        i += 32;
+    }
+    *invalid |= (uint32_t)vminvq_u8(all_valid) ^ 0xFFu;
+    return i;
+}
+
+#else
+
+static size_t encode_vector(char *out, const uint8_t *src, size_t len, const char *digits)
+{
+    (void)out; (void)src; (void)len; (void)digits;
+    return 0;
+}
+
+static size_t decode_vector(uint8_t *out, const char *src, size_t len, int constant_time, uint32_t *invalid)
+{
+    (void)out; (void)src; (void)len; (void)constant_time; (void)invalid;
+    return 0;
+}
+
+#endif
+
+/* -- constant time scalar codec --------------------------------------------------- */
+
+/* all ones when lo <= c <= hi, zero otherwise */
+static inline uint32_t ct_range_mask(uint32_t c, uint32_t lo, uint32_t hi)
+{
+    /* either difference wraps around to set the top bit when c is out of range */
+    return (((c - lo) | (hi - c)) >> 31) - 1;
+}
+
+/* the nibble value of a character, OR-ing all ones into *invalid when it is not a hex digit */
+static inline uint32_t ct_nibble(uint8_t character, uint32_t *invalid)
+{
+    const uint32_t c = character;
+    const uint32_t folded = c | 0x20;
+    const uint32_t digit = ct_range_mask(c, '0', '9');
+    const uint32_t letter = ct_range_mask(folded, 'a', 'f');
+    *invalid |= ~(digit | letter);
+    return ((digit & (c - '0')) | (letter & (folded - 'a' + 10))) & 0x0F;
+}
+
+/* -- public interface ------------------------------------------------------------ */
+
+size_t __crawdog_hex_encode(char *out, const uint8_t *src, size_t len, int flags)
+{
+    const char *digits = (flags & __CRAWDOG_HEX_UPPERCASE) ? _upper : __crawdog_hex_digits;
+    size_t i = encode_vector(out, src, len, digits);
+    for (; i < len; i++)
+    {
+        out[i * 2] = digits[src[i] >> 4];
+        out[i * 2 + 1] = digits[src[i] & 0x0F];
+    }
+    return len * 2;
+}
+
+static int decode_constant_time(uint8_t *out, const char *src, size_t len, size_t *error_offset)
+{
+    uint32_t invalid = 0;
+    size_t i = decode_vector(out, src, len, 1, &invalid);
+    for (; i < len; i += 2)
+    {
+        const uint32_t hi = ct_nibble((uint8_t)src[i], &invalid);
+        const uint32_t lo = ct_nibble((uint8_t)src[i + 1], &invalid);
+        out[i / 2] = (uint8_t)((hi << 4) | lo);
+    }
+    if (invalid == 0)
+    {
+        return __CRAWDOG_HEX_OK;
+    }
+    /* the input is rejected. the partial output is zeroed and the position of the offending character is not searched for, so nothing about the input escapes */
+    for (i = 0; i < len / 2; i++)
+    {
+        ((volatile uint8_t *)out)[i] = 0;
+    }
+    *error_offset = len;
+    return __CRAWDOG_HEX_INVALID_CHARACTER;
+}
+
+int __crawdog_hex_decode(uint8_t *out, const char *src, size_t len, int flags, size_t *error_offset)
+{
+    if (len & 1)
+    {
+        *error_offset = len;
+        return __CRAWDOG_HEX_INVALID_LENGTH;
+    }
+    if (flags & __CRAWDOG_HEX_CONSTANT_TIME)
+    {
+        return decode_constant_time(out, src, len, error_offset);
+    }
+    uint32_t invalid = 0;
+    size_t i = decode_vector(out, src, len, 0, &invalid);
+    for (; i < len; i += 2)
+    {
+        const uint8_t hi = __crawdog_hex_values[(uint8_t)src[i]];
+        const uint8_t lo = __crawdog_hex_values[(uint8_t)src[i + 1]];
+        if ((hi | lo) & 0x80)
+        {
+            *error_offset = (hi & 0x80) ? i : i + 1;
+            return __CRAWDOG_HEX_INVALID_CHARACTER;
+        }
+        out[i / 2] = (uint8_t)((hi << 4) | lo);
+    }
+    return __CRAWDOG_HEX_OK;
+}
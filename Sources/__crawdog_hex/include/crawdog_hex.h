@@ -0,0 +1,71 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+#ifndef __CRAWDOG_HEX_H
+#define __CRAWDOG_HEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+    Bulk hex (base16) codec.
+
+    Contiguous buffers are encoded 16 or 32 bytes at a time and decoded 32
+    or 64 characters at a time with SSSE3 or AVX2 (selected at runtime on
+    x86-64) or NEON (aarch64). Nibbles are mapped to characters with a
+    register shuffle, and characters are validated and mapped back with
+    range comparisons. The tail of every buffer goes through a table driven
+    scalar codec. The decoder accepts both cases and rejects everything
+    else, and the input must have an even number of characters.
+
+    With __CRAWDOG_HEX_CONSTANT_TIME the decoder neither branches nor reads
+    tables on character values. Nibbles are computed arithmetically and
+    invalid characters are accumulated until the whole input is decoded, so
+    the time taken depends only on the length. Rejected input zeroes the
+    output before returning, and the offending character is not located.
+*/
+
+#define __CRAWDOG_HEX_OK                        0
+#define __CRAWDOG_HEX_INVALID_CHARACTER         -1  /* error_offset is the offending character, or len in constant time */
+#define __CRAWDOG_HEX_INVALID_LENGTH            -2  /* the input has an odd number of characters */
+
+#define __CRAWDOG_HEX_UPPERCASE                 0x1 /* encode with 'A' to 'F' instead of 'a' to 'f' */
+#define __CRAWDOG_HEX_CONSTANT_TIME             0x2 /* decode without data dependent branches or table lookups */
+
+/*  The lowercase digits, and the nibble value of every character of either case (0xFF for every other character)
+    Constant data, so that single characters convert without any table being built at run time
+*/
+extern const char __crawdog_hex_digits[16];
+extern const uint8_t __crawdog_hex_values[256];
+
+/* Return the lowercase digit for the low 4 bits of value */
+static inline char __crawdog_hex_digit(uint8_t value)
+{
+    return __crawdog_hex_digits[value & 0x0F];
+}
+
+/* Return the nibble value of a hex digit of either case, or 0xFF */
+static inline uint8_t __crawdog_hex_value(uint8_t character)
+{
+    return __crawdog_hex_values[character];
+}
+
+/*  Encode len bytes into 2 * len characters
+    Returns the number of characters written
+*/
+size_t __crawdog_hex_encode(
+    char *out,                          /* OUT:[2 * len] characters */
+    const uint8_t *src,                 /* IN: [len] bytes to encode */
+    size_t len,
+    int flags);
+
+/*  Decode len characters into len / 2 bytes
+    Returns __CRAWDOG_HEX_OK or one of the error codes
+*/
+int __crawdog_hex_decode(
+    uint8_t *out,                       /* OUT:[len / 2] bytes */
+    const char *src,                    /* IN: [len] characters to decode */
+    size_t len,
+    int flags,
+    size_t *error_offset);              /* OUT: offset of the offending character on error, len in constant time */
+
+#endif // __CRAWDOG_HEX_H
@@ -5,6 +5,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <sys/uio.h>
 
 #define __CRAWDOG_MD5_HASH_SIZE				16
 #define __CRAWDOG_MD5_BLOCK_SIZE			16
@@ -29,6 +30,9 @@ void __crawdog_md5_init(__crawdog_md5_context* Context);
 
 void __crawdog_md5_update(__crawdog_md5_context* Context, void const* Buffer, uint32_t BufferSize);
 
+// update the hasher with a chain of fragments, in order. partial blocks carry over between fragments.
+void __crawdog_md5_updatev(__crawdog_md5_context* Context, struct iovec const* Vectors, size_t VectorCount);
+
 void __crawdog_md5_finish(__crawdog_md5_context* Context, __crawdog_md5_output* Digest);
 
 #endif // __CRAWDOG_MD5_H
\ No newline at end of file
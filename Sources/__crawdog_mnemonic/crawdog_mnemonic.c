@@ -0,0 +1,437 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+#include "crawdog_mnemonic.h"
+
+#include <string.h>
+
+/* -- perfect hash ------------------------------------------------------------------ */
+
+/* FNV-1a */
+static uint32_t word_hash(const char *word, size_t len)
+{
+    uint32_t h = 0x811C9DC5u;
+    for (size_t i = 0; i < len; i++)
+    {
+        h ^= (uint8_t)word[i];
+        h *= 0x01000193u;
+    }
+    return h;
+}
+
+/* the murmur3 finalizer, so that every displacement moves the slot of a word somewhere unrelated */
+static uint32_t slot_mix(uint32_t h)
+{
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/* the bucket and slot counts of packed images */
+#define PACK_BUCKETS 512
+#define PACK_SLOTS 4096
+
+static uint32_t slot_of(uint32_t h, uint16_t displacement, uint32_t slot_count)
+{
+    return slot_mix(h ^ displacement) & (slot_count - 1);
+}
+
+/* -- packed images ----------------------------------------------------------------- */
+
+static const char _magic[8] = { 'R', 'A', 'W', 'B', 'I', 'P', '3', '9' };
+
+static uint32_t load32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void store32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static void store16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static int is_power_of_two(uint32_t v)
+{
+    return v != 0 && (v & (v - 1)) == 0;
+}
+
+/*
+    The perfect hash is built greedily: buckets are placed from the largest
+    to the smallest, and every bucket takes the first displacement that
+    moves all of its words to free, distinct slots. With four slots per
+    word a displacement is found within a handful of tries.
+*/
+static int build_hash(uint16_t *displacements, uint16_t *slots, const char *words, const uint16_t *offsets)
+{
+    uint32_t hashes[__CRAWDOG_MNEMONIC_WORD_COUNT];
+    uint16_t bucket_sizes[PACK_BUCKETS] = { 0 };
+    uint16_t members[__CRAWDOG_MNEMONIC_WORD_COUNT];
+    uint16_t largest = 0;
+    for (uint32_t i = 0; i < __CRAWDOG_MNEMONIC_WORD_COUNT; i++)
+    {
+        hashes[i] = word_hash(words + offsets[i], (size_t)(offsets[i + 1] - offsets[i]));
+        const uint16_t size = ++bucket_sizes[hashes[i] & (PACK_BUCKETS - 1)];
+        largest = (size > largest) ? size : largest;
+    }
+    memset(slots, 0, PACK_SLOTS * sizeof(uint16_t));
+    memset(displacements, 0, PACK_BUCKETS * sizeof(uint16_t));
+    for (uint16_t size = largest; size > 0; size--)
+    {
+        for (uint32_t bucket = 0; bucket < PACK_BUCKETS; bucket++)
+        {
+            if (bucket_sizes[bucket] != size)
+            {
+                continue;
+            }
+            uint16_t count = 0;
+            for (uint16_t i = 0; i < __CRAWDOG_MNEMONIC_WORD_COUNT; i++)
+            {
+                if ((hashes[i] & (PACK_BUCKETS - 1)) == bucket)
+                {
+                    members[count++] = i;
+                }
+            }
+            uint32_t displacement = 0;
+            for (; displacement <= 0xFFFF; displacement++)
+            {
+                uint16_t placed = 0;
+                for (; placed < count; placed++)
+                {
+                    const uint32_t slot = slot_of(hashes[members[placed]], (uint16_t)displacement, PACK_SLOTS);
+                    if (slots[slot] != 0)
+                    {
+                        break;
+                    }
+                    slots[slot] = members[placed] + 1;
+                }
+                if (placed == count)
+                {
+                    break;
+                }
+                /* undo the partial placement and try the next displacement */
+                while (placed > 0)
+                {
+                    placed--;
+                    slots[slot_of(hashes[members[placed]], (uint16_t)displacement, PACK_SLOTS)] = 0;
+                }
+            }
+            if (displacement > 0xFFFF)
+            {
+                return -1;
+            }
+            displacements[bucket] = (uint16_t)displacement;
+        }
+    }
+    return 0;
+}
+
+/* -- public interface ------------------------------------------------------------ */
+
+int __crawdog_mnemonic_wordlist_open(__crawdog_mnemonic_wordlist *list, const void *packed, size_t len)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    /* the uint16 tables are used in place, so they must match the host */
+    (void)list; (void)packed; (void)len;
+    return __CRAWDOG_MNEMONIC_PACKED_INVALID;
+#else
+    const uint8_t *p = (const uint8_t *)packed;
+    if (len < __CRAWDOG_MNEMONIC_PACKED_HEADER_LENGTH || ((uintptr_t)p & 1) != 0 || memcmp(p, _magic, sizeof(_magic)) != 0)
+    {
+        return __CRAWDOG_MNEMONIC_PACKED_INVALID;
+    }
+    const uint32_t word_count = load32(p + 8);
+    const uint32_t bucket_count = load32(p + 12);
+    const uint32_t slot_count = load32(p + 16);
+    const uint32_t max_word_length = load32(p + 20);
+    const uint32_t separator_length = load32(p + 24);
+    const uint32_t words_length = load32(p + 36);
+    if (word_count != __CRAWDOG_MNEMONIC_WORD_COUNT || !is_power_of_two(bucket_count) || bucket_count > 0x10000 || !is_power_of_two(slot_count) || slot_count > 0x10000
+        || separator_length == 0 || separator_length > __CRAWDOG_MNEMONIC_MAX_SEPARATOR_LENGTH || words_length > 0xFFFF)
+    {
+        return __CRAWDOG_MNEMONIC_PACKED_INVALID;
+    }
+    const size_t tables = (size_t)(word_count + 1 + bucket_count + slot_count) * sizeof(uint16_t);
+    if (len - __CRAWDOG_MNEMONIC_PACKED_HEADER_LENGTH < tables || len - __CRAWDOG_MNEMONIC_PACKED_HEADER_LENGTH - tables < words_length)
+    {
+        return __CRAWDOG_MNEMONIC_PACKED_INVALID;
+    }
+    const uint16_t *offsets = (const uint16_t *)(p + __CRAWDOG_MNEMONIC_PACKED_HEADER_LENGTH);
+    const uint16_t *displacements = offsets + word_count + 1;
+    const uint16_t *slots = displacements + bucket_count;
+    if (offsets[0] != 0 || offsets[word_count] != words_length)
+    {
+        return __CRAWDOG_MNEMONIC_PACKED_INVALID;
+    }
+    uint32_t longest = 0;
+    for (uint32_t i = 0; i < word_count; i++)
+    {
+        if (offsets[i + 1] <= offsets[i])
+        {
+            return __CRAWDOG_MNEMONIC_PACKED_INVALID;
+        }
+        const uint32_t length = (uint32_t)(offsets[i + 1] - offsets[i]);
+        longest = (length > longest) ? length : longest;
+    }
+    for (uint32_t i = 0; i < slot_count; i++)
+    {
+        if (slots[i] > word_count)
+        {
+            return __CRAWDOG_MNEMONIC_PACKED_INVALID;
+        }
+    }
+    if (longest != max_word_length)
+    {
+        return __CRAWDOG_MNEMONIC_PACKED_INVALID;
+    }
+    list->words = (const char *)(slots + slot_count);
+    list->offsets = offsets;
+    list->displacements = displacements;
+    list->slots = slots;
+    list->bucket_count = bucket_count;
+    list->slot_count = slot_count;
+    list->max_word_length = max_word_length;
+    list->separator = (const char *)(p + 28);
+    list->separator_length = separator_length;
+    return __CRAWDOG_MNEMONIC_OK;
+#endif
+}
+
+size_t __crawdog_mnemonic_packed_length(size_t words_length)
+{
+    return __CRAWDOG_MNEMONIC_PACKED_HEADER_LENGTH + (__CRAWDOG_MNEMONIC_WORD_COUNT + 1 + PACK_BUCKETS + PACK_SLOTS) * sizeof(uint16_t) + words_length;
+}
+
+size_t __crawdog_mnemonic_wordlist_pack(uint8_t *out, size_t out_len, const char *words, const uint16_t *offsets, const char *separator, size_t separator_length)
+{
+    const uint16_t words_length = offsets[__CRAWDOG_MNEMONIC_WORD_COUNT];
+    const size_t packed_length = __crawdog_mnemonic_packed_length(words_length);
+    if (out_len < packed_length || separator_length == 0 || separator_length > __CRAWDOG_MNEMONIC_MAX_SEPARATOR_LENGTH || offsets[0] != 0)
+    {
+        return 0;
+    }
+    uint32_t longest = 0;
+    for (uint32_t i = 0; i < __CRAWDOG_MNEMONIC_WORD_COUNT; i++)
+    {
+        if (offsets[i + 1] <= offsets[i])
+        {
+            return 0;
+        }
+        const uint32_t length = (uint32_t)(offsets[i + 1] - offsets[i]);
+        longest = (length > longest) ? length : longest;
+    }
+    uint16_t displacements[PACK_BUCKETS];
+    uint16_t slots[PACK_SLOTS];
+    /* a repeated word always lands in the same slot as its twin, so no displacement places it */
+    if (build_hash(displacements, slots, words, offsets) != 0)
+    {
+        return 0;
+    }
+    memcpy(out, _magic, sizeof(_magic));
+    store32(out + 8, __CRAWDOG_MNEMONIC_WORD_COUNT);
+    store32(out + 12, PACK_BUCKETS);
+    store32(out + 16, PACK_SLOTS);
+    store32(out + 20, longest);
+    store32(out + 24, (uint32_t)separator_length);
+    memset(out + 28, 0, __CRAWDOG_MNEMONIC_MAX_SEPARATOR_LENGTH);
+    memcpy(out + 28, separator, separator_length);
+    store32(out + 36, words_length);
+    uint8_t *table = out + __CRAWDOG_MNEMONIC_PACKED_HEADER_LENGTH;
+    for (uint32_t i = 0; i <= __CRAWDOG_MNEMONIC_WORD_COUNT; i++, table += 2)
+    {
+        store16(table, offsets[i]);
+    }
+    for (uint32_t i = 0; i < PACK_BUCKETS; i++, table += 2)
+    {
+        store16(table, displacements[i]);
+    }
+    for (uint32_t i = 0; i < PACK_SLOTS; i++, table += 2)
+    {
+        store16(table, slots[i]);
+    }
+    memcpy(table, words, words_length);
+    return packed_length;
+}
+
+int __crawdog_mnemonic_lookup(const __crawdog_mnemonic_wordlist *list, const char *word, size_t len)
+{
+    if (len == 0 || len > list->max_word_length)
+    {
+        return -1;
+    }
+    const uint32_t h = word_hash(word, len);
+    const uint16_t displacement = list->displacements[h & (list->bucket_count - 1)];
+    const uint16_t slot = list->slots[slot_of(h, displacement, list->slot_count)];
+    if (slot == 0)
+    {
+        return -1;
+    }
+    const uint16_t start = list->offsets[slot - 1];
+    const uint16_t end = list->offsets[slot];
+    if ((size_t)(end - start) != len || memcmp(list->words + start, word, len) != 0)
+    {
+        return -1;
+    }
+    return slot - 1;
+}
+
+const char *__crawdog_mnemonic_word(const __crawdog_mnemonic_wordlist *list, uint16_t index, size_t *len)
+{
+    *len = (size_t)(list->offsets[index + 1] - list->offsets[index]);
+    return list->words + list->offsets[index];
+}
+
+void __crawdog_mnemonic_split(uint16_t *indices, const uint8_t *data, size_t word_count)
+{
+    /* at most 7 + 8 bits are held between words */
+    uint32_t acc = 0;
+    unsigned bits = 0;
+    for (size_t w = 0; w < word_count; w++)
+    {
+        while (bits < 11)
+        {
+            acc = (acc << 8) | *data++;
+            bits += 8;
+        }
+        bits -= 11;
+        indices[w] = (uint16_t)((acc >> bits) & 0x7FF);
+    }
+}
+
+void __crawdog_mnemonic_join(uint8_t *data, const uint16_t *indices, size_t word_count)
+{
+    /* at most 7 + 11 bits are held between bytes */
+    uint32_t acc = 0;
+    unsigned bits = 0;
+    for (size_t w = 0; w < word_count; w++)
+    {
+        acc = (acc << 11) | (indices[w] & 0x7FF);
+        bits += 11;
+        while (bits >= 8)
+        {
+            bits -= 8;
+            *data++ = (uint8_t)(acc >> bits);
+        }
+    }
+    if (bits > 0)
+    {
+        *data = (uint8_t)(acc << (8 - bits));
+    }
+}
+
+/* the word indices are as secret as the entropy that they encode. the volatile stores keep the compiler from dropping the clear of a buffer that is about to go out of scope */
+static void zero_indices(uint16_t *indices)
+{
+    for (size_t i = 0; i < __CRAWDOG_MNEMONIC_MAX_SENTENCE_WORDS; i++)
+    {
+        ((volatile uint16_t *)indices)[i] = 0;
+    }
+}
+
+size_t __crawdog_mnemonic_encode(const __crawdog_mnemonic_wordlist *list, char *out, size_t out_len, const uint8_t *data, size_t word_count)
+{
+    uint16_t indices[__CRAWDOG_MNEMONIC_MAX_SENTENCE_WORDS];
+    if (word_count > __CRAWDOG_MNEMONIC_MAX_SENTENCE_WORDS)
+    {
+        return 0;
+    }
+    __crawdog_mnemonic_split(indices, data, word_count);
+    size_t written = 0;
+    for (size_t w = 0; w < word_count; w++)
+    {
+        size_t len;
+        const char *word = __crawdog_mnemonic_word(list, indices[w], &len);
+        const size_t separator_length = (w > 0) ? list->separator_length : 0;
+        if (out_len - written < separator_length + len)
+        {
+            written = 0;
+            break;
+        }
+        memcpy(out + written, list->separator, separator_length);
+        memcpy(out + written + separator_length, word, len);
+        written += separator_length + len;
+    }
+    zero_indices(indices);
+    return written;
+}
+
+/* the length of the separator at the start of s, or 0. an ASCII space always separates words, as it is the NFKD form of every BIP39 separator */
+static size_t separator_at(const __crawdog_mnemonic_wordlist *list, const char *s, size_t len)
+{
+    if (s[0] == ' ')
+    {
+        return 1;
+    }
+    if (len >= list->separator_length && memcmp(s, list->separator, list->separator_length) == 0)
+    {
+        return list->separator_length;
+    }
+    return 0;
+}
+
+/* the end of the word that starts at start: the next separator or the end of the sentence. writes the length of that separator, or 0 at the end */
+static size_t word_end(const __crawdog_mnemonic_wordlist *list, const char *sentence, size_t len, size_t start, size_t *separator_length)
+{
+    size_t end = start;
+    *separator_length = 0;
+    while (end < len && (*separator_length = separator_at(list, sentence + end, len - end)) == 0)
+    {
+        end++;
+    }
+    return end;
+}
+
+int __crawdog_mnemonic_decode(const __crawdog_mnemonic_wordlist *list, uint8_t *data, size_t *word_count, const char *sentence, size_t len, size_t *error_offset, size_t *error_length)
+{
+    uint16_t indices[__CRAWDOG_MNEMONIC_MAX_SENTENCE_WORDS];
+    size_t count = 0;
+    size_t start = 0;
+    size_t separator_length;
+    *word_count = 0;
+    if (len == 0)
+    {
+        return __CRAWDOG_MNEMONIC_WORD_COUNT_INVALID;
+    }
+    while (start <= len)
+    {
+        const size_t end = word_end(list, sentence, len, start, &separator_length);
+        if (count == __CRAWDOG_MNEMONIC_MAX_SENTENCE_WORDS)
+        {
+            /* count the rest of the words, so that the caller can report how many the sentence has */
+            while (start <= len)
+            {
+                const size_t next = word_end(list, sentence, len, start, &separator_length);
+                count++;
+                start = next + ((next < len) ? separator_length : 1);
+            }
+            *word_count = count;
+            zero_indices(indices);
+            return __CRAWDOG_MNEMONIC_WORD_COUNT_INVALID;
+        }
+        const int index = __crawdog_mnemonic_lookup(list, sentence + start, end - start);
+        if (index < 0)
+        {
+            *error_offset = start;
+            *error_length = end - start;
+            zero_indices(indices);
+            return __CRAWDOG_MNEMONIC_UNKNOWN_WORD;
+        }
+        indices[count++] = (uint16_t)index;
+        /* past the end when the sentence did not end with a separator */
+        start = end + ((end < len) ? separator_length : 1);
+    }
+    __crawdog_mnemonic_join(data, indices, count);
+    zero_indices(indices);
+    *word_count = count;
+    return __CRAWDOG_MNEMONIC_OK;
+}
@@ -0,0 +1,688 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+/* the english word list of Sources/RAW_mnemonic/wordlist_EN.txt, with the tables that __crawdog_mnemonic_wordlist_pack builds for it. the mnemonic tests pack the text file and check that these tables match. */
+#include "crawdog_mnemonic.h"
+
+/* every word back to back, in word list order */
+static const char _words[] =
+    "abandon" "ability" "able" "about" "above" "absent" "absorb" "abstract" "absurd" "abuse"
+    "access" "accident" "account" "accuse" "achieve" "acid" "acoustic" "acquire" "across" "act"
+    "action" "actor" "actress" "actual" "adapt" "add" "addict" "address" "adjust" "admit" "adult"
+    "advance" "advice" "aerobic" "affair" "afford" "afraid" "again" "age" "agent" "agree" "ahead"
+    "aim" "air" "airport" "aisle" "alarm" "album" "alcohol" "alert" "alien" "all" "alley" "allow"
+    "almost" "alone" "alpha" "already" "also" "alter" "always" "amateur" "amazing" "among" "amount"
+    "amused" "analyst" "anchor" "ancient" "anger" "angle" "angry" "animal" "ankle" "announce"
+    "annual" "another" "answer" "antenna" "antique" "anxiety" "any" "apart" "apology" "appear"
+    "apple" "approve" "april" "arch" "arctic" "area" "arena" "argue" "arm" "armed" "armor" "army"
+    "around" "arrange" "arrest" "arrive" "arrow" "art" "artefact" "artist" "artwork" "ask" "aspect"
+    "assault" "asset" "assist" "assume" "asthma" "athlete" "atom" "attack" "attend" "attitude"
+    "attract" "auction" "audit" "august" "aunt" "author" "auto" "autumn" "average" "avocado" "avoid"
+    "awake" "aware" "away" "awesome" "awful" "awkward" "axis" "baby" "bachelor" "bacon" "badge"
+    "bag" "balance" "balcony" "ball" "bamboo" "banana" "banner" "bar" "barely" "bargain" "barrel"
+    "base" "basic" "basket" "battle" "beach" "bean" "beauty" "because" "become" "beef" "before"
+    "begin" "behave" "behind" "believe" "below" "belt" "bench" "benefit" "best" "betray" "better"
+    "between" "beyond" "bicycle" "bid" "bike" "bind" "biology" "bird" "birth" "bitter" "black"
+    "blade" "blame" "blanket" "blast" "bleak" "bless" "blind" "blood" "blossom" "blouse" "blue"
+    "blur" "blush" "board" "boat" "body" "boil" "bomb" "bone" "bonus" "book" "boost" "border"
+    "boring" "borrow" "boss" "bottom" "bounce" "box" "boy" "bracket" "brain" "brand" "brass" "brave"
+    "bread" "breeze" "brick" "bridge" "brief" "bright" "bring" "brisk" "broccoli" "broken" "bronze"
+    "broom" "brother" "brown" "brush" "bubble" "buddy" "budget" "buffalo" "build" "bulb" "bulk"
+    "bullet" "bundle" "bunker" "burden" "burger" "burst" "bus" "business" "busy" "butter" "buyer"
+    "buzz" "cabbage" "cabin" "cable" "cactus" "cage" "cake" "call" "calm" "camera" "camp" "can"
+    "canal" "cancel" "candy" "cannon" "canoe" "canvas" "canyon" "capable" "capital" "captain" "car"
+    "carbon" "card" "cargo" "carpet" "carry" "cart" "case" "cash" "casino" "castle" "casual" "cat"
+    "catalog" "catch" "category" "cattle" "caught" "cause" "caution" "cave" "ceiling" "celery"
+    "cement" "census" "century" "cereal" "certain" "chair" "chalk" "champion" "change" "chaos"
+    "chapter" "charge" "chase" "chat" "cheap" "check" "cheese" "chef" "cherry" "chest" "chicken"
+    "chief" "child" "chimney" "choice" "choose" "chronic" "chuckle" "chunk" "churn" "cigar"
+    "cinnamon" "circle" "citizen" "city" "civil" "claim" "clap" "clarify" "claw" "clay" "clean"
+    "clerk" "clever" "click" "client" "cliff" "climb" "clinic" "clip" "clock" "clog" "close" "cloth"
+    "cloud" "clown" "club" "clump" "cluster" "clutch" "coach" "coast" "coconut" "code" "coffee"
+    "coil" "coin" "collect" "color" "column" "combine" "come" "comfort" "comic" "common" "company"
+    "concert" "conduct" "confirm" "congress" "connect" "consider" "control" "convince" "cook" "cool"
+    "copper" "copy" "coral" "core" "corn" "correct" "cost" "cotton" "couch" "country" "couple"
+    "course" "cousin" "cover" "coyote" "crack" "cradle" "craft" "cram" "crane" "crash" "crater"
+    "crawl" "crazy" "cream" "credit" "creek" "crew" "cricket" "crime" "crisp" "critic" "crop"
+    "cross" "crouch" "crowd" "crucial" "cruel" "cruise" "crumble" "crunch" "crush" "cry" "crystal"
+    "cube" "culture" "cup" "cupboard" "curious" "current" "curtain" "curve" "cushion" "custom"
+    "cute" "cycle" "dad" "damage" "damp" "dance" "danger" "daring" "dash" "daughter" "dawn" "day"
+    "deal" "debate" "debris" "decade" "december" "decide" "decline" "decorate" "decrease" "deer"
+    "defense" "define" "defy" "degree" "delay" "deliver" "demand" "demise" "denial" "dentist" "deny"
+    "depart" "depend" "deposit" "depth" "deputy" "derive" "describe" "desert" "design" "desk"
+    "despair" "destroy" "detail" "detect" "develop" "device" "devote" "diagram" "dial" "diamond"
+    "diary" "dice" "diesel" "diet" "differ" "digital" "dignity" "dilemma" "dinner" "dinosaur"
+    "direct" "dirt" "disagree" "discover" "disease" "dish" "dismiss" "disorder" "display" "distance"
+    "divert" "divide" "divorce" "dizzy" "doctor" "document" "dog" "doll" "dolphin" "domain" "donate"
+    "donkey" "donor" "door" "dose" "double" "dove" "draft" "dragon" "drama" "drastic" "draw" "dream"
+    "dress" "drift" "drill" "drink" "drip" "drive" "drop" "drum" "dry" "duck" "dumb" "dune" "during"
+    "dust" "dutch" "duty" "dwarf" "dynamic" "eager" "eagle" "early" "earn" "earth" "easily" "east"
+    "easy" "echo" "ecology" "economy" "edge" "edit" "educate" "effort" "egg" "eight" "either"
+    "elbow" "elder" "electric" "elegant" "element" "elephant" "elevator" "elite" "else" "embark"
+    "embody" "embrace" "emerge" "emotion" "employ" "empower" "empty" "enable" "enact" "end"
+    "endless" "endorse" "enemy" "energy" "enforce" "engage" "engine" "enhance" "enjoy" "enlist"
+    "enough" "enrich" "enroll" "ensure" "enter" "entire" "entry" "envelope" "episode" "equal"
+    "equip" "era" "erase" "erode" "erosion" "error" "erupt" "escape" "essay" "essence" "estate"
+    "eternal" "ethics" "evidence" "evil" "evoke" "evolve" "exact" "example" "excess" "exchange"
+    "excite" "exclude" "excuse" "execute" "exercise" "exhaust" "exhibit" "exile" "exist" "exit"
+    "exotic" "expand" "expect" "expire" "explain" "expose" "express" "extend" "extra" "eye"
+    "eyebrow" "fabric" "face" "faculty" "fade" "faint" "faith" "fall" "false" "fame" "family"
+    "famous" "fan" "fancy" "fantasy" "farm" "fashion" "fat" "fatal" "father" "fatigue" "fault"
+    "favorite" "feature" "february" "federal" "fee" "feed" "feel" "female" "fence" "festival"
+    "fetch" "fever" "few" "fiber" "fiction" "field" "figure" "file" "film" "filter" "final" "find"
+    "fine" "finger" "finish" "fire" "firm" "first" "fiscal" "fish" "fit" "fitness" "fix" "flag"
+    "flame" "flash" "flat" "flavor" "flee" "flight" "flip" "float" "flock" "floor" "flower" "fluid"
+    "flush" "fly" "foam" "focus" "fog" "foil" "fold" "follow" "food" "foot" "force" "forest"
+    "forget" "fork" "fortune" "forum" "forward" "fossil" "foster" "found" "fox" "fragile" "frame"
+    "frequent" "fresh" "friend" "fringe" "frog" "front" "frost" "frown" "frozen" "fruit" "fuel"
+    "fun" "funny" "furnace" "fury" "future" "gadget" "gain" "galaxy" "gallery" "game" "gap" "garage"
+    "garbage" "garden" "garlic" "garment" "gas" "gasp" "gate" "gather" "gauge" "gaze" "general"
+    "genius" "genre" "gentle" "genuine" "gesture" "ghost" "giant" "gift" "giggle" "ginger" "giraffe"
+    "girl" "give" "glad" "glance" "glare" "glass" "glide" "glimpse" "globe" "gloom" "glory" "glove"
+    "glow" "glue" "goat" "goddess" "gold" "good" "goose" "gorilla" "gospel" "gossip" "govern" "gown"
+    "grab" "grace" "grain" "grant" "grape" "grass" "gravity" "great" "green" "grid" "grief" "grit"
+    "grocery" "group" "grow" "grunt" "guard" "guess" "guide" "guilt" "guitar" "gun" "gym" "habit"
+    "hair" "half" "hammer" "hamster" "hand" "happy" "harbor" "hard" "harsh" "harvest" "hat" "have"
+    "hawk" "hazard" "head" "health" "heart" "heavy" "hedgehog" "height" "hello" "helmet" "help"
+    "hen" "hero" "hidden" "high" "hill" "hint" "hip" "hire" "history" "hobby" "hockey" "hold" "hole"
+    "holiday" "hollow" "home" "honey" "hood" "hope" "horn" "horror" "horse" "hospital" "host"
+    "hotel" "hour" "hover" "hub" "huge" "human" "humble" "humor" "hundred" "hungry" "hunt" "hurdle"
+    "hurry" "hurt" "husband" "hybrid" "ice" "icon" "idea" "identify" "idle" "ignore" "ill" "illegal"
+    "illness" "image" "imitate" "immense" "immune" "impact" "impose" "improve" "impulse" "inch"
+    "include" "income" "increase" "index" "indicate" "indoor" "industry" "infant" "inflict" "inform"
+    "inhale" "inherit" "initial" "inject" "injury" "inmate" "inner" "innocent" "input" "inquiry"
+    "insane" "insect" "inside" "inspire" "install" "intact" "interest" "into" "invest" "invite"
+    "involve" "iron" "island" "isolate" "issue" "item" "ivory" "jacket" "jaguar" "jar" "jazz"
+    "jealous" "jeans" "jelly" "jewel" "job" "join" "joke" "journey" "joy" "judge" "juice" "jump"
+    "jungle" "junior" "junk" "just" "kangaroo" "keen" "keep" "ketchup" "key" "kick" "kid" "kidney"
+    "kind" "kingdom" "kiss" "kit" "kitchen" "kite" "kitten" "kiwi" "knee" "knife" "knock" "know"
+    "lab" "label" "labor" "ladder" "lady" "lake" "lamp" "language" "laptop" "large" "later" "latin"
+    "laugh" "laundry" "lava" "law" "lawn" "lawsuit" "layer" "lazy" "leader" "leaf" "learn" "leave"
+    "lecture" "left" "leg" "legal" "legend" "leisure" "lemon" "lend" "length" "lens" "leopard"
+    "lesson" "letter" "level" "liar" "liberty" "library" "license" "life" "lift" "light" "like"
+    "limb" "limit" "link" "lion" "liquid" "list" "little" "live" "lizard" "load" "loan" "lobster"
+    "local" "lock" "logic" "lonely" "long" "loop" "lottery" "loud" "lounge" "love" "loyal" "lucky"
+    "luggage" "lumber" "lunar" "lunch" "luxury" "lyrics" "machine" "mad" "magic" "magnet" "maid"
+    "mail" "main" "major" "make" "mammal" "man" "manage" "mandate" "mango" "mansion" "manual"
+    "maple" "marble" "march" "margin" "marine" "market" "marriage" "mask" "mass" "master" "match"
+    "material" "math" "matrix" "matter" "maximum" "maze" "meadow" "mean" "measure" "meat" "mechanic"
+    "medal" "media" "melody" "melt" "member" "memory" "mention" "menu" "mercy" "merge" "merit"
+    "merry" "mesh" "message" "metal" "method" "middle" "midnight" "milk" "million" "mimic" "mind"
+    "minimum" "minor" "minute" "miracle" "mirror" "misery" "miss" "mistake" "mix" "mixed" "mixture"
+    "mobile" "model" "modify" "mom" "moment" "monitor" "monkey" "monster" "month" "moon" "moral"
+    "more" "morning" "mosquito" "mother" "motion" "motor" "mountain" "mouse" "move" "movie" "much"
+    "muffin" "mule" "multiply" "muscle" "museum" "mushroom" "music" "must" "mutual" "myself"
+    "mystery" "myth" "naive" "name" "napkin" "narrow" "nasty" "nation" "nature" "near" "neck" "need"
+    "negative" "neglect" "neither" "nephew" "nerve" "nest" "net" "network" "neutral" "never" "news"
+    "next" "nice" "night" "noble" "noise" "nominee" "noodle" "normal" "north" "nose" "notable"
+    "note" "nothing" "notice" "novel" "now" "nuclear" "number" "nurse" "nut" "oak" "obey" "object"
+    "oblige" "obscure" "observe" "obtain" "obvious" "occur" "ocean" "october" "odor" "off" "offer"
+    "office" "often" "oil" "okay" "old" "olive" "olympic" "omit" "once" "one" "onion" "online"
+    "only" "open" "opera" "opinion" "oppose" "option" "orange" "orbit" "orchard" "order" "ordinary"
+    "organ" "orient" "original" "orphan" "ostrich" "other" "outdoor" "outer" "output" "outside"
+    "oval" "oven" "over" "own" "owner" "oxygen" "oyster" "ozone" "pact" "paddle" "page" "pair"
+    "palace" "palm" "panda" "panel" "panic" "panther" "paper" "parade" "parent" "park" "parrot"
+    "party" "pass" "patch" "path" "patient" "patrol" "pattern" "pause" "pave" "payment" "peace"
+    "peanut" "pear" "peasant" "pelican" "pen" "penalty" "pencil" "people" "pepper" "perfect"
+    "permit" "person" "pet" "phone" "photo" "phrase" "physical" "piano" "picnic" "picture" "piece"
+    "pig" "pigeon" "pill" "pilot" "pink" "pioneer" "pipe" "pistol" "pitch" "pizza" "place" "planet"
+    "plastic" "plate" "play" "please" "pledge" "pluck" "plug" "plunge" "poem" "poet" "point" "polar"
+    "pole" "police" "pond" "pony" "pool" "popular" "portion" "position" "possible" "post" "potato"
+    "pottery" "poverty" "powder" "power" "practice" "praise" "predict" "prefer" "prepare" "present"
+    "pretty" "prevent" "price" "pride" "primary" "print" "priority" "prison" "private" "prize"
+    "problem" "process" "produce" "profit" "program" "project" "promote" "proof" "property"
+    "prosper" "protect" "proud" "provide" "public" "pudding" "pull" "pulp" "pulse" "pumpkin" "punch"
+    "pupil" "puppy" "purchase" "purity" "purpose" "purse" "push" "put" "puzzle" "pyramid" "quality"
+    "quantum" "quarter" "question" "quick" "quit" "quiz" "quote" "rabbit" "raccoon" "race" "rack"
+    "radar" "radio" "rail" "rain" "raise" "rally" "ramp" "ranch" "random" "range" "rapid" "rare"
+    "rate" "rather" "raven" "raw" "razor" "ready" "real" "reason" "rebel" "rebuild" "recall"
+    "receive" "recipe" "record" "recycle" "reduce" "reflect" "reform" "refuse" "region" "regret"
+    "regular" "reject" "relax" "release" "relief" "rely" "remain" "remember" "remind" "remove"
+    "render" "renew" "rent" "reopen" "repair" "repeat" "replace" "report" "require" "rescue"
+    "resemble" "resist" "resource" "response" "result" "retire" "retreat" "return" "reunion"
+    "reveal" "review" "reward" "rhythm" "rib" "ribbon" "rice" "rich" "ride" "ridge" "rifle" "right"
+    "rigid" "ring" "riot" "ripple" "risk" "ritual" "rival" "river" "road" "roast" "robot" "robust"
+    "rocket" "romance" "roof" "rookie" "room" "rose" "rotate" "rough" "round" "route" "royal"
+    "rubber" "rude" "rug" "rule" "run" "runway" "rural" "sad" "saddle" "sadness" "safe" "sail"
+    "salad" "salmon" "salon" "salt" "salute" "same" "sample" "sand" "satisfy" "satoshi" "sauce"
+    "sausage" "save" "say" "scale" "scan" "scare" "scatter" "scene" "scheme" "school" "science"
+    "scissors" "scorpion" "scout" "scrap" "screen" "script" "scrub" "sea" "search" "season" "seat"
+    "second" "secret" "section" "security" "seed" "seek" "segment" "select" "sell" "seminar"
+    "senior" "sense" "sentence" "series" "service" "session" "settle" "setup" "seven" "shadow"
+    "shaft" "shallow" "share" "shed" "shell" "sheriff" "shield" "shift" "shine" "ship" "shiver"
+    "shock" "shoe" "shoot" "shop" "short" "shoulder" "shove" "shrimp" "shrug" "shuffle" "shy"
+    "sibling" "sick" "side" "siege" "sight" "sign" "silent" "silk" "silly" "silver" "similar"
+    "simple" "since" "sing" "siren" "sister" "situate" "six" "size" "skate" "sketch" "ski" "skill"
+    "skin" "skirt" "skull" "slab" "slam" "sleep" "slender" "slice" "slide" "slight" "slim" "slogan"
+    "slot" "slow" "slush" "small" "smart" "smile" "smoke" "smooth" "snack" "snake" "snap" "sniff"
+    "snow" "soap" "soccer" "social" "sock" "soda" "soft" "solar" "soldier" "solid" "solution"
+    "solve" "someone" "song" "soon" "sorry" "sort" "soul" "sound" "soup" "source" "south" "space"
+    "spare" "spatial" "spawn" "speak" "special" "speed" "spell" "spend" "sphere" "spice" "spider"
+    "spike" "spin" "spirit" "split" "spoil" "sponsor" "spoon" "sport" "spot" "spray" "spread"
+    "spring" "spy" "square" "squeeze" "squirrel" "stable" "stadium" "staff" "stage" "stairs" "stamp"
+    "stand" "start" "state" "stay" "steak" "steel" "stem" "step" "stereo" "stick" "still" "sting"
+    "stock" "stomach" "stone" "stool" "story" "stove" "strategy" "street" "strike" "strong"
+    "struggle" "student" "stuff" "stumble" "style" "subject" "submit" "subway" "success" "such"
+    "sudden" "suffer" "sugar" "suggest" "suit" "summer" "sun" "sunny" "sunset" "super" "supply"
+    "supreme" "sure" "surface" "surge" "surprise" "surround" "survey" "suspect" "sustain" "swallow"
+    "swamp" "swap" "swarm" "swear" "sweet" "swift" "swim" "swing" "switch" "sword" "symbol"
+    "symptom" "syrup" "system" "table" "tackle" "tag" "tail" "talent" "talk" "tank" "tape" "target"
+    "task" "taste" "tattoo" "taxi" "teach" "team" "tell" "ten" "tenant" "tennis" "tent" "term"
+    "test" "text" "thank" "that" "theme" "then" "theory" "there" "they" "thing" "this" "thought"
+    "three" "thrive" "throw" "thumb" "thunder" "ticket" "tide" "tiger" "tilt" "timber" "time" "tiny"
+    "tip" "tired" "tissue" "title" "toast" "tobacco" "today" "toddler" "toe" "together" "toilet"
+    "token" "tomato" "tomorrow" "tone" "tongue" "tonight" "tool" "tooth" "top" "topic" "topple"
+    "torch" "tornado" "tortoise" "toss" "total" "tourist" "toward" "tower" "town" "toy" "track"
+    "trade" "traffic" "tragic" "train" "transfer" "trap" "trash" "travel" "tray" "treat" "tree"
+    "trend" "trial" "tribe" "trick" "trigger" "trim" "trip" "trophy" "trouble" "truck" "true"
+    "truly" "trumpet" "trust" "truth" "try" "tube" "tuition" "tumble" "tuna" "tunnel" "turkey"
+    "turn" "turtle" "twelve" "twenty" "twice" "twin" "twist" "two" "type" "typical" "ugly"
+    "umbrella" "unable" "unaware" "uncle" "uncover" "under" "undo" "unfair" "unfold" "unhappy"
+    "uniform" "unique" "unit" "universe" "unknown" "unlock" "until" "unusual" "unveil" "update"
+    "upgrade" "uphold" "upon" "upper" "upset" "urban" "urge" "usage" "use" "used" "useful" "useless"
+    "usual" "utility" "vacant" "vacuum" "vague" "valid" "valley" "valve" "van" "vanish" "vapor"
+    "various" "vast" "vault" "vehicle" "velvet" "vendor" "venture" "venue" "verb" "verify" "version"
+    "very" "vessel" "veteran" "viable" "vibrant" "vicious" "victory" "video" "view" "village"
+    "vintage" "violin" "virtual" "virus" "visa" "visit" "visual" "vital" "vivid" "vocal" "voice"
+    "void" "volcano" "volume" "vote" "voyage" "wage" "wagon" "wait" "walk" "wall" "walnut" "want"
+    "warfare" "warm" "warrior" "wash" "wasp" "waste" "water" "wave" "way" "wealth" "weapon" "wear"
+    "weasel" "weather" "web" "wedding" "weekend" "weird" "welcome" "west" "wet" "whale" "what"
+    "wheat" "wheel" "when" "where" "whip" "whisper" "wide" "width" "wife" "wild" "will" "win"
+    "window" "wine" "wing" "wink" "winner" "winter" "wire" "wisdom" "wise" "wish" "witness" "wolf"
+    "woman" "wonder" "wood" "wool" "word" "work" "world" "worry" "worth" "wrap" "wreck" "wrestle"
+    "wrist" "write" "wrong" "yard" "year" "yellow" "you" "young" "youth" "zebra" "zero" "zone" "zoo";
+
+/* the byte offset of every word in _words, followed by the total length */
+static const uint16_t _offsets[2049] = {
+        0,     7,    14,    18,    23,    28,    34,    40,    48,    54,    59,    65,
+       73,    80,    86,    93,    97,   105,   112,   118,   121,   127,   132,   139,
+      145,   150,   153,   159,   166,   172,   177,   182,   189,   195,   202,   208,
+      214,   220,   225,   228,   233,   238,   243,   246,   249,   256,   261,   266,
+      271,   278,   283,   288,   291,   296,   301,   307,   312,   317,   324,   328,
+      333,   339,   346,   353,   358,   364,   370,   377,   383,   390,   395,   400,
+      405,   411,   416,   424,   430,   437,   443,   450,   457,   464,   467,   472,
+      479,   485,   490,   497,   502,   506,   512,   516,   521,   526,   529,   534,
+      539,   543,   549,   556,   562,   568,   573,   576,   584,   590,   597,   600,
+      606,   613,   618,   624,   630,   636,   643,   647,   653,   659,   667,   674,
+      681,   686,   692,   696,   702,   706,   712,   719,   726,   731,   736,   741,
+      745,   752,   757,   764,   768,   772,   780,   785,   790,   793,   800,   807,
+      811,   817,   823,   829,   832,   838,   845,   851,   855,   860,   866,   872,
+      877,   881,   887,   894,   900,   904,   910,   915,   921,   927,   934,   939,
+      943,   948,   955,   959,   965,   971,   978,   984,   991,   994,   998,  1002,
+     1009,  1013,  1018,  1024,  1029,  1034,  1039,  1046,  1051,  1056,  1061,  1066,
+     1071,  1078,  1084,  1088,  1092,  1097,  1102,  1106,  1110,  1114,  1118,  1122,
+     1127,  1131,  1136,  1142,  1148,  1154,  1158,  1164,  1170,  1173,  1176,  1183,
+     1188,  1193,  1198,  1203,  1208,  1214,  1219,  1225,  1230,  1236,  1241,  1246,
+     1254,  1260,  1266,  1271,  1278,  1283,  1288,  1294,  1299,  1305,  1312,  1317,
+     1321,  1325,  1331,  1337,  1343,  1349,  1355,  1360,  1363,  1371,  1375,  1381,
+     1386,  1390,  1397,  1402,  1407,  1413,  1417,  1421,  1425,  1429,  1435,  1439,
+     1442,  1447,  1453,  1458,  1464,  1469,  1475,  1481,  1488,  1495,  1502,  1505,
+     1511,  1515,  1520,  1526,  1531,  1535,  1539,  1543,  1549,  1555,  1561,  1564,
+     1571,  1576,  1584,  1590,  1596,  1601,  1608,  1612,  1619,  1625,  1631,  1637,
+     1644,  1650,  1657,  1662,  1667,  1675,  1681,  1686,  1693,  1699,  1704,  1708,
+     1713,  1718,  1724,  1728,  1734,  1739,  1746,  1751,  1756,  1763,  1769,  1775,
+     1782,  1789,  1794,  1799,  1804,  1812,  1818,  1825,  1829,  1834,  1839,  1843,
+     1850,  1854,  1858,  1863,  1868,  1874,  1879,  1885,  1890,  1895,  1901,  1905,
+     1910,  1914,  1919,  1924,  1929,  1934,  1938,  1943,  1950,  1956,  1961,  1966,
+     1973,  1977,  1983,  1987,  1991,  1998,  2003,  2009,  2016,  2020,  2027,  2032,
+     2038,  2045,  2052,  2059,  2066,  2074,  2081,  2089,  2096,  2104,  2108,  2112,
+     2118,  2122,  2127,  2131,  2135,  2142,  2146,  2152,  2157,  2164,  2170,  2176,
+     2182,  2187,  2193,  2198,  2204,  2209,  2213,  2218,  2223,  2229,  2234,  2239,
+     2244,  2250,  2255,  2259,  2266,  2271,  2276,  2282,  2286,  2291,  2297,  2302,
+     2309,  2314,  2320,  2327,  2333,  2338,  2341,  2348,  2352,  2359,  2362,  2370,
+     2377,  2384,  2391,  2396,  2403,  2409,  2413,  2418,  2421,  2427,  2431,  2436,
+     2442,  2448,  2452,  2460,  2464,  2467,  2471,  2477,  2483,  2489,  2497,  2503,
+     2510,  2518,  2526,  2530,  2537,  2543,  2547,  2553,  2558,  2565,  2571,  2577,
+     2583,  2590,  2594,  2600,  2606,  2613,  2618,  2624,  2630,  2638,  2644,  2650,
+     2654,  2661,  2668,  2674,  2680,  2687,  2693,  2699,  2706,  2710,  2717,  2722,
+     2726,  2732,  2736,  2742,  2749,  2756,  2763,  2769,  2777,  2783,  2787,  2795,
+     2803,  2810,  2814,  2821,  2829,  2836,  2844,  2850,  2856,  2863,  2868,  2874,
+     2882,  2885,  2889,  2896,  2902,  2908,  2914,  2919,  2923,  2927,  2933,  2937,
+     2942,  2948,  2953,  2960,  2964,  2969,  2974,  2979,  2984,  2989,  2993,  2998,
+     3002,  3006,  3009,  3013,  3017,  3021,  3027,  3031,  3036,  3040,  3045,  3052,
+     3057,  3062,  3067,  3071,  3076,  3082,  3086,  3090,  3094,  3101,  3108,  3112,
+     3116,  3123,  3129,  3132,  3137,  3143,  3148,  3153,  3161,  3168,  3175,  3183,
+     3191,  3196,  3200,  3206,  3212,  3219,  3225,  3232,  3238,  3245,  3250,  3256,
+     3261,  3264,  3271,  3278,  3283,  3289,  3296,  3302,  3308,  3315,  3320,  3326,
+     3332,  3338,  3344,  3350,  3355,  3361,  3366,  3374,  3381,  3386,  3391,  3394,
+     3399,  3404,  3411,  3416,  3421,  3427,  3432,  3439,  3445,  3452,  3458,  3466,
+     3470,  3475,  3481,  3486,  3493,  3499,  3507,  3513,  3520,  3526,  3533,  3541,
+     3548,  3555,  3560,  3565,  3569,  3575,  3581,  3587,  3593,  3600,  3606,  3613,
+     3619,  3624,  3627,  3634,  3640,  3644,  3651,  3655,  3660,  3665,  3669,  3674,
+     3678,  3684,  3690,  3693,  3698,  3705,  3709,  3716,  3719,  3724,  3730,  3737,
+     3742,  3750,  3757,  3765,  3772,  3775,  3779,  3783,  3789,  3794,  3802,  3807,
+     3812,  3815,  3820,  3827,  3832,  3838,  3842,  3846,  3852,  3857,  3861,  3865,
+     3871,  3877,  3881,  3885,  3890,  3896,  3900,  3903,  3910,  3913,  3917,  3922,
+     3927,  3931,  3937,  3941,  3947,  3951,  3956,  3961,  3966,  3972,  3977,  3982,
+     3985,  3989,  3994,  3997,  4001,  4005,  4011,  4015,  4019,  4024,  4030,  4036,
+     4040,  4047,  4052,  4059,  4065,  4071,  4076,  4079,  4086,  4091,  4099,  4104,
+     4110,  4116,  4120,  4125,  4130,  4135,  4141,  4146,  4150,  4153,  4158,  4165,
+     4169,  4175,  4181,  4185,  4191,  4198,  4202,  4205,  4211,  4218,  4224,  4230,
+     4237,  4240,  4244,  4248,  4254,  4259,  4263,  4270,  4276,  4281,  4287,  4294,
+     4301,  4306,  4311,  4315,  4321,  4327,  4334,  4338,  4342,  4346,  4352,  4357,
+     4362,  4367,  4374,  4379,  4384,  4389,  4394,  4398,  4402,  4406,  4413,  4417,
+     4421,  4426,  4433,  4439,  4445,  4451,  4455,  4459,  4464,  4469,  4474,  4479,
+     4484,  4491,  4496,  4501,  4505,  4510,  4514,  4521,  4526,  4530,  4535,  4540,
+     4545,  4550,  4555,  4561,  4564,  4567,  4572,  4576,  4580,  4586,  4593,  4597,
+     4602,  4608,  4612,  4617,  4624,  4627,  4631,  4635,  4641,  4645,  4651,  4656,
+     4661,  4669,  4675,  4680,  4686,  4690,  4693,  4697,  4703,  4707,  4711,  4715,
+     4718,  4722,  4729,  4734,  4740,  4744,  4748,  4755,  4761,  4765,  4770,  4774,
+     4778,  4782,  4788,  4793,  4801,  4805,  4810,  4814,  4819,  4822,  4826,  4831,
+     4837,  4842,  4849,  4855,  4859,  4865,  4870,  4874,  4881,  4887,  4890,  4894,
+     4898,  4906,  4910,  4916,  4919,  4926,  4933,  4938,  4945,  4952,  4958,  4964,
+     4970,  4977,  4984,  4988,  4995,  5001,  5009,  5014,  5022,  5028,  5036,  5042,
+     5049,  5055,  5061,  5068,  5075,  5081,  5087,  5093,  5098,  5106,  5111,  5118,
+     5124,  5130,  5136,  5143,  5150,  5156,  5164,  5168,  5174,  5180,  5187,  5191,
+     5197,  5204,  5209,  5213,  5218,  5224,  5230,  5233,  5237,  5244,  5249,  5254,
+     5259,  5262,  5266,  5270,  5277,  5280,  5285,  5290,  5294,  5300,  5306,  5310,
+     5314,  5322,  5326,  5330,  5337,  5340,  5344,  5347,  5353,  5357,  5364,  5368,
+     5371,  5378,  5382,  5388,  5392,  5396,  5401,  5406,  5410,  5413,  5418,  5423,
+     5429,  5433,  5437,  5441,  5449,  5455,  5460,  5465,  5470,  5475,  5482,  5486,
+     5489,  5493,  5500,  5505,  5509,  5515,  5519,  5524,  5529,  5536,  5540,  5543,
+     5548,  5554,  5561,  5566,  5570,  5576,  5580,  5587,  5593,  5599,  5604,  5608,
+     5615,  5622,  5629,  5633,  5637,  5642,  5646,  5650,  5655,  5659,  5663,  5669,
+     5673,  5679,  5683,  5689,  5693,  5697,  5704,  5709,  5713,  5718,  5724,  5728,
+     5732,  5739,  5743,  5749,  5753,  5758,  5763,  5770,  5776,  5781,  5786,  5792,
+     5798,  5805,  5808,  5813,  5819,  5823,  5827,  5831,  5836,  5840,  5846,  5849,
+     5855,  5862,  5867,  5874,  5880,  5885,  5891,  5896,  5902,  5908,  5914,  5922,
+     5926,  5930,  5936,  5941,  5949,  5953,  5959,  5965,  5972,  5976,  5982,  5986,
+     5993,  5997,  6005,  6010,  6015,  6021,  6025,  6031,  6037,  6044,  6048,  6053,
+     6058,  6063,  6068,  6072,  6079,  6084,  6090,  6096,  6104,  6108,  6115,  6120,
+     6124,  6131,  6136,  6142,  6149,  6155,  6161,  6165,  6172,  6175,  6180,  6187,
+     6193,  6198,  6204,  6207,  6213,  6220,  6226,  6233,  6238,  6242,  6247,  6251,
+     6258,  6266,  6272,  6278,  6283,  6291,  6296,  6300,  6305,  6309,  6315,  6319,
+     6327,  6333,  6339,  6347,  6352,  6356,  6362,  6368,  6375,  6379,  6384,  6388,
+     6394,  6400,  6405,  6411,  6417,  6421,  6425,  6429,  6437,  6444,  6451,  6457,
+     6462,  6466,  6469,  6476,  6483,  6488,  6492,  6496,  6500,  6505,  6510,  6515,
+     6522,  6528,  6534,  6539,  6543,  6550,  6554,  6561,  6567,  6572,  6575,  6582,
+     6588,  6593,  6596,  6599,  6603,  6609,  6615,  6622,  6629,  6635,  6642,  6647,
+     6652,  6659,  6663,  6666,  6671,  6677,  6682,  6685,  6689,  6692,  6697,  6704,
+     6708,  6712,  6715,  6720,  6726,  6730,  6734,  6739,  6746,  6752,  6758,  6764,
+     6769,  6776,  6781,  6789,  6794,  6800,  6808,  6814,  6821,  6826,  6833,  6838,
+     6844,  6851,  6855,  6859,  6863,  6866,  6871,  6877,  6883,  6888,  6892,  6898,
+     6902,  6906,  6912,  6916,  6921,  6926,  6931,  6938,  6943,  6949,  6955,  6959,
+     6965,  6970,  6974,  6979,  6983,  6990,  6996,  7003,  7008,  7012,  7019,  7024,
+     7030,  7034,  7041,  7048,  7051,  7058,  7064,  7070,  7076,  7083,  7089,  7095,
+     7098,  7103,  7108,  7114,  7122,  7127,  7133,  7140,  7145,  7148,  7154,  7158,
+     7163,  7167,  7174,  7178,  7184,  7189,  7194,  7199,  7205,  7212,  7217,  7221,
+     7227,  7233,  7238,  7242,  7248,  7252,  7256,  7261,  7266,  7270,  7276,  7280,
+     7284,  7288,  7295,  7302,  7310,  7318,  7322,  7328,  7335,  7342,  7348,  7353,
+     7361,  7367,  7374,  7380,  7387,  7394,  7400,  7407,  7412,  7417,  7424,  7429,
+     7437,  7443,  7450,  7455,  7462,  7469,  7476,  7482,  7489,  7496,  7503,  7508,
+     7516,  7523,  7530,  7535,  7542,  7548,  7555,  7559,  7563,  7568,  7575,  7580,
+     7585,  7590,  7598,  7604,  7611,  7616,  7620,  7623,  7629,  7636,  7643,  7650,
+     7657,  7665,  7670,  7674,  7678,  7683,  7689,  7696,  7700,  7704,  7709,  7714,
+     7718,  7722,  7727,  7732,  7736,  7741,  7747,  7752,  7757,  7761,  7765,  7771,
+     7776,  7779,  7784,  7789,  7793,  7799,  7804,  7811,  7817,  7824,  7830,  7836,
+     7843,  7849,  7856,  7862,  7868,  7874,  7880,  7887,  7893,  7898,  7905,  7911,
+     7915,  7921,  7929,  7935,  7941,  7947,  7952,  7956,  7962,  7968,  7974,  7981,
+     7987,  7994,  8000,  8008,  8014,  8022,  8030,  8036,  8042,  8049,  8055,  8062,
+     8068,  8074,  8080,  8086,  8089,  8095,  8099,  8103,  8107,  8112,  8117,  8122,
+     8127,  8131,  8135,  8141,  8145,  8151,  8156,  8161,  8165,  8170,  8175,  8181,
+     8187,  8194,  8198,  8204,  8208,  8212,  8218,  8223,  8228,  8233,  8238,  8244,
+     8248,  8251,  8255,  8258,  8264,  8269,  8272,  8278,  8285,  8289,  8293,  8298,
+     8304,  8309,  8313,  8319,  8323,  8329,  8333,  8340,  8347,  8352,  8359,  8363,
+     8366,  8371,  8375,  8380,  8387,  8392,  8398,  8404,  8411,  8419,  8427,  8432,
+     8437,  8443,  8449,  8454,  8457,  8463,  8469,  8473,  8479,  8485,  8492,  8500,
+     8504,  8508,  8515,  8521,  8525,  8532,  8538,  8543,  8551,  8557,  8564,  8571,
+     8577,  8582,  8587,  8593,  8598,  8605,  8610,  8614,  8619,  8626,  8632,  8637,
+     8642,  8646,  8652,  8657,  8661,  8666,  8670,  8675,  8683,  8688,  8694,  8699,
+     8706,  8709,  8716,  8720,  8724,  8729,  8734,  8738,  8744,  8748,  8753,  8759,
+     8766,  8772,  8777,  8781,  8786,  8792,  8799,  8802,  8806,  8811,  8817,  8820,
+     8825,  8829,  8834,  8839,  8843,  8847,  8852,  8859,  8864,  8869,  8875,  8879,
+     8885,  8889,  8893,  8898,  8903,  8908,  8913,  8918,  8924,  8929,  8934,  8938,
+     8943,  8947,  8951,  8957,  8963,  8967,  8971,  8975,  8980,  8987,  8992,  9000,
+     9005,  9012,  9016,  9020,  9025,  9029,  9033,  9038,  9042,  9048,  9053,  9058,
+     9063,  9070,  9075,  9080,  9087,  9092,  9097,  9102,  9108,  9113,  9119,  9124,
+     9128,  9134,  9139,  9144,  9151,  9156,  9161,  9165,  9170,  9176,  9182,  9185,
+     9191,  9198,  9206,  9212,  9219,  9224,  9229,  9235,  9240,  9245,  9250,  9255,
+     9259,  9264,  9269,  9273,  9277,  9283,  9288,  9293,  9298,  9303,  9310,  9315,
+     9320,  9325,  9330,  9338,  9344,  9350,  9356,  9364,  9371,  9376,  9383,  9388,
+     9395,  9401,  9407,  9414,  9418,  9424,  9430,  9435,  9442,  9446,  9452,  9455,
+     9460,  9466,  9471,  9477,  9484,  9488,  9495,  9500,  9508,  9516,  9522,  9529,
+     9536,  9543,  9548,  9552,  9557,  9562,  9567,  9572,  9576,  9581,  9587,  9592,
+     9598,  9605,  9610,  9616,  9621,  9627,  9630,  9634,  9640,  9644,  9648,  9652,
+     9658,  9662,  9667,  9673,  9677,  9682,  9686,  9690,  9693,  9699,  9705,  9709,
+     9713,  9717,  9721,  9726,  9730,  9735,  9739,  9745,  9750,  9754,  9759,  9763,
+     9770,  9775,  9781,  9786,  9791,  9798,  9804,  9808,  9813,  9817,  9823,  9827,
+     9831,  9834,  9839,  9845,  9850,  9855,  9862,  9867,  9874,  9877,  9885,  9891,
+     9896,  9902,  9910,  9914,  9920,  9927,  9931,  9936,  9939,  9944,  9950,  9955,
+     9962,  9970,  9974,  9979,  9986,  9992,  9997, 10001, 10004, 10009, 10014, 10021,
+    10027, 10032, 10040, 10044, 10049, 10055, 10059, 10064, 10068, 10073, 10078, 10083,
+    10088, 10095, 10099, 10103, 10109, 10116, 10121, 10125, 10130, 10137, 10142, 10147,
+    10150, 10154, 10161, 10167, 10171, 10177, 10183, 10187, 10193, 10199, 10205, 10210,
+    10214, 10219, 10222, 10226, 10233, 10237, 10245, 10251, 10258, 10263, 10270, 10275,
+    10279, 10285, 10291, 10298, 10305, 10311, 10315, 10323, 10330, 10336, 10341, 10348,
+    10354, 10360, 10367, 10373, 10377, 10382, 10387, 10392, 10396, 10401, 10404, 10408,
+    10414, 10421, 10426, 10433, 10439, 10445, 10450, 10455, 10461, 10466, 10469, 10475,
+    10480, 10487, 10491, 10496, 10503, 10509, 10515, 10522, 10527, 10531, 10537, 10544,
+    10548, 10554, 10561, 10567, 10574, 10581, 10588, 10593, 10597, 10604, 10611, 10617,
+    10624, 10629, 10633, 10638, 10644, 10649, 10654, 10659, 10664, 10668, 10675, 10681,
+    10685, 10691, 10695, 10700, 10704, 10708, 10712, 10718, 10722, 10729, 10733, 10740,
+    10744, 10748, 10753, 10758, 10762, 10765, 10771, 10777, 10781, 10787, 10794, 10797,
+    10804, 10811, 10816, 10823, 10827, 10830, 10835, 10839, 10844, 10849, 10853, 10858,
+    10862, 10869, 10873, 10878, 10882, 10886, 10890, 10893, 10899, 10903, 10907, 10911,
+    10917, 10923, 10927, 10933, 10937, 10941, 10948, 10952, 10957, 10963, 10967, 10971,
+    10975, 10979, 10984, 10989, 10994, 10998, 11003, 11010, 11015, 11020, 11025, 11029,
+    11033, 11039, 11042, 11047, 11052, 11057, 11061, 11065, 11068,
+};
+
+/* the displacement of every bucket, see crawdog_mnemonic.c */
+static const uint16_t _displacements[512] = {
+        0,     5,     3,    13,     0,     0,     0,     2,     5,     7,     1,     3,
+        0,     0,     3,     1,     0,     2,     2,     0,     0,     0,     6,    11,
+        2,     4,     5,     0,     1,     0,     0,     0,     1,     1,     2,     0,
+        0,     2,     1,     2,    11,     1,     5,     3,     2,     0,     3,     1,
+        3,     0,     3,     0,     2,     0,     0,     0,     1,     5,     1,     1,
+        0,     0,     1,     0,     3,     6,     2,     0,     0,     1,     2,     0,
+        0,     0,     2,     2,     0,     3,     1,     0,     0,     0,     0,     3,
+        0,     0,     0,     5,     0,     1,     3,    13,     2,     1,     1,     0,
+        0,     5,     3,     0,     3,     6,     0,     1,     5,     0,     3,     1,
+        3,     0,     3,     0,     1,     3,     3,     1,     4,     7,     3,     1,
+        0,     5,     0,     0,     0,     1,     0,    16,     0,     7,     0,     2,
+        7,     2,     9,     3,     2,     0,     0,     0,     0,     4,    11,     5,
+        0,     0,     4,     1,     5,     1,     1,     9,     0,     0,     0,     0,
+        0,     2,     1,     0,     9,     3,     1,     5,     1,     1,    19,     5,
+        3,     0,     2,     2,     0,     0,     6,     0,     0,     1,     3,     0,
+        6,     0,     0,     1,     0,     0,     3,     0,     4,     2,     7,     6,
+        7,     2,     0,     1,     7,     1,     0,     3,     1,     0,     1,     4,
+        0,     5,     1,     1,     3,     0,     0,     1,    21,     4,     1,     4,
+        3,     8,    10,     5,    12,     2,     4,     0,     0,     2,     1,     6,
+        9,    12,     7,    10,     7,     0,     3,     0,     1,     0,     3,     5,
+        1,     0,     6,     0,     1,     2,     1,     0,     0,     0,     2,     1,
+        0,     1,     1,     4,     0,     0,     4,     2,    14,    17,     5,     8,
+        0,     1,    10,     0,     0,     3,     1,     2,     1,     2,     3,     0,
+        0,     0,     4,     2,     1,     4,     0,     7,     3,     0,     2,     8,
+       29,     1,     1,     3,     1,     2,     1,     8,     8,     0,     2,     0,
+        2,     2,     3,     1,     3,     0,     3,     1,     0,     1,     0,     7,
+        0,     1,     3,     1,     0,     1,    14,     1,     7,     3,     3,     9,
+       10,     0,     0,     1,     0,     1,     0,     6,     8,     6,    15,     5,
+        1,     2,     6,     2,     2,     0,     0,     0,     1,     1,     9,     1,
+        9,     4,     0,     7,     0,     3,     0,     0,     3,     2,    19,     5,
+        0,     1,     0,     3,     1,    10,     2,     1,     5,     8,     5,     2,
+        1,     5,     0,     2,     2,     3,     2,     2,     3,     3,     1,     1,
+        0,     4,     4,    11,     4,     8,     1,     0,     6,     0,     1,     0,
+        1,    10,     0,     0,     4,     0,     1,     0,     2,     0,     0,     2,
+        0,     0,     0,     3,     3,     0,     0,     0,     4,     6,     4,     2,
+        1,     4,     5,     0,    11,     0,     1,     0,     0,     0,    16,     0,
+        0,     2,     3,     5,     6,     8,     0,     1,     6,     3,     3,     9,
+        0,     5,     4,     4,     2,     4,     3,     4,     4,     1,     2,     0,
+        3,     0,     0,     2,     8,     3,     0,     2,     0,     0,     5,     0,
+        1,     3,     2,     0,     7,     0,     0,     0,     1,     0,     1,     7,
+        6,     0,     0,     2,     4,     0,     1,     1,     6,     1,    10,     4,
+        9,    10,     7,     1,     2,     0,     4,     3,     3,     1,     8,     0,
+        2,     1,     3,     3,     0,     0,     0,     9,
+};
+
+/* the word index + 1 of every slot, zero for empty slots */
+static const uint16_t _slots[4096] = {
+       0,  436,    0, 1376,    0,    0,  221,  748, 1192,  283,    0,    0,    0,    0,    0,  797,
+       0, 1656,    0, 1425, 1128, 1109, 1387,  990, 1996, 1251,    0,    0, 1211,   77,    0,    0,
+    1747,  287,    0, 1332,    0, 1402,    0,  591, 1158,    0,    0,    0,  970,  780,  805, 1566,
+    1552,  690,    0,    0, 2029, 1488,    0, 1670,    0,  193,    0,    0,    0,    0,  914,    0,
+     447,    0,    0,  485,    0, 1370,  127,  750, 1480,    0,    0,    0,    0,    0, 2041,    0,
+       0,    0,    0, 1980,    0,    0, 1266,  269,    0, 1464,    0, 1451,    0,    0,    0,    0,
+       0,    0,    0,    0,  645,    0,    0,    0, 1550, 1891,  567,    0,    0,    0,    0, 1780,
+       0,    0,  208, 1986,  471,    0, 1414, 1715,    0,    0,    0,  210, 2024,    0, 1826,    0,
+     769,    0,   22,  476,    0,  988,    0, 1261,    0,  624,    0,    0,  412,  790,    0,    0,
+     299,    0,    0,  328,    0,    0,    6,  281,    0,  383, 1010, 1475,    0,    0,    0,    0,
+     730,    0,  719,  438,    0,    0,    0,    0,    0,    0,   17,    0,    0, 1618, 1498,    0,
+     524,    0, 1116, 1354, 1856,  544, 1518, 1150,  963,    0,    0,    0,  199,    0, 1463, 1631,
+       0,    0,    0,    0,  682, 1682,    0,  442,    0,   33,    0,    0,    0,  477,    0,  273,
+    1974, 1696,    0,    0,  698,    0,    0,    0,    0,  946,    0,  335,  249, 1753,  600,  865,
+       0,    0,    0,    0,    0,    0,  858,    0, 1575,    0,    0,    0,  184, 1481, 1043,    0,
+       0, 1885,  121,    0,    0, 1457,    0, 1247, 1159,    0,    0,    0,    0, 1977,    0,    0,
+       0,  720,   83, 1665,  181,    0, 1803,    0,    0,    0, 1259,   23,   46,    0,  304,    0,
+    2026,    0, 1836,    0,    0, 1285, 1434,    0,  157, 1679,    0,    0, 1806,    0,    0,    0,
+    1202,    0,    0,    0,    0, 1937, 1182,  558, 1024,    0,   65,  585, 2037,   51,    0, 1149,
+    1815,    0,    0,    0,    0,    0,  610,    0,  164,    0,  520,    0,    0, 1570, 1906,    0,
+       0,    0,    0, 1361, 1976,    0,    0,    0,  737,    0, 2034, 1152,    0, 1449, 1593,    0,
+       0, 1497,  445,    0, 1095,  637,    0,  692,  554, 1825, 1562, 1324, 1279,  724, 1167,    0,
+       0,    0, 1360,    0,    0, 1295,    0, 1052,    0,    0,   49,    0, 1221,    0, 1745,    0,
+       2,    0, 1863,    0, 1526,    0,  984,    0,    0,    0,  119,    0,    0, 1710,    0,  285,
+    1368,  214,    0,    0,  231, 1578, 2006, 1830,    0, 1470,   87,    0,    0, 1231,  450,    0,
+       0,    0,  141,    0,    0,  314, 1842,    0,    0,    0,    0,  462,    0,  955, 1015,  837,
+       0,  728,  517, 1178,  726,    0, 1426,  228, 1795, 1928,    0,    0,    0,  171,    0,  623,
+       0,    0,    0,  421,    0,  263,  434,    0, 1853, 1732,    0,  700,    0,    0, 1663, 1657,
+       0, 1502,    0,    0,    0,    0, 1362,  458,    0,    0,    0,  578,    0,    0,    0,  371,
+    1942, 1509,  884,    0, 1243,    0,    0,  866,    0, 1069, 1637,    0,    0,    0,  953,    0,
+    1571,    0,  603, 1271, 1909,    0,  488,    0,    0,    0,    0,    0, 1366, 1199,  223,  173,
+    1635,    0, 1365,    0, 1327,  917,   71,    0,  330, 1916,  864,    0,    0,    0,    0, 1531,
+       0,  355,    0,  306,  882,    0,    0, 1840,    0,    0, 1429,    0,    0, 1165, 1445, 1892,
+    2018,    0,    0,    0,  111,    0, 1379,    0,    0,    0,    0, 1622, 1761,    0,    0,    0,
+     759, 1112,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1440,   11,  142,    0,  154,
+       0,    0,    0,  593,  835,    0,  258,    0,  209,    0,    0,  262,    0,  294,    0, 1692,
+       0,  427,    0, 1651,    0,  174, 1642,    0,    0,    0,    0,  923,    0, 1921,  271,  295,
+       0,    0, 1792,    0, 2036, 1343, 1130,  504, 1897, 1044,  987, 1113,  684,  670, 1813, 2007,
+    1352, 1504,    0, 1070,    0,    0,    0,    0,    0,    0,  540,    0,    0,    0,    0,    0,
+       0,    0,  404, 1227, 1041, 1444,    0,  440,  222,    0, 1174, 1671,    0,    0,  563, 1648,
+       0,  275,    0,    0,    0,  943,    0,  888,  911,    0,  981,  113, 1169,  187,    0, 1035,
+    1794, 1389,    0, 1664,    0,    0,    0,    0,    0,    0,  850,    0,    0,    9,    0, 1299,
+    1925, 1739,    0,    0,  853, 1798,    0, 1351,  469, 1659,  183,  809,  942,  821,    0,    0,
+    1057,  432,    0, 1763,  545,    0, 1650,    0,    0,  969,    0,    0, 1032, 1067, 1317,    0,
+       0,    0, 1272,  967,  641, 1775,    0,    0, 1662,    0, 1386,    0, 1884,  798,    0,    0,
+       0,   73,    0,    0,    0,    0,  512,  841, 1938,  329, 1061,  239, 2046, 1099,    0,    0,
+    1781,    0,    0, 1466,    0,    0, 1603,    0,  541,  599,    0,    0, 1214,    0,    0,    0,
+    1047, 1143,  236, 1382,    0,   76,  265,    0,    0, 1384,    0,    0,  150,    0, 1212,  402,
+     649,    0,    0,    0,    0,    0,  451,  516,    0,  118,    0, 1133,    0, 1721,    0,    0,
+       0,  674,    0,    0, 1688, 1297,    0,  372,    0,    0,    0, 1482,  317, 1920, 1484,    0,
+    1956,    0,    0,   47,    0,  282,    0,  195,    0,    0,  755, 2009,    0,    0,    0, 1832,
+     166,    0,    0,    0, 1730,    0,    0,    0,    0,    0,    0, 1229,    0,    0, 1102,    0,
+     360,    0,  745, 1320,   97,    0,  982,    0,    0,  857,    0,  250,    0,    0,  660, 1151,
+     508,    0,    0,    0,    0,  954, 1564,  838,    0, 1478,    0, 1535,    0,  753,  927,    0,
+    1978, 1995,  419,    0,    0,  158, 1779,  125, 1468,    0, 1941,  747,    0,  744,  761,  247,
+     566,  754,   35, 2000,    0,    0,  481,    0,    0,    0,  101,  830,    1, 1944,    0,  802,
+       0,   24,    0,  483, 1574,    0,  898, 1875,  740,    0, 1890,  651,  894,    0,    0, 1605,
+    1385,  832,    0,  522,    0,    0, 1334,    0,    0, 1573, 1115,    0, 1256,    0,    0, 2014,
+       0,  107, 1720,    0,    0,    0,    0,  393,    0,  460,    0, 1824,  176,    0,    0,  829,
+       0,    0, 1947,    0,    0,    0, 1084,    0, 1560,    0,    0, 1919,  344,    0,    0, 1674,
+       0,  268,  521,    0, 1400, 1051, 1866,    0,    0, 1731,    0, 1930,    0,  962,    0,    0,
+     840,    0, 1439,    0,  873,  656, 1991,    0,    0, 1487,    0,    0, 1396, 1862,  224,  705,
+    1138,    0,    0,    0,    0,    0,  417,    0,  219,  437, 1844,    0,    0,   66,  423, 1265,
+     245,    0,    0,  972,    0, 1797, 1536,    0,  276,  502,  897,  834,  939,  405,  867,  163,
+       0,    0,    0,    0,    0,    0,  169,    0,    0,    0,    0,    0, 1089,  291,    0,    0,
+     148,  312,    0, 1660, 1339, 1607,    0,    0,  880,  960,    0, 1495,    0,  667, 1328,    0,
+    1617,   55,  686, 1614,   79,  425, 1741, 1629,    0,    0, 1669, 2003, 1068, 1108,    0,    0,
+     529, 1145, 1494, 1961, 1037, 1959,    0,    0,    0,   86,  379,    0,  609,    0,    0,    0,
+       0,    0,    0,  133,  362,    0,    0,    0,    0,    0,  863,    0, 1501, 1729,  664,  124,
+       0,  998, 1097, 1075, 1541,    0, 1756,   31,  794,    0, 1447,    0,    0,    0, 1636,  573,
+       0, 1867,    0,  369,    0,    0,  676,    0, 1137,  944,    0,    0,  211,    0, 1446, 1542,
+       0,    0, 1304,  827,  721,  515, 1479, 1796, 1809,    0,    0,  534,    0, 1082,  326, 1378,
+    1580, 1963,    0,    0,  833,  644, 1430,    0,    0,  627,    0,    0,    0,  762,    0, 1333,
+       0,    0, 1800,    0,    0,    0,    0, 1103,  234,    0,    0,  120,    0,   63,  538, 1543,
+       0, 1699,  503,  902,    0, 1373,    0,  546,  204,    0,    0,    0,    0,    0, 1201, 1291,
+       0,    0,    0,    0,    0, 1632,  443, 1154,    0, 1687,    0,  441,  126,    0,  309,    0,
+      38,    0,    0,    0,    0,    0, 1727,    0, 1903,    0,    0,    0, 1774, 1004, 1512,    0,
+       0,    0,  980,  532, 1680,    0,    0,    0, 1655, 1356,    0,    0,  713,  781,    0,    0,
+       0,    0,    0,  453,    0,    0,    0,    0, 1706,    0,    0,    0,    0,    0,    0,    0,
+     509,  617,    0, 1416, 1610, 1249, 1693,    0, 1811,    0, 1406, 1859,    0,    0,    0,    0,
+       0, 1281, 1224,  310,    0, 1514,    0,    0,    0,  301,    0,    0,    0,    0, 1913,    0,
+     392,    0,    0,  808,    0,    0,    0,    0,    0,    0,  629,    0, 1483,  843,  359,  115,
+     655, 1016, 1226,    0,    0,  366,  322,    0,    0,    0,    0,  340,  831,    0,    0,    0,
+    1230,    0,  763, 1245,    0,    0,    0,  974, 1767,    0,    0,    0,    0,  426, 1599, 2028,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  734, 1773, 1078,    0,    0,    0, 1100,
+       0,    0,  918,  952, 1760,    0,  868,  444,  243,   90,  316,    0,  465,    0,    0, 1074,
+       0, 1418,    0, 1929,    0, 1883,    0,    0,    0,    0, 1486,  536,  168,    0,  959, 1718,
+     151,    0,    0,    0,  618,    0,    0,    0,    0,    0, 1039,    0,  439,    0,  550,    0,
+     851,  811,    0,    0,    0,    0,  474,    0,    0, 1238,    0, 1539,  518, 1036,    0, 1125,
+       0,    0,    5,    0,  244,  687,    0,    0, 2031,    0, 1932,    0,    0,  576,    0, 1198,
+       0,    0, 1422, 1367,    0, 1196,  535, 1744,    0,    0,    0,    0, 1723,    0, 1993, 1770,
+     796,  513,  496, 1881,    0,   95,    0, 1459,    0, 1252,  708,    0, 1493,   19,  948,   27,
+       0,   81,    0,    0,  654,    0, 1205, 2019,  779,    0,  778,    0,    0,    0,  466,  506,
+       0,  452,    0, 1476, 1122, 1453,    0,    0,    0,    0,    0,  596, 1654,   37,  908,    7,
+       0, 1860, 1954,    0,    0,  848, 1307, 1419,    0,  586,    0,    0,    0,    0,    0,    0,
+     842,    0,  106,  685,  505,  626,    0,  640,  823,    0, 1293,  200,    0,    0, 1092,    0,
+    1346, 1186,  883, 1652, 1273,    0, 1581, 1848, 1538, 1390,    0,  738,  956, 1834, 1638,    0,
+     246, 2042, 1748,  849,    0, 1394,  929,    0,    0,    0,    0,    0,  180,    0,    0,    0,
+    1363,    0,    0, 1311,    0,  896,    0, 1126,  492,    0, 1964,    0,    0,  130,    0,    0,
+    1750,    0, 1851,  385,    0,  270,    0, 1432,  430,    0,    0, 1437,    0,    0,    0,    0,
+     331,    0,  303,  240,    0,    0, 1517,   52, 1413,  938, 1966,    0, 1778, 1417, 1666,    0,
+       0,    0,    0, 1634,    0,    0,    0,    0,    0, 1933, 1695,  230,    0,    0,  431, 1556,
+     921, 1673,    0, 1119,    0,    0,    0,    0,   26,    0, 1668,  916,    0, 1355,    0,   44,
+    1438,  336,  931,    0, 2025, 1746, 1672, 1287,    0,  479,    0, 1408,    0, 1808,  354,    0,
+       0,    0,   99, 1045, 1321, 1503,  373,   12, 1894,    0,    0,    0, 1520,  635,    0,    0,
+     783,    0, 1559, 2038,    0,  162,    0,  807,  891, 1175,    0,    0,    0,    0,  571, 1215,
+       0,   59,    0, 1223, 1329, 1601, 1313, 2020,  156, 1374,    0,  971, 1600,    0, 1278,    0,
+       0,    0, 1577, 2013,    0,    0,    0,  553, 1743, 1879,    0, 1653,  951,    0,    0,    0,
+       0,    0,    0, 1240, 2016,    0, 1592,  613,  859,  824,    0,  614,    0,   75, 1613,    0,
+     267,    0,    0,    0,    0, 1235,    0,  293,  704,  643, 1917, 1034, 1934,    0,    0, 1472,
+       0,  319, 1608,    0,    0,  191, 1055, 1294,    0,    0,  480, 1523,    0,    0,    0,    0,
+       0,    0, 1586, 1104,    0,    0,  622, 1611,    0, 1722,    0, 1987,    0,    0,    0,  260,
+       0,    0,  957, 1912, 1107,   34, 1232,  352, 1786,    0,    3,    0,    0,    0,  406,    0,
+    1924, 1030,    0,    0,    0, 1948,  382,    0,  266, 1620, 1712, 1471,    0,  261,    0,  930,
+     949,    0,    0,    0,  683,    0,  389,  551,    0,  773,    0,    0,    0,    0,    0,    0,
+       0,  342,    0,  887,  995,  791, 1454,    0,    0,    0, 1267,  108,    0,    0,    0, 1274,
+       0,    0,   14,    0,    0, 1645,    0,    0,  604,    0,  602,  241,    0,    0,    0, 1700,
+    1887, 1118,    0,    0,    0,    0,    0, 1397,    0, 1783,  941,    0, 1193,    0,  552,   21,
+     547,    0,    0,    0, 1646,    0, 1515, 1183,    0,  892, 1677, 1166,    0,    0,  717, 1565,
+       0,    0,  523,   25,  788, 1350, 1207,    0,    0,    0, 1516,    0, 1765,    0,    0,    0,
+     311,    0,    0,   45,  806,    0,    0,    0,    0, 1759,  413, 1218,  715,    0,  608,  877,
+    1734,  818, 1372,  216, 1349,    0,  380,    0,    0,   93, 1895,  589,   10, 1190,    0,  977,
+    1420,  498,    0,  527,    0,    0, 1676,    0,    0,    0, 1849, 1401, 1513, 1156,    0,    0,
+    1371,    0, 1821,    0,  712,    0,    0,    0,    0, 1216,    0,    0,    0,  457, 1474,  409,
+       0,    0,    0, 1604,    0,    0,    0, 1008,    0, 1690, 1427, 1684,  679,    0,    0, 1140,
+     526,  131,    0,  678,    0, 1973,    0,  449,    0,    0,  940, 1685,    0, 1020,    0, 1707,
+       0, 1021,    0,    0,    0,    0,    0,    0,    0,  584, 1315,    0,    0,    0,    0,    0,
+      82,    0, 1093, 2021, 1914,    0,    0, 1522,    0,    0,    0, 1435,    0, 1049, 1828,    0,
+    1726, 1326,    0,    0,  494, 1532,    0,    0,    0, 1029,    0,    0,  116,    0,    0,  812,
+    1772,    0, 1375,    0, 1981,  574, 1534,    0, 1728,    0,    0,  766, 1344,  597,    0,  248,
+       0, 1915,    0,    0,    0, 2012,    0,    0,    0,    0,    0,    0,    0, 1882,  229,  785,
+       0,    0,    0,  749,    0,    0, 1596, 1799,    0,    0,  122,    0,  297,    0,  418,    0,
+    1583,  188,  994, 1619,    0,  915,    0, 1812, 1548, 1269,  588,  186, 2011,    0, 1253, 1529,
+       0,  999, 1473,    0, 1997,    0,  396,  619,    0,    0,  813,  463,    0, 1177,  710,    0,
+       0,   67,    0,  177,    0, 1804, 2008,    0,    0,    0, 1984,  497,    0,    0,  420,    0,
+       0,  339, 1898, 1612, 1213,    0,    0, 2004,    0, 1302,   41,  374,   60,  215,  378, 1544,
+       0,  746,  895, 1506,    0,    0, 1691,    0,    0,    0,    0,  634, 1163,  375,    0,  272,
+     351,    0,    0, 1551,    0,  846,  401,    0, 1725,    0,    0,    0,    0, 1340,    0,    0,
+       0, 1496,  313,    0,    0,    0,  334,    0,    0,    0,  493,    0, 1244,    0,  387,    0,
+     926,    0,    0,  284, 1173,    0,    0,  138,  170, 1079,    0,    0, 1782,    0,    0,   40,
+    1309,  279,    0,  257,    0,    0,    0, 1018, 1714,    0,    0, 1300,  345,    0,  349,  332,
+    1489,    0,    0,    0,  616,    0,    0,    0,  353,  548,    0,  202,    0,    0,    0, 1456,
+    1946,    0, 1547,    0,    0,    0,    0,    0, 2022,    0,  767,    0,    0,    0, 1769,    0,
+       0,  468,   20, 1005,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  900,
+     254,    0,  913,    0,    0,    0,    0,  320, 1931,    0, 1436, 1943,    0,    0,    0,    0,
+    1076, 1940,    0,    0,    0, 1649,  691, 1627, 1508,    0,    0,    0,    0,    0, 1160,    0,
+       0, 2033,    0,    0,  793,    0,    0,    0, 1911, 1855, 1383,    0, 1640,  307,  876,    0,
+      69, 1833,  935,    0,  820,  680,    0, 1000,    0, 1220,    0,    0,  467,  861, 1624, 1701,
+    1839, 1312, 1325,  564,    0,    0,    0,    0,  906,  129, 1455, 1889,    0,    0,    0,  758,
+       0, 1602,  289,  845,  628,    0,  647, 1752,  253,    0,    0, 1546, 1014,    0,    0,  854,
+       0,  869,  985,  590,    0, 1923, 1359,    0, 2002, 1908,    0,    0, 1569,  741,    0, 1009,
+       0,    0,    0,  727, 1953,    0,    0, 1698, 1519, 1330,    0,    0, 1316,  347, 1072,    0,
+    1431,    0,    0, 1308, 1589,  992,  611, 1250,  907, 1257,    0,    0, 1870,    0,    0,  621,
+       0,    0,    0,    0,  185,  167,    0,  255,    0,    0,    0, 1048,    0,  499,    0,  226,
+       0,  470, 1802,  909, 1264, 1276, 2040,    0, 1338,  729,    0,    0,  321,    0, 1380,    0,
+     361,    0,    0,    0,    0,    0, 1819,    0,    0,  932, 1162,    0,    0,  145,   88,  732,
+       0,    0,  697,  155,    0,    0, 1094,    0,    0,    0,    0,  217, 1442,    0, 2027,  277,
+       0,    0,    0,  152,    0,  435, 1764,    0,    0, 1511,    0, 1258,    0, 1280,    0,    0,
+    1868,    0, 1110,    0, 1689,    0,    0, 1206,    0,    0, 1127,    0,    0, 1136,  377,    0,
+      43,    0, 1412,    0,  964,   50,    0, 1392,  400,    0,    0,    0,    0,    0,    0,    0,
+    1568,  901,    0,    0, 1087,  300,    0,  986, 1306,    0, 1155,    0,  822, 1886,  461, 1492,
+     799,    0, 1091,    0, 1749,  464,  577,    0,   78,  707,    0,  760,  582,  885,    0,    0,
+     890,    0, 1358,    0,  826,    0, 1393, 1153, 1558,  325,    0,  414, 1348, 1168,    0, 1958,
+    1053,    0,    0, 1533,    0, 1982,    0,  575,  702, 1683,  182,  871, 1170,    0,    0, 1141,
+       0,    0, 1740,    0, 1962,  633,    0,    0,    0,    0, 1521,    0,    0,  259, 1081,    0,
+       0,    0,    0,    0, 1310, 1073,    0,    0, 1865,    0, 1845, 1871,  197,    0, 1950, 1717,
+       0,  819,    0,    0,    0,    0,    0,    0,  756,  394, 1554,   39,    0,    0,    0,   57,
+       0,  905,    0,    0,  703,    0, 1046, 1896, 1135,    0,  847,  237,    0,  989,  642, 1628,
+       0,    0, 1789,    0, 1289, 2015,    0, 1597,  491,  922,    0, 1098,  109,    4,  278,  561,
+    1742,  233,    0,    0,   48, 1861,    0,  961,  539,    8,  764, 1263,    0,  333,    0,    0,
+       0,    0,    0, 1872,    0, 1901, 1838,    0, 1188,    0,    0,    0,  881,    0, 1305,  446,
+     296,    0,  636, 1647,  632,    0,    0,    0,    0,    0,    0,    0, 1106,    0,  104,    0,
+       0,    0,  528,    0,    0,    0,    0,  292,  657,    0,    0,    0,    0, 1594,    0, 1939,
+       0,  213,    0,    0, 1910,    0,    0,    0, 1027,  422,    0,    0,    0, 1874,    0,    0,
+       0, 1952,    0,    0,    0,    0, 1784,    0,    0,  178,  733,    0, 1776,    0,    0,    0,
+    1298,  598,  323,    0,    0,  714,  639,  782,  772,  709,  218, 1241,    0, 1694,    0,    0,
+     569,    0, 1056, 2039,    0,  810,    0, 1292,  696,    0,    0, 1703,    0,    0, 1054,    0,
+       0, 1083, 1146,  429,  179,    0,    0,    0,  860,    0, 1817,    0, 1477,    0,    0,  189,
+       0,  370,  478, 1801,    0,  386, 2032,    0,    0,    0, 1234, 1319,  803,  912,    0,  663,
+       0, 1762,    0, 1528,  786,    0, 1972, 1246,  625,    0,    0, 1733,  770,  815, 1002,  549,
+    2010,    0, 1407,  368,    0,  688,    0, 1960, 1805,    0,    0,    0,  879, 1823,  225, 1854,
+       0, 1766,    0,    0,    0,    0, 1180,  776,    0,    0,    0, 1827,  358, 1277, 1331,    0,
+    1139,    0,  298, 1147, 1254,    0,    0,    0, 1399,    0,    0,    0,  658,    0,    0, 1469,
+       0,  327,    0, 1949,  172,   92,  872,    0,    0,    0,    0,    0,  777,  501,  787, 1975,
+       0,    0,    0,    0,  816, 1237, 1144,  669, 1992,    0, 1134, 1922,    0,    0,  112, 1448,
+    1935,    0,    0, 1065, 1059,    0,    0,    0,  495,   42,    0,  993, 1290,  149,    0,    0,
+    1561,  397,    0,    0,    0, 1391,    0,    0,  161, 2044,    0, 1658,    0,    0,    0,  958,
+      56, 1904,    0, 1835, 1124,    0,  711,    0, 1822,    0,  583,    0, 1788, 1936,    0,    0,
+    1724,    0, 1197,  274,    0,  739,    0, 1926,  341, 1555, 1807,    0,    0, 1050,    0, 1296,
+       0, 1777, 2001,    0,    0, 1060,    0,  302,    0,    0,    0,  631,  143,    0,  595, 1123,
+       0,  668,    0,    0,    0,    0,  581,    0,  771, 1907,    0,    0,    0,    0,    0,    0,
+       0,  411,    0,    0,  975,    0,  718,    0,  673, 1598, 1013,    0,    0, 1001,  448,    0,
+    1172,    0,  925,    0,    0,    0,    0,    0,   91, 1066,    0,  428,    0, 1970,  531,    0,
+    1038,    0,   13, 1131,    0, 1345,  933, 1441, 1148, 1955,    0,    0,  533,  706,    0, 1500,
+       0,    0,    0,  242,    0,    0, 1105, 1080,  947,    0,    0,  765,  315,    0,  814, 1505,
+       0,    0,    0,    0,   54, 1164, 1606, 1616,    0,    0,  945,    0, 1545,    0,    0,    0,
+    1077, 2005,  555,    0,    0,    0,    0,    0, 1260, 1858,  601, 1843,    0, 1200,    0,    0,
+     620, 1342,    0,    0,    0, 1410, 1209,    0,  792,    0,    0, 1377,  666,  870,    0,    0,
+      29,  146,    0,    0,    0,    0, 1757,    0, 1553,  966, 1510,  433, 1282,    0,    0,  735,
+     472,   30, 1810,    0, 1877, 1132,    0,    0,    0,    0,    0, 2043, 1381,    0,    0, 1460,
+    1857,    0,    0,  875,  132,    0,    0,  220,    0,    0,    0, 1905,    0, 1644, 1591,  825,
+    1537,  110,    0,  408,    0,  904,    0, 1979, 1989,  203,  416,    0, 1284, 1716,    0,    0,
+    1347,    0,    0,   74, 1217,    0, 1210,    0,    0,  159,    0, 1847,  836,  305,    0, 1563,
+     290, 1572,    0, 1275,  346, 1751,  878,    0,    0,  594,    0,    0, 1369,    0,    0, 1388,
+       0,    0,  722, 1262,  264,  997,    0,    0, 1465, 1461,    0,    0,    0, 1990, 1667, 1219,
+     699,    0,  579,    0,    0, 1713,  919,    0,    0, 1423,    0,    0,    0, 1880,    0,  190,
+     592,    0,    0,   61,  212,    0,    0,    0, 1187,    0,  920, 1661,    0, 1242,    0,    0,
+    1869,  105,   96,    0,    0, 1195, 1301, 1988,    0, 1443, 1625,  543,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,  487,    0,    0,    0,  795,    0,    0,    0,    0,    0,
+    1582,    0,  965,    0, 1458,    0,  804,  612,  356,    0, 1233, 1090,    0,    0,  661, 1965,
+       0,    0, 1927,  337,    0,   84,    0,  736,    0,  100,    0, 1697,    0,    0,    0,  560,
+     201,    0,  731,   80, 2047,    0,    0,    0,    0,    0, 1086,  165, 1191,  415,  484,    0,
+     357, 1888,  855,    0,  924,    0,    0,    0,   68,    0, 1225, 1945,    0,  500,  672, 1787,
+      16,  514,    0,  580,  606,    0,    0,    0,  227,    0,  973,    0,    0, 1755,  653,    0,
+    1323,    0, 1524,    0,  789,  350,    0, 1335,    0,    0,    0,    0,  135, 1704,    0,  662,
+     701, 1248,  192,    0,    0,   72, 2035,    0,  630, 1404,  928,  251,    0,    0, 1064,    0,
+       0,    0, 1171,    0,  950, 1161,    0,    0,    0,  801,    0,    0, 1643,    0,    0,  530,
+     978, 1142, 1850,    0,    0,  136,    0,    0,    0,  976,  694,    0,  979,    0,    0,  454,
+       0, 1708,    0,  117,    0, 2023,    0,    0,    0,  308,  519,    0, 1758, 1179,    0,    0,
+       0, 1527,    0,    0,    0,    0,  615, 1028,    0,  774,    0, 1876,    0,    0,    0,   85,
+       0,  675,    0,    0,    0,    0,    0, 1985, 1101, 1398, 1768,    0, 1873,    0,  363,    0,
+     652, 1818,    0,    0,  693,  903,    0,    0,    0,  256,    0,    0,  388,    0,    0,    0,
+       0,    0,    0,  123, 1058,  893,    0,    0, 1736,    0,    0, 1003,    0,    0,    0,  557,
+     134,    0,    0, 1111, 1462,    0, 1525,    0,   98,    0,    0,    0,  968,    0,  991,    0,
+     934, 1411,    0,  137,    0,  102,    0, 1709,   15,    0,  490,    0,  338,    0, 1702,  507,
+       0,    0, 1595,  559, 1615,    0, 1841,    0, 1864,    0,  562,    0,    0,    0,  784,    0,
+       0,    0,  367, 1633,  140,  252,  376, 1793, 1530, 1711,    0,    0, 1239, 1557,    0,  455,
+     983,   64, 1395,  196,    0,    0,  206,    0,  473,    0,    0,  384, 1576, 1584, 1403, 1846,
+    1181, 1549, 1336,  365, 1829, 1314,  889,  147,    0,    0,    0,    0,    0, 1204,    0,    0,
+     407,  205,    0,  852,    0, 1507,  459,    0, 1540,    0,  364,  456, 1998,  391,    0, 1738,
+       0,    0,    0, 1918,    0,    0, 1814, 1026,    0, 1485, 1609,  160, 1641,    0,  665,    0,
+    1288, 1353,    0,    0,    0, 1737,   28,    0,    0,  605,    0,  395,  511, 2017,    0,    0,
+     874,  910,    0,   36,    0,    0,    0,    0,    0,  689,    0,    0, 1011, 1409,    0, 1322,
+       0,    0,    0,    0,    0, 1902,    0,    0,    0,   18,  844, 1678,    0, 1900, 1120, 1491,
+    1194, 1203,  235,    0,    0,    0,    0,    0,    0, 1893,  198,  343,  839,    0,    0,  238,
+       0,    0, 1428,  671,    0, 1341, 1719,    0,    0,  381,  348,    0, 1957, 1318,    0,    0,
+    1433,    0,    0,    0, 1837, 1185,  587, 1042,    0, 1424,    0,  723,    0,    0,    0,   62,
+       0,  743, 1088,  288, 1071,  482, 1022, 2045, 1639,    0,    0, 1033,  899,    0,    0,    0,
+       0,  856,    0,    0,    0,    0, 1019, 1357,    0,    0,  638,    0,    0, 1096,    0,    0,
+       0,    0, 1421,    0,  768,  646,    0,    0, 1791, 1951,    0, 1270,    0,    0,    0,    0,
+    1878,  565,    0, 1967,  144,  324, 1129,    0,    0,    0,  775,    0,    0, 1754, 1121, 1820,
+    1969,    0,    0, 1686, 1585,    0, 1999,    0,  725,    0,    0,    0,  937,    0, 1735,    0,
+       0,    0, 1579, 2048,  153,    0, 1063,    0, 1184, 1499,  410,  817,  650,    0, 1007,    0,
+     525,   53, 1222,    0, 1006, 1031,    0,    0, 1062,    0,  114, 1040,    0,    0,    0,    0,
+      89, 1450,  695, 1117, 1236,  886, 1681,    0,  568,    0,    0,    0,    0,    0,  424,  572,
+       0,    0,    0, 1303,    0,    0,    0, 1983,    0,    0, 1675,    0,    0,    0, 1023,    0,
+     398, 1228,    0,    0, 1405,    0,  996,  475,  659,    0,    0, 1255, 1189, 1467,   94,  194,
+    1268,  207,  936, 1816,    0,  542,    0,  399,    0, 2030,    0, 1337,    0,  757,    0, 1490,
+    1415,    0, 1452,    0,  607, 1705,  556, 1025,  752,    0,  390,    0, 1364,    0,    0, 1630,
+    1157,    0, 1899,    0,  232,    0, 1085, 1623,    0,    0, 1176,  489,    0,  828,  486,    0,
+       0, 1790, 1771,    0,    0,    0,  862,  175,    0,    0,    0,    0,  286, 1831, 1588, 1283,
+    1994,    0,    0,    0,    0,  751,    0, 1017,  537,    0, 1626,    0,  742,    0, 1208,  648,
+    1785,    0,    0, 1587,    0,  128,  570,    0,    0, 1590,    0,    0,    0,    0,    0,  716,
+    1621,  800,  681,    0,  139, 1968, 1971,    0,    0,    0,    0,  403,  280,    0,    0,    0,
+       0,    0,    0,  677,    0,    0,    0,    0,  318,    0,  103,    0,  510, 1567, 1114, 1286,
+      70,    0,    0,    0,    0,   58,    0,    0,    0,    0, 1852, 1012,   32,    0,    0,    0,
+};
+
+static const __crawdog_mnemonic_wordlist _list = {
+    _words,
+    _offsets,
+    _displacements,
+    _slots,
+    512,  /* bucket count */
+    4096, /* slot count */
+    8,    /* longest word, in bytes */
+    " ",
+    1     /* separator length, in bytes */
+};
+
+const __crawdog_mnemonic_wordlist *const __crawdog_mnemonic_english = &_list;
@@ -0,0 +1,145 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+#ifndef __CRAWDOG_MNEMONIC_H
+#define __CRAWDOG_MNEMONIC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+    BIP39 word lists and the 11 bit word packing of mnemonic sentences.
+
+    A word list is constant data: every word back to back in one UTF-8
+    blob with an offset table, and a hash-and-displace perfect hash that
+    maps every word to a distinct slot. A word is hashed with FNV-1a, the
+    low bits of the hash pick a bucket, and the slot is the mixed hash
+    xor-ed with the displacement of that bucket. Looking a word up costs
+    one hash and one comparison against the single candidate in its slot.
+
+    Sentences carry the entropy followed by its checksum bits, eleven bits
+    per word, most significant bit first. Neither direction computes the
+    checksum; callers append or verify it.
+
+    Word lists other than english are loaded from a packed image with the
+    same layout, which can be memory mapped and used in place:
+
+        offset  size
+        0       8       magic "RAWBIP39"
+        8       4       word count (2048)
+        12      4       bucket count
+        16      4       slot count
+        20      4       longest word, in bytes
+        24      4       separator length, in bytes (at most 8)
+        28      8       separator, zero padded
+        36      4       words length, in bytes (at most 65535)
+        40      4098    offsets      [word count + 1] uint16
+        4138    ...     displacements[bucket count] uint16
+        ...     ...     slots        [slot count] uint16
+        ...     ...     words
+
+    Every integer is little endian.
+*/
+
+#define __CRAWDOG_MNEMONIC_WORD_COUNT           2048
+#define __CRAWDOG_MNEMONIC_MAX_SENTENCE_WORDS   24
+
+#define __CRAWDOG_MNEMONIC_OK                   0
+#define __CRAWDOG_MNEMONIC_UNKNOWN_WORD         -1  /* error_offset and error_length are the bytes of the word */
+#define __CRAWDOG_MNEMONIC_WORD_COUNT_INVALID   -2  /* the sentence is empty or has too many words, word_count is the number of words */
+#define __CRAWDOG_MNEMONIC_PACKED_INVALID       -3  /* the packed image is truncated or inconsistent */
+
+#define __CRAWDOG_MNEMONIC_PACKED_HEADER_LENGTH 40
+#define __CRAWDOG_MNEMONIC_MAX_SEPARATOR_LENGTH 8
+
+typedef struct __crawdog_mnemonic_wordlist {
+    const char *words;                  /* every word back to back */
+    const uint16_t *offsets;            /* [WORD_COUNT + 1] byte offset of every word in words */
+    const uint16_t *displacements;      /* [bucket_count] */
+    const uint16_t *slots;              /* [slot_count] word index + 1, zero for empty slots */
+    uint32_t bucket_count;              /* a power of two */
+    uint32_t slot_count;                /* a power of two */
+    uint32_t max_word_length;           /* bytes in the longest word */
+    const char *separator;              /* the separator between the words of a sentence */
+    uint32_t separator_length;
+} __crawdog_mnemonic_wordlist;
+
+extern const __crawdog_mnemonic_wordlist *const __crawdog_mnemonic_english;
+
+/*  Point list into a packed image, validating every offset and length so that lookups stay in bounds
+    The image must stay mapped, and 2 byte aligned, for as long as the list is used
+    Returns __CRAWDOG_MNEMONIC_OK or __CRAWDOG_MNEMONIC_PACKED_INVALID
+*/
+int __crawdog_mnemonic_wordlist_open(
+    __crawdog_mnemonic_wordlist *list,  /* OUT */
+    const void *packed,                 /* IN: [len] bytes */
+    size_t len);
+
+/*  Returns the length of the packed image of a word list whose words take words_length bytes
+*/
+size_t __crawdog_mnemonic_packed_length(size_t words_length);
+
+/*  Build the perfect hash of WORD_COUNT words and write the packed image of the list
+    Returns the number of bytes written, or 0 when out_len is too small, a word repeats, or the words do not fit the format
+*/
+size_t __crawdog_mnemonic_wordlist_pack(
+    uint8_t *out,                       /* OUT:[out_len] */
+    size_t out_len,
+    const char *words,                  /* IN: every word back to back */
+    const uint16_t *offsets,            /* IN: [WORD_COUNT + 1] byte offset of every word in words */
+    const char *separator,
+    size_t separator_length);
+
+/*  Find a word in a word list
+    Returns the index of the word, or -1 when it is not in the list
+*/
+int __crawdog_mnemonic_lookup(
+    const __crawdog_mnemonic_wordlist *list,
+    const char *word,                   /* IN: [len] bytes, no terminator needed */
+    size_t len);
+
+/*  Returns the word at index and writes its length in bytes to len
+*/
+const char *__crawdog_mnemonic_word(
+    const __crawdog_mnemonic_wordlist *list,
+    uint16_t index,
+    size_t *len);
+
+/*  Split data into word_count 11 bit word indices, most significant bit first
+    Reads (11 * word_count + 7) / 8 bytes of data
+*/
+void __crawdog_mnemonic_split(
+    uint16_t *indices,                  /* OUT:[word_count] */
+    const uint8_t *data,
+    size_t word_count);
+
+/*  Join word_count 11 bit word indices into data, most significant bit first
+    Writes (11 * word_count + 7) / 8 bytes, the unused low bits of the last byte are zero
+*/
+void __crawdog_mnemonic_join(
+    uint8_t *data,
+    const uint16_t *indices,            /* IN: [word_count] */
+    size_t word_count);
+
+/*  Write the sentence of word_count words that data splits into
+    Returns the number of bytes written, or 0 when out_len is too small
+*/
+size_t __crawdog_mnemonic_encode(
+    const __crawdog_mnemonic_wordlist *list,
+    char *out,                          /* OUT:[out_len] */
+    size_t out_len,
+    const uint8_t *data,                /* IN: (11 * word_count + 7) / 8 bytes */
+    size_t word_count);
+
+/*  Look up every word of a sentence, separated by the separator of the list or an ASCII space, and join them into data
+    Returns __CRAWDOG_MNEMONIC_OK or one of the error codes
+*/
+int __crawdog_mnemonic_decode(
+    const __crawdog_mnemonic_wordlist *list,
+    uint8_t *data,                      /* OUT:[(11 * MAX_SENTENCE_WORDS + 7) / 8] */
+    size_t *word_count,                 /* OUT: the number of words in the sentence */
+    const char *sentence,               /* IN: [len] bytes */
+    size_t len,
+    size_t *error_offset,               /* OUT: offset of the unknown word */
+    size_t *error_length);              /* OUT: length of the unknown word, in bytes */
+
+#endif // __CRAWDOG_MNEMONIC_H
@@ -5,6 +5,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <sys/uio.h>
 
 #define __CRAWDOG_SHA1_HASH_SIZE					( 160 / 8 )
 #define __CRAWDOG_SHA1_BLOCK_SIZE 		64
@@ -25,6 +26,9 @@ void __crawdog_sha1_init(__crawdog_sha1_context* Context);
 // update the hasher with new date
 void __crawdog_sha1_update(__crawdog_sha1_context* Context, void const* Buffer, uint32_t BufferSize);
 
+// update the hasher with a chain of fragments, in order. partial blocks carry over between fragments.
+void __crawdog_sha1_updatev(__crawdog_sha1_context* Context, struct iovec const* Vectors, size_t VectorCount);
+
 // finish the hasher
 void __crawdog_sha1_finish(__crawdog_sha1_context* Context, __crawdog_sha1_output* Digest);
 
@@ -5,6 +5,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <sys/uio.h>
 
 #define __CRAWDOG_SHA256_HASH_SIZE           ( 256 / 8 )
 #define __CRAWDOG_SHA256_BLOCK_SIZE          64
@@ -27,6 +28,9 @@ void __crawdog_sha256_init(__crawdog_sha256_context* Context);
 // update the hasher with new date
 void __crawdog_sha256_update(__crawdog_sha256_context* Context, void const* Buffer, uint32_t BufferSize);
 
+// update the hasher with a chain of fragments, in order. partial blocks carry over between fragments.
+void __crawdog_sha256_updatev(__crawdog_sha256_context* Context, struct iovec const* Vectors, size_t VectorCount);
+
 // finish hashing
 void __crawdog_sha256_finish(__crawdog_sha256_context* Context, __crawdog_sha256_output* Digest);
 
@@ -183,6 +183,37 @@ void __crawdog_sha512_update(
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  __crawdog_sha512_updatev
+//
+//  Adds a chain of fragments to the SHA512 context, in order. The result is the same as calling __crawdog_sha512_update
+//  on every fragment, partial blocks carry over between fragments in the context buffer.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void __crawdog_sha512_updatev(
+        __crawdog_sha512_context*      Context,        // [in out]
+        struct iovec const* Vectors,        // [in]
+        size_t              VectorCount     // [in]
+    )
+{
+    size_t i;
+    size_t remaining;
+    uint8_t const* data;
+    uint32_t n;
+
+    for( i = 0; i < VectorCount; i++ )
+    {
+        data = (uint8_t const*)Vectors[i].iov_base;
+        remaining = Vectors[i].iov_len;
+        while( remaining > 0 )
+        {
+            n = remaining > 0x80000000UL ? 0x80000000UL : (uint32_t)remaining;
+            __crawdog_sha512_update( Context, data, n );
+            data += n;
+            remaining -= n;
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //  Sha512Finalise
 //
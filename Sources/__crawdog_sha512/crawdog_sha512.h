@@ -5,6 +5,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <sys/uio.h>
 
 #define __CRAWDOG_SHA512_HASH_SIZE			( 512 / 8 )
 #define __CRAWDOG_SHA512_BLOCK_SIZE			128
@@ -27,6 +28,9 @@ void __crawdog_sha512_init(__crawdog_sha512_context *Context);
 // update with new bytes
 void __crawdog_sha512_update(__crawdog_sha512_context* Context, void const* Buffer, uint32_t BufferSize);
 
+// update the hasher with a chain of fragments, in order. partial blocks carry over between fragments.
+void __crawdog_sha512_updatev(__crawdog_sha512_context* Context, struct iovec const* Vectors, size_t VectorCount);
+
 // finish
 void __crawdog_sha512_finish(__crawdog_sha512_context* Context, __crawdog_sha512_output* Digest);
 
@@ -55,4 +55,31 @@ int __crawdog_xchachapoly_crypt(__crawdog_xchachapoly_ctx *ctx, const void *nonc
 
     // perform the actual encryption or decryption
     return __crawdog_chachapoly_crypt(&chacha_ctx, chacha_nonce, ad, ad_len, input, input_len, output, tag, tag_len, encrypt);
-}
\ No newline at end of file
+}
+
+/**
+ * Encrypt or decrypt a chain of input fragments with XChaCha20-Poly1305 into a
+ * contiguous output buffer. See __crawdog_chachapoly_cryptv.
+ */
+int __crawdog_xchachapoly_cryptv(__crawdog_xchachapoly_ctx *ctx, const void *nonce, const struct iovec *ad, size_t ad_count, const struct iovec *input, size_t input_count, void *output, void *tag, int tag_len, int encrypt) {
+
+	unsigned char subkey[XCHACHA_KEY_SIZE];
+	unsigned char chacha_nonce[CHACHA_NONCE_SIZE];
+
+	// derive subkey using HChaCha20
+	int result = __crawdog_hchacha20(subkey, nonce, ctx->key, (const unsigned char *)"expand 32-byte k");
+	if (result != 0) {
+		return -1;
+	}
+
+	struct __crawdog_chachapoly_ctx chacha_ctx;
+
+	// initialize ChaCha20-Poly1305 with derived subkey
+	__crawdog_chachapoly_init(&chacha_ctx, subkey, XCHACHA_KEY_SIZE);
+
+	// prepare nonce for ChaCha20-Poly1305 (last 8 bytes of the original nonce)
+	memcpy(chacha_nonce + 4, ((const unsigned char*)nonce) + 16, 8);
+	memset(chacha_nonce, 0, 4);
+
+	return __crawdog_chachapoly_cryptv(&chacha_ctx, chacha_nonce, ad, ad_count, input, input_count, output, tag, tag_len, encrypt);
+}
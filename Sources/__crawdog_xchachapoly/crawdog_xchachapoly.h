@@ -6,6 +6,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <sys/uio.h>
 
 #define XCHACHA_NONCE_SIZE 24
 #define CHACHA_NONCE_SIZE 12
@@ -31,4 +32,14 @@ void __crawdog_xchachapoly_init(__crawdog_xchachapoly_ctx *ctx, const void *key)
 /// @param ad_len the length of the associated data
 int __crawdog_xchachapoly_crypt(__crawdog_xchachapoly_ctx *ctx, const void *nonce, const void *ad, int ad_len, const void *input, int input_len, void *output, void *tag, int tag_len, int encrypt);
 
+/// @brief encrypt or decrypt a chain of input fragments with xchachapoly into a contiguous output buffer
+/// @param ctx the context to use
+/// @param nonce the 24 byte nonce to use
+/// @param ad the associated data fragments
+/// @param ad_count the number of associated data fragments
+/// @param input the input fragments
+/// @param input_count the number of input fragments
+/// @param output the output buffer, at least as large as all input fragments together
+int __crawdog_xchachapoly_cryptv(__crawdog_xchachapoly_ctx *ctx, const void *nonce, const struct iovec *ad, size_t ad_count, const struct iovec *input, size_t input_count, void *output, void *tag, int tag_len, int encrypt);
+
 #endif // __CRAWDOG_XCHACHAPOLY_H
@@ -189,5 +189,207 @@ extension rawdog_tests {
 			let base64Decoded = try RAW_base64.decode(base64Encoded)
 			#expect(base64Decoded == startBytes)
 		}
+
+		@Test("RAW_base64 :: bulk codec matches the per-character codec")
+		func testBulkMatchesPerCharacter() throws {
+			for length in [0, 1, 2, 3, 11, 12, 13, 15, 16, 17, 27, 28, 29, 47, 48, 49, 95, 96, 97, 1000, 4099] {
+				let bytes = try generateSecureRandomBytes(count:length)
+				let bulkString = String(RAW_base64.encode(bytes))
+				#expect(bulkString == String(perCharacter:RAW_base64.encode(bytes)))
+				#expect(try RAW_base64.decode(bulkString) == bytes)
+				#expect(try Decode.process(bytes:bulkString.utf8).0 == bytes)
+			}
+		}
+
+		@Test("RAW_base64 :: bulk decoder rejects malformed input")
+		func testBulkMalformedInput() throws {
+			let valid = String(RAW_base64.encode(try generateSecureRandomBytes(count:200)))
+			var characters = [UInt8](valid.utf8)
+			for position in [0, 1, 17, 100, characters.count - 5] {
+				let original = characters[position]
+				characters[position] = 0x2E // '.'
+				#expect(throws:RAW_base64.Error.self) { try RAW_base64.decode(String(decoding:characters, as:UTF8.self)) }
+				characters[position] = original
+			}
+			// padding in the middle of the input
+			#expect(throws:RAW_base64.Error.self) { try RAW_base64.decode("QUI=QUJD") }
+			// an incomplete quartet at the end
+			#expect(throws:RAW_base64.Error.self) { try RAW_base64.decode(String(valid.dropLast())) }
+			#expect(throws:RAW_base64.Error.self) { try RAW_base64.decode("QQ=A") }
+			#expect(throws:RAW_base64.Error.self) { try RAW_base64.decode("Q===") }
+			#expect(try RAW_base64.decode("QQ==") == [0x41])
+			#expect(try RAW_base64.decode("QUI=") == [0x41, 0x42])
+		}
+
+		/// the throughput of the bulk codec is measured by the base64_bulk benchmark of RAW_benchmarks.
+		@Test("RAW_base64 :: bulk codec round trips a large buffer")
+		func testBulkLargeRoundTrip() throws {
+			let bytes = try generateSecureRandomBytes(count:4 * 1024 * 1024 + 1)
+			let encoded = String(RAW_base64.encode(bytes))
+			#expect(encoded.utf8.count == (bytes.count + 2) / 3 * 4)
+			#expect(try RAW_base64.decode(encoded) == bytes)
+		}
+
+		@Test("RAW_base64 :: url safe, unpadded and constant time variants")
+		func testVariants() throws {
+			#expect(RAW_base64.encode([0xFB, 0xFF] as [UInt8], options:.url) == "-_8=")
+			#expect(RAW_base64.encode([0xFB, 0xFF] as [UInt8], options:.urlUnpadded) == "-_8")
+			#expect(RAW_base64.encode([0xFB, 0xFF] as [UInt8], options:.noPadding) == "+/8")
+			let everyOptions:[RAW_base64.Options] = [[], .url, .noPadding, .urlUnpadded, .constantTime, [.url, .constantTime], [.urlUnpadded, .constantTime]]
+			for length in [0, 1, 2, 3, 4, 5, 47, 48, 49, 100, 1000] {
+				let bytes = try generateSecureRandomBytes(count:length)
+				let standard = String(RAW_base64.encode(bytes))
+				for options in everyOptions {
+					var expected = standard
+					if options.contains(.url) {
+						expected = String(expected.map { $0 == "+" ? "-" : ($0 == "/" ? "_" : $0) })
+					}
+					if options.contains(.noPadding) {
+						expected = String(expected.prefix { $0 != "=" })
+					}
+					let encoded = RAW_base64.encode(bytes, options:options)
+					#expect(encoded == expected)
+					#expect(try RAW_base64.decode(encoded, options:options) == bytes)
+
+					var encoder = StreamingEncoder(lineLength:64, options:options)
+					var streamed = [UInt8]()
+					bytes.withUnsafeBytes { encoder.update($0) { streamed.append(contentsOf:$0) } }
+					encoder.finish { streamed.append(contentsOf:$0) }
+					var decoder = StreamingDecoder(options:options)
+					var decoded = [UInt8]()
+					try streamed.withUnsafeBytes { try decoder.update($0) { decoded.append(contentsOf:$0) } }
+					try decoder.finish { decoded.append(contentsOf:$0) }
+					#expect(String(decoding:streamed.filter { $0 != 0x0D && $0 != 0x0A }, as:UTF8.self) == expected)
+					#expect(decoded == bytes)
+				}
+			}
+			// characters of the other alphabet
+			#expect(throws:RAW_base64.Error.self) { try RAW_base64.decode("-_8=") }
+			#expect(throws:RAW_base64.Error.self) { try RAW_base64.decode("+/8=", options:.url) }
+			// padding where none is expected, and lengths that no unpadded encoding has
+			#expect(throws:RAW_base64.Error.self) { try RAW_base64.decode("QQ==", options:.noPadding) }
+			#expect(throws:RAW_base64.Error.self) { try RAW_base64.decode("QUJDQ", options:.urlUnpadded) }
+			#expect(try RAW_base64.decode("QUJDQQ", options:.urlUnpadded) == [0x41, 0x42, 0x43, 0x41])
+			#expect(throws:RAW_base64.Error.self) { try RAW_base64.decode("QUJ.", options:.constantTime) }
+			// constant time rejection does not say which character was rejected, wherever it is
+			let secret = String(RAW_base64.encode([UInt8](repeating:0x5A, count:96)))
+			for position in [0, 17, 63, secret.utf8.count - 1] {
+				var characters = Array(secret)
+				characters[position] = "."
+				for options in [.constantTime, [.constantTime, .url]] as [RAW_base64.Options] {
+					let error = #expect(throws:RAW_base64.Error.self) { try RAW_base64.decode(String(characters), options:options) }
+					guard case .invalidEncoding = error else {
+						Issue.record("expected a generic invalid encoding error")
+						continue
+					}
+				}
+			}
+		}
+
+		/// feeds `input` through a streaming encoder or decoder in chunks of random size, draining into output buffers of random size.
+		static func stream(_ input:[UInt8], outputCounts:ClosedRange<Int>, _ update:(UnsafeRawBufferPointer, UnsafeMutableRawBufferPointer) throws -> (consumed:Int, written:Int)) throws -> [UInt8] {
+			var output = [UInt8]()
+			var buffer = [UInt8](repeating:0, count:outputCounts.upperBound)
+			var offset = 0
+			while offset < input.count {
+				let chunk = Int.random(in:1...min(997, input.count - offset))
+				var remaining = chunk
+				while remaining > 0 {
+					let outputCount = Int.random(in:outputCounts)
+					let (consumed, written) = try input.withUnsafeBytes { inputBytes in
+						try buffer.withUnsafeMutableBytes { outputBytes in
+							try update(UnsafeRawBufferPointer(rebasing:inputBytes[(offset + chunk - remaining)..<(offset + chunk)]), UnsafeMutableRawBufferPointer(rebasing:outputBytes.prefix(outputCount)))
+						}
+					}
+					output.append(contentsOf:buffer.prefix(written))
+					remaining -= consumed
+				}
+				offset += chunk
+			}
+			return output
+		}
+
+		@Test("RAW_base64 :: streaming codec matches the bulk codec for any chunking")
+		func testStreaming() throws {
+			for length in [0, 1, 2, 3, 4, 56, 57, 58, 100, 1000, 4099] {
+				let bytes = try generateSecureRandomBytes(count:length)
+				let expected = [UInt8](String(RAW_base64.encode(bytes)).utf8)
+				for lineLength in [0, 4, 64, 76] {
+					var encoder = StreamingEncoder(lineLength:lineLength)
+					var encoded = try Self.stream(bytes, outputCounts:StreamingEncoder.minimumOutputCount...40) { encoder.update($0, into:$1) }
+					var tail = [UInt8](repeating:0, count:StreamingEncoder.minimumOutputCount)
+					encoded += tail.prefix(tail.withUnsafeMutableBytes { encoder.finish(into:$0) })
+					let lines = encoded.split(separator:0x0A, omittingEmptySubsequences:false)
+					#expect(lines.dropLast().allSatisfy { $0.count == lineLength + 1 && $0.last == 0x0D })
+					#expect(encoded.filter { $0 != 0x0D && $0 != 0x0A } == expected)
+
+					var decoder = StreamingDecoder()
+					var decoded = try Self.stream(encoded, outputCounts:StreamingDecoder.minimumOutputCount...40) { try decoder.update($0, into:$1) }
+					try decoder.finish { decoded.append(contentsOf:$0) }
+					#expect(decoded == bytes)
+				}
+			}
+		}
+
+		@Test("RAW_base64 :: streaming decoder rejects malformed input")
+		func testStreamingMalformedInput() throws {
+			func decode(_ encoded:String, ignoringLineBreaks:Bool = true) throws -> [UInt8] {
+				var decoder = StreamingDecoder(ignoringLineBreaks:ignoringLineBreaks)
+				var decoded = [UInt8]()
+				for character in encoded.utf8 {
+					try withUnsafeBytes(of:character) {
+						try decoder.update($0) { decoded.append(contentsOf:$0) }
+					}
+				}
+				try decoder.finish { decoded.append(contentsOf:$0) }
+				return decoded
+			}
+			#expect(try decode("QU\r\nJD\nQQ==\r\n") == [0x41, 0x42, 0x43, 0x41])
+			#expect(throws:RAW_base64.Error.self) { try decode("QUJD\r\nQQ==", ignoringLineBreaks:false) }
+			#expect(throws:RAW_base64.Error.self) { try decode("QUJ.") }
+			#expect(throws:RAW_base64.Error.self) { try decode("QUI=QUJD") }
+			#expect(throws:RAW_base64.Error.self) { try decode("QUJDQ") }
+			#expect(throws:RAW_base64.Error.self) { try decode("QQ=A") }
+		}
+
+		/// the throughput of the streaming codec is measured by the base64_streaming benchmark of RAW_benchmarks.
+		@Test("RAW_base64 :: streaming codec round trips a large buffer")
+		func testStreamingLargeRoundTrip() throws {
+			let bytes = try generateSecureRandomBytes(count:4 * 1024 * 1024 + 1)
+			for lineLength in [0, 76] {
+				var encoded = [UInt8]()
+				var encoder = StreamingEncoder(lineLength:lineLength)
+				bytes.withUnsafeBytes { input in
+					encoder.update(input) { encoded.append(contentsOf:$0) }
+					encoder.finish { encoded.append(contentsOf:$0) }
+				}
+				#expect(encoded.filter { $0 != 0x0D && $0 != 0x0A } == Array(String(RAW_base64.encode(bytes)).utf8))
+				var decoded = [UInt8]()
+				var decoder = StreamingDecoder()
+				try encoded.withUnsafeBytes { input in
+					try decoder.update(input) { decoded.append(contentsOf:$0) }
+					try decoder.finish { decoded.append(contentsOf:$0) }
+				}
+				#expect(decoded == bytes)
+			}
+		}
+
+		@Test("RAW_base64 :: encode into a caller buffer")
+		func testEncodeIntoBuffer() throws {
+			for options in [[], .urlUnpadded] as [RAW_base64.Options] {
+				for length in [0, 1, 2, 3, 32, 64, 1000] {
+					let bytes = try generateSecureRandomBytes(count:length)
+					let expected = RAW_base64.encode(bytes, options:options)
+					let encodedLength = RAW_base64.encodedLength(length, options:options)
+					#expect(encodedLength == expected.utf8.count)
+					// the buffer may be larger than the encoded length, and nothing past it is touched
+					var buffer = [UInt8](repeating:0xAA, count:encodedLength + 8)
+					let written = buffer.withUnsafeMutableBytes { RAW_base64.encode(bytes, into:$0, options:options) }
+					#expect(written == encodedLength)
+					#expect(String(decoding:buffer.prefix(written), as:UTF8.self) == expected)
+					#expect(buffer.suffix(8) == [UInt8](repeating:0xAA, count:8))
+				}
+			}
+		}
 	}
-}
\ No newline at end of file
+}
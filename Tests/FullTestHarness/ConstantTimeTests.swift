@@ -0,0 +1,117 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import Testing
+import RAW
+import RAW_chachapoly
+import RAW_dh25519
+import RAW_hmac
+import RAW_sha256
+
+@RAW_staticbuff(bytes:24)
+fileprivate struct SecretBuff24:Sendable, RAW_staticbuff_secret {}
+
+/// the number of comparisons that went through the constant time comparison of the secrets below.
+nonisolated(unsafe) fileprivate var countedComparisons = 0
+
+/// a secret whose conformance is declared in an extension, out of sight of the macro.
+@RAW_staticbuff(bytes:24)
+fileprivate struct ExtensionSecretBuff24:Sendable {
+	borrowing func RAW_equals_constant_time(_ other:borrowing Self) -> Bool {
+		countedComparisons += 1
+		return withUnsafeBytes(of:self) { lhsBytes in
+			withUnsafeBytes(of:other) { rhsBytes in
+				RAW_constant_time_equal(lhsBytes.baseAddress!, rhsBytes.baseAddress!, count:24)
+			}
+		}
+	}
+}
+extension ExtensionSecretBuff24:RAW_staticbuff_secret {}
+
+/// a secret whose conformance is written with its module name.
+@RAW_staticbuff(bytes:24)
+fileprivate struct QualifiedSecretBuff24:Sendable, RAW.RAW_staticbuff_secret {
+	borrowing func RAW_equals_constant_time(_ other:borrowing Self) -> Bool {
+		countedComparisons += 1
+		return withUnsafeBytes(of:self) { lhsBytes in
+			withUnsafeBytes(of:other) { rhsBytes in
+				RAW_constant_time_equal(lhsBytes.baseAddress!, rhsBytes.baseAddress!, count:24)
+			}
+		}
+	}
+}
+
+extension rawdog_tests {
+	@Suite("RAW constant time equality",
+		.serialized
+	)
+	struct ConstantTimeTests {
+		@Test("RAW_constant_time_equal :: every length and every differing byte")
+		func testKernel() throws {
+			let a = try generateSecureRandomBytes(count:67)
+			for count in 0...a.count {
+				var b = a
+				#expect(RAW_constant_time_equal(a, b, count:count))
+				for i in 0..<count {
+					for bit in [0x01, 0x80] as [UInt8] {
+						b[i] ^= bit
+						#expect(RAW_constant_time_equal(a, b, count:count) == false)
+						b[i] ^= bit
+					}
+				}
+			}
+			a.withUnsafeBytes { aBytes in
+				#expect(RAW_constant_time_equal(aBytes, aBytes))
+				#expect(RAW_constant_time_equal(aBytes, UnsafeRawBufferPointer(rebasing:aBytes.dropLast())) == false)
+				#expect(RAW_constant_time_equal(UnsafeRawBufferPointer(start:nil, count:0), UnsafeRawBufferPointer(rebasing:aBytes.prefix(0))))
+			}
+		}
+
+		@Test("RAW_staticbuff_secret :: equality of secrets, guarded values and MACs")
+		func testSecrets() throws {
+			let bytes = try generateSecureRandomBytes(count:24)
+			let secret = SecretBuff24(RAW_staticbuff:bytes)
+			var flipped = bytes
+			flipped[23] ^= 1
+			#expect(secret == SecretBuff24(RAW_staticbuff:bytes))
+			#expect(secret != SecretBuff24(RAW_staticbuff:flipped))
+
+			// `==` goes through the constant time comparison wherever and however the conformance is declared
+			countedComparisons = 0
+			#expect(ExtensionSecretBuff24(RAW_staticbuff:bytes) == ExtensionSecretBuff24(RAW_staticbuff:bytes))
+			#expect(ExtensionSecretBuff24(RAW_staticbuff:bytes) != ExtensionSecretBuff24(RAW_staticbuff:flipped))
+			#expect(QualifiedSecretBuff24(RAW_staticbuff:bytes) == QualifiedSecretBuff24(RAW_staticbuff:bytes))
+			#expect(QualifiedSecretBuff24(RAW_staticbuff:bytes) != QualifiedSecretBuff24(RAW_staticbuff:flipped))
+			#expect(countedComparisons == 4)
+
+			let tag = RAW_chachapoly.Tag(RAW_staticbuff:[UInt8](bytes.prefix(16)))
+			#expect(tag == RAW_chachapoly.Tag(RAW_staticbuff:[UInt8](bytes.prefix(16))))
+			#expect(tag != RAW_chachapoly.Tag())
+
+			let guarded = try MemoryGuarded<RAW_dh25519.PrivateKey>.new()
+			let copy = guarded.RAW_access { MemoryGuarded<RAW_dh25519.PrivateKey>(RAW_decode:$0.baseAddress!, count:$0.count)! }
+			let other = try MemoryGuarded<RAW_dh25519.PrivateKey>.new()
+			#expect(guarded == copy)
+			#expect(guarded != other)
+			#expect(guarded.RAW_access { guarded.RAW_equals_constant_time(RAW_dh25519.PrivateKey(RAW_staticbuff:$0.baseAddress!)) })
+
+			let key = try generateSecureRandomBytes(count:32)
+			let message = [UInt8]("a message to authenticate".utf8)
+			let mac = try RAW_sha256.Hasher<RAW_sha256.Hash>.hmac(key:key, message:message)
+			#expect(try RAW_sha256.Hasher<RAW_sha256.Hash>.hmacVerify(key:key, message:message, expected:mac))
+			#expect(try RAW_sha256.Hasher<RAW_sha256.Hash>.hmacVerify(key:key, message:message + [0], expected:mac) == false)
+			// a truncated MAC is only accepted when the caller allows its length, and is then checked over its own length
+			for (length, minimumLength, accepted) in [(32, nil, true), (16, nil, false), (1, nil, false), (16, 16, true), (15, 16, false), (1, 16, false), (0, 1, false)] as [(Int, Int?, Bool)] {
+				var hmac = try HMAC<RAW_sha256.Hasher<RAW_sha256.Hash>>(key:key)
+				try hmac.update(message:message)
+				let truncated = try mac.RAW_access { macBuffer in
+					let expected = UnsafeRawBufferPointer(rebasing:UnsafeRawBufferPointer(macBuffer).prefix(length))
+					if let minimumLength = minimumLength {
+						return try hmac.verify(expected, minimumLength:minimumLength)
+					}
+					return try hmac.verify(expected)
+				}
+				#expect(truncated == accepted)
+			}
+		}
+	}
+}
@@ -0,0 +1,93 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import Testing
+import Foundation
+import RAW
+
+extension rawdog_tests {
+	@Suite("RAW_cursor")
+	struct CursorTests {
+		private static func temporaryFile(_ contents:[UInt8]) throws -> String {
+			let path = FileManager.default.temporaryDirectory.appendingPathComponent("raw_cursor_\(UUID().uuidString)").path
+			guard FileManager.default.createFile(atPath:path, contents:Data(contents)) else {
+				throw CocoaError(.fileWriteUnknown)
+			}
+			return path
+		}
+
+		@Test("RAW_cursor :: static records from a mapped file")
+		func testStaticRecords() throws {
+			let recordCount = 10_000
+			var contents = [UInt8]()
+			for i in 0..<recordCount {
+				contents += [UInt8(truncatingIfNeeded:i), UInt8(truncatingIfNeeded:i >> 8), 0xAA, 0xBB, 0xCC]
+			}
+			// a partial record at the end is never visited
+			contents += [1, 2, 3]
+			let path = try Self.temporaryFile(contents)
+			defer { try? FileManager.default.removeItem(atPath:path) }
+
+			let mapped = try RAW_mapped_file(path:path)
+			#expect(mapped.region.count == contents.count)
+			var visited = 0
+			for record in mapped.cursor().records(FixedBuff5.self) {
+				let expected:FixedBuff5 = [UInt8(truncatingIfNeeded:visited), UInt8(truncatingIfNeeded:visited >> 8), 0xAA, 0xBB, 0xCC]
+				#expect(record == expected)
+				visited += 1
+			}
+			#expect(visited == recordCount)
+
+			var cursor = mapped.cursor()
+			#expect(cursor.skip(5 * (recordCount - 1)))
+			#expect(cursor.next(FixedBuff5.self) != nil)
+			#expect(cursor.next(FixedBuff5.self) == nil)
+			#expect(cursor.remaining == 3)
+			#expect(cursor.next(count:3).map { [UInt8]($0) } == [1, 2, 3])
+			#expect(cursor.isAtEnd)
+		}
+
+		@Test("RAW_cursor :: length prefixed records")
+		func testLengthPrefixedRecords() throws {
+			let writer = RAW_serial_writer()
+			let records = (0..<300).map { [UInt8](repeating:UInt8(truncatingIfNeeded:$0), count:$0) }
+			for record in records {
+				writer.RAW_serialize_field(record)
+			}
+			var contents = writer.bytes()
+			// a record that claims more bytes than the file holds ends iteration
+			contents += [0x05, 0x01]
+			let path = try Self.temporaryFile(contents)
+			defer { try? FileManager.default.removeItem(atPath:path) }
+
+			let mapped = try RAW_mapped_file(path:path)
+			var iterator = mapped.cursor().lengthPrefixedRecords([UInt8].self, prefetchBytes:256)
+			var decoded = [[UInt8]]()
+			while let record = iterator.next() {
+				decoded.append(record)
+			}
+			#expect(decoded == records)
+			#expect(iterator.position.remaining == 2)
+
+			var cursor = iterator.position
+			let before = cursor.offset
+			#expect(cursor.nextLengthPrefixed([UInt8].self) == nil)
+			#expect(cursor.offset == before)
+			#expect(cursor.next([UInt8].self, count:2) == [0x05, 0x01])
+		}
+
+		@Test("RAW_cursor :: empty and missing files")
+		func testEmptyAndMissingFiles() throws {
+			let path = try Self.temporaryFile([])
+			defer { try? FileManager.default.removeItem(atPath:path) }
+			let mapped = try RAW_mapped_file(path:path)
+			var cursor = mapped.cursor()
+			#expect(cursor.isAtEnd)
+			#expect(cursor.next(FixedBuff5.self) == nil)
+			#expect(cursor.next(count:0)?.count == 0)
+			#expect(Array(cursor.records(FixedBuff5.self)).isEmpty)
+			#expect(throws:RAW_mapped_file.MapFailure.self) {
+				_ = try RAW_mapped_file(path:path + ".missing")
+			}
+		}
+	}
+}
@@ -33,6 +33,66 @@ extension rawdog_tests {
 			}
 		}
 		
+		@Test("RAW_ed25519 :: SigningService :: concurrent signing")
+		func testSigningServiceConcurrentSigning() async throws {
+			let secretKey = MemoryGuarded<RAW_dh25519.PrivateKey>(RAW_decode:try generateSecureRandomBytes(count:32), count:32)!
+			let (publicKey, privateKey) = try RAW_ed25519.generateKeys(secretKey:secretKey)
+			let service = try SigningService(contexts:4, refreshInterval:8)
+			#expect(service.count == 4)
+			let allValid = await withTaskGroup(of:Bool.self, returning:Bool.self) { group in
+				for i in 0..<64 {
+					group.addTask {
+						let message = [UInt8](repeating:UInt8(truncatingIfNeeded:i), count:i + 1)
+						var signature = [UInt8](repeating:0, count:64)
+						signature.RAW_access_mutating { signatureBuffer in
+							message.RAW_access { messageBuffer in
+								service.sign(to:signatureBuffer.baseAddress!, privateKey:privateKey, message:messageBuffer)
+							}
+						}
+						return signature.RAW_access { signatureBuffer in
+							message.RAW_access { messageBuffer in
+								RAW_ed25519.verify(signature:signatureBuffer.baseAddress!, publicKey:publicKey, message:messageBuffer)
+							}
+						}
+					}
+				}
+				var result = true
+				for await isValid in group {
+					result = result && isValid
+				}
+				return result
+			}
+			#expect(allValid == true)
+		}
+
+		@Test("RAW_ed25519 :: multiScalarMultiply")
+		func testMultiScalarMultiply() throws {
+			var points = [PublicKey]()
+			for _ in 0..<200 {
+				let secretKey = MemoryGuarded<RAW_dh25519.PrivateKey>(RAW_decode:try generateSecureRandomBytes(count:32), count:32)!
+				points.append(try RAW_ed25519.generateKeys(secretKey:secretKey).0)
+			}
+			var one = Scalar(RAW_staticbuff:Scalar.RAW_staticbuff_zeroed())
+			one.RAW_access_mutating { $0[0] = 1 }
+			var two = Scalar(RAW_staticbuff:Scalar.RAW_staticbuff_zeroed())
+			two.RAW_access_mutating { $0[0] = 2 }
+
+			// 1*P = P
+			#expect(try multiScalarMultiply(scalars:[one], points:[points[0]]) == points[0])
+			// 1*P + 1*P = 2*P
+			#expect(try multiScalarMultiply(scalars:[one, one], points:[points[0], points[0]]) == multiScalarMultiply(scalars:[two], points:[points[0]]))
+			// the large batch (pippenger) agrees with the sum of two small batches (straus)
+			let all = try multiScalarMultiply(scalars:[Scalar](repeating:one, count:200), points:points)
+			let head = try multiScalarMultiply(scalars:[Scalar](repeating:one, count:100), points:Array(points[0..<100]))
+			let tail = try multiScalarMultiply(scalars:[Scalar](repeating:one, count:100), points:Array(points[100..<200]))
+			#expect(try multiScalarMultiply(scalars:[one, one], points:[head, tail]) == all)
+
+			let invalidPoint = PublicKey(RAW_decode:[0x02] + [UInt8](repeating:0, count:31) as [UInt8])!
+			#expect(throws:InvalidPointEncoding.self) {
+				try multiScalarMultiply(scalars:[one], points:[invalidPoint])
+			}
+		}
+
 		@Test("RAW_ed25519 :: VerificationContext :: lifecycle test")
 		func testVerificationContext() throws {
 			var randomPrivateKey = MemoryGuarded<RAW_dh25519.PrivateKey>(RAW_decode:try generateSecureRandomBytes(count:32), count:32)!
@@ -46,6 +46,43 @@ extension rawdog_tests {
 			}
 		}
 
+		@Test("RAW_hmac :: span updates match buffer updates")
+		func testSpanUpdates() throws {
+			let key = [UInt8](repeating:0x0B, count:20)
+			let message = [UInt8]("Hi There".utf8)
+			var viaBuffer = try RAW_hmac.HMAC<RAW_sha256.Hasher<RAW_sha256.Hash>>(key:key)
+			var viaSpan = try RAW_hmac.HMAC<RAW_sha256.Hasher<RAW_sha256.Hash>>(key:key)
+			try viaBuffer.update(message:message)
+			try message.RAW_access_span { span in
+				try viaSpan.update(message:span)
+			}
+			let expected = try viaBuffer.finish().RAW_access { [UInt8]($0) }
+			#expect(try viaSpan.finish().RAW_access { [UInt8]($0) } == expected)
+
+			var hasher = try RAW_sha256.Hasher<RAW_sha256.Hash>()
+			try message.RAW_access_rawspan { span in
+				try hasher.update(span)
+			}
+			var output:RAW_sha256.Hash? = nil
+			try hasher.finish(into:&output)
+			let expectedHash = try RAW_sha256.Hasher<RAW_sha256.Hash>.hash(message).RAW_access { [UInt8]($0) }
+			#expect(output!.RAW_access { [UInt8]($0) } == expectedHash)
+		}
+
+		@Test("RAW_hmac :: fragmented updates match contiguous updates")
+		func testFragmentedUpdates() throws {
+			let key = [UInt8](repeating:0x0B, count:20)
+			let message = [UInt8](repeating:0x61, count:300)
+			var contiguous = try RAW_hmac.HMAC<RAW_sha512.Hasher<RAW_sha512.Hash>>(key:key)
+			var fragmented = try RAW_hmac.HMAC<RAW_sha512.Hasher<RAW_sha512.Hash>>(key:key)
+			try contiguous.update(message:message)
+			try message.withUnsafeBytes { bytes in
+				try fragmented.update(messageFragments:[UnsafeRawBufferPointer(rebasing:bytes[0..<7]), UnsafeRawBufferPointer(rebasing:bytes[7..<135]), UnsafeRawBufferPointer(rebasing:bytes[135...])])
+			}
+			let expected = try contiguous.finish().RAW_access { [UInt8]($0) }
+			#expect(try fragmented.finish().RAW_access { [UInt8]($0) } == expected)
+		}
+
 		@Test("RAW_hmac :: test vector 2 (md5, sha1, sha256 & sha512)")
 		func testVector2() throws {
 			let key = [UInt8]("Jefe".utf8)
@@ -2,7 +2,8 @@
 // copyright (c) tanner silva 2024. all rights reserved.
 import Testing
 @testable import RAW_hex
-import struct RAW.size_t
+import RAW
+import RAW_dh25519
 
 extension rawdog_tests {
 	@Suite("RAW_hex",
@@ -27,5 +28,107 @@ extension rawdog_tests {
 				#expect(String(randomData) == encString)
 			}
 		}
+
+		@Test("RAW_hex :: bulk codec matches the per-element codec")
+		func testBulkMatchesPerElement() throws {
+			for length in [0, 1, 2, 15, 16, 17, 31, 32, 33, 63, 64, 65, 1000, 4099] {
+				let bytes = (0..<length).map { _ in UInt8.random(in:0...255) }
+				let bulkString = String(encode(bytes))
+				#expect(bulkString == String(perElement:encode(bytes)))
+				#expect(String(encode(bytes), uppercase:true) == bulkString.uppercased())
+				#expect(try decode(bulkString) == bytes)
+				#expect(try decode(bulkString.uppercased()) == bytes)
+				#expect(try decode(Array(bulkString)) == bytes)
+			}
+			// mixed case, and every kind of invalid character at every position of a vector block
+			var mixedCase:[UInt8] = [0x0a, 0xbc]
+			for _ in 0..<20 {
+				mixedCase += [0xde, 0xf0]
+			}
+			#expect(try decode("0aBc" + String(repeating:"dEf0", count:20)) == mixedCase)
+			let valid = String(repeating:"0123456789abcdef", count:8)
+			for position in stride(from:0, to:valid.utf8.count, by:7) {
+				for invalid in ["g", "G", "/", ":", "@", "`", " "] {
+					var characters = Array(valid)
+					characters[position] = Character(invalid)
+					#expect(throws:RAW_hex.Error.self) { try decode(String(characters)) }
+				}
+			}
+			#expect(throws:RAW_hex.Error.self) { try decode("abc") }
+			// non-ascii input is reported as the whole character, wherever its bytes fall in a vector block
+			for prefix in ["", "0a", String(repeating:"0123456789abcdef", count:2) + "0"] {
+				for invalid in ["\u{E9}", "\u{20AC}", "\u{1F600}"] as [Character] {
+					let error = #expect(throws:RAW_hex.Error.self) { try decode(prefix + String(invalid) + String(repeating:"0", count:40 + (prefix.utf8.count + invalid.utf8.count) % 2)) }
+					guard case .invalidHexEncodingCharacter(let reported) = error else {
+						Issue.record("expected an invalid character error")
+						continue
+					}
+					#expect(reported == invalid)
+				}
+			}
+		}
+
+		/// the throughput of the bulk codec is measured by the hex_bulk benchmark of RAW_benchmarks.
+		@Test("RAW_hex :: bulk codec matches the per-element codec on a large buffer")
+		func testBulkLargeBuffer() throws {
+			let bytes = (0..<(4 * 1024 * 1024 + 1)).map { _ in UInt8.random(in:0...255) }
+			let encoded = encode(bytes)
+			let bulkString = String(encoded)
+			#expect(bulkString == String(perElement:encoded))
+			#expect(try decode(bulkString) == bytes)
+			#expect(try decode(Array(bulkString)) == bytes)
+		}
+
+		@Test("RAW_hex :: encode straight to a string or a caller buffer")
+		func testEncodeIntoBuffer() throws {
+			for length in [0, 1, 15, 16, 32, 33, 1000] {
+				let bytes = (0..<length).map { _ in UInt8.random(in:0...255) }
+				let expected = String(encode(bytes))
+				#expect(encode(bytes, uppercase:false) == expected)
+				#expect(encode(bytes, uppercase:true) == expected.uppercased())
+				#expect(encodedLength(length) == expected.utf8.count)
+				// the buffer may be larger than the encoded length, and nothing past it is touched
+				var buffer = [UInt8](repeating:0xAA, count:encodedLength(length) + 8)
+				let written = buffer.withUnsafeMutableBytes { encode(bytes, into:$0) }
+				#expect(written == encodedLength(length))
+				#expect(String(decoding:buffer.prefix(written), as:UTF8.self) == expected)
+				#expect(buffer.suffix(8) == [UInt8](repeating:0xAA, count:8))
+			}
+		}
+
+		@Test("RAW_hex :: constant time decoding")
+		func testConstantTimeDecode() throws {
+			for length in [0, 1, 15, 16, 31, 32, 33, 64, 1000] {
+				let bytes = (0..<length).map { _ in UInt8.random(in:0...255) }
+				let encoded = encode(bytes, uppercase:Bool.random())
+				#expect(try decode(encoded, constantTime:true) == bytes)
+				guard length > 0 else {
+					continue
+				}
+				// the error is reported only after the whole input has been decoded, and the output is left zeroed
+				var characters = Array(encoded)
+				let position = Int.random(in:0..<characters.count)
+				characters[position] = "g"
+				var output = [UInt8](repeating:0xAA, count:length)
+				let error = #expect(throws:RAW_hex.Error.self) {
+					try output.withUnsafeMutableBytes { try decode(String(characters), into:$0, constantTime:true) }
+				}
+				#expect(output == [UInt8](repeating:0, count:length))
+				// the error does not say which character was rejected, or where
+				guard case .invalidEncoding = error else {
+					Issue.record("expected a generic invalid encoding error")
+					continue
+				}
+			}
+			#expect(throws:RAW_hex.Error.self) { try decode("abc", constantTime:true) }
+
+			// decoding a secret straight into guarded memory
+			let key = try MemoryGuarded<RAW_dh25519.PrivateKey>.new()
+			let keyString = key.RAW_access { encode($0, uppercase:false) }
+			let decodedKey = try MemoryGuarded<RAW_dh25519.PrivateKey>.blank()
+			try decode(keyString, into:decodedKey)
+			#expect(decodedKey == key)
+			#expect(throws:RAW_hex.Error.self) { try decode(String(keyString.dropLast(2)), into:decodedKey) }
+		}
 	}
-}
\ No newline at end of file
+}
@@ -45,5 +45,22 @@ extension rawdog_tests {
 
 			#expect(try RAW_sha256.Hasher<Hash>.hkdf(key: ikm, salt: salt, info: info, outputLength: outputLength) == expectedOKM)
 		}
+
+		@Test("RAW_kdf :: pbkdf2")
+		func testPBKDF2() throws {
+			// rfc 7914 §11, plus short outputs, an empty password and salt, and a password longer than a block
+			let vectors:[(password:String, salt:String, iterations:Int, expected:String)] = [
+				("passwd", "salt", 1, "55ac046e56e3089fec1691c22544b605f94185216dde0465e68b9d57c20dacbc49ca9cccf179b645991664b39d77ef317c71b845b1e30bd509112041d3a19783"),
+				("Password", "NaCl", 80000, "4ddcd8f60b98be21830cee5ef22701f9641a4418d04c0414aeff08876b34ab56a1d425a1225833549adb841b51c9b3176a272bdebba1d078478f62b397f33c8d"),
+				("password", "salt", 4096, "c5e478d59288c841aa530db6845c4c8d962893a001ce4e11a4963873aa98134af7ad98c1b458ce3f"),
+				("", "", 3, "b372796454d37ac042a195b62eeb7cfed38ddd92"),
+				(String(repeating:"k", count:100), "salt", 2, "2c1357648009149f57e4d5544c3435bbca87a6b231300fa3abb2a89b50f56ec3"),
+			]
+			for vector in vectors {
+				let expected = try RAW_hex.decode(vector.expected)
+				let derived = try RAW_sha256.Hasher<Hash>.pbkdf2(password:Array(vector.password.utf8), salt:Array(vector.salt.utf8), iterations:vector.iterations, outputLength:expected.count)
+				#expect(derived == expected)
+			}
+		}
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,55 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import Testing
+import RAW
+import CRAW
+import RAW_dh25519
+
+extension rawdog_tests {
+	@Suite("RAW MemoryGuarded",
+		.serialized
+	)
+	struct MemoryGuardedTests {
+		@Test("MemoryGuardedArena :: compute shared keys into slots")
+		func testSharedKeyArena() throws {
+			let localKey = try MemoryGuarded<RAW_dh25519.PrivateKey>.new()
+			var remotePublicKeys = [PublicKey]()
+			for _ in 0..<8 {
+				remotePublicKeys.append(PublicKey(privateKey:try MemoryGuarded<RAW_dh25519.PrivateKey>.new()))
+			}
+			let arena = try MemoryGuardedArena<SharedKey>(count:9)
+			arena.compute(firstSlot:1, privateKey:localKey, publicKeys:remotePublicKeys)
+			arena.compute(slot:0, privateKey:localKey, publicKey:remotePublicKeys[7])
+			for i in 0..<8 {
+				let expected = try MemoryGuarded<SharedKey>.compute(privateKey:localKey, publicKey:remotePublicKeys[i])
+				let matches = arena.RAW_access(slot:i + 1) { slotBuffer in
+					expected.RAW_access { expectedBuffer in
+						return Array(slotBuffer) == Array(expectedBuffer)
+					}
+				}
+				#expect(matches == true)
+			}
+			#expect(arena.RAW_access(slot:0) { Array($0) } == arena.RAW_access(slot:8) { Array($0) })
+			try arena.clear(slot:0)
+			#expect(arena.RAW_access(slot:0) { slotBuffer in slotBuffer.allSatisfy { $0 == 0 } } == true)
+		}
+
+		@Test("MemoryGuarded :: keys share locked slab pages")
+		func testMemoryGuardedSlabs() throws {
+			var keys = [MemoryGuarded<RAW_dh25519.PrivateKey>]()
+			keys.reserveCapacity(10_000)
+			for _ in 0..<10_000 {
+				keys.append(try MemoryGuarded<RAW_dh25519.PrivateKey>.blank())
+			}
+			#expect(keys.allSatisfy { key in key.RAW_access { $0.allSatisfy { $0 == 0 } } })
+			var slabs:size_t = 0
+			var slots:size_t = 0
+			var lockedBytes:size_t = 0
+			__craw_locked_stats(&slabs, &slots, &lockedBytes)
+			// a page per key would lock at least 40MB
+			#expect(slots >= 10_000)
+			#expect(lockedBytes < 2 * 1024 * 1024)
+			keys.removeAll()
+		}
+	}
+}
@@ -1,5 +1,7 @@
 import Testing
+import Foundation
 @testable import RAW_mnemonic
+import __crawdog_mnemonic
 
 fileprivate func hexToBytes(_ hex: String) -> [UInt8] {
 	var bytes = [UInt8]()
@@ -158,4 +160,136 @@ struct RAW_mnemonicTests {
 			#expect(bytes == entropyBytes)
 		}
 	}
+
+	@Suite("WordListTests")
+	struct WordListTests {
+		/// the generated english tables are the ones that the packer builds from `wordlist_EN.txt`.
+		@Test func testGeneratedEnglishTables() throws {
+			let path = URL(fileURLWithPath:#filePath).deletingLastPathComponent().appendingPathComponent("../../Sources/RAW_mnemonic/wordlist_EN.txt").standardized.path
+			let words = try String(contentsOfFile:path, encoding:.utf8).split(separator:"\n").map { String($0) }
+			#expect((0..<WordList.count).allSatisfy { WordList.english[$0] == words[$0] })
+			let generated = WordList.english.list.pointee
+			let built = try WordList(words:words)
+			withExtendedLifetime(built) {
+				let packed = built.list.pointee
+				#expect(packed.bucket_count == generated.bucket_count)
+				#expect(packed.slot_count == generated.slot_count)
+				#expect(packed.max_word_length == generated.max_word_length)
+				#expect(memcmp(packed.offsets, generated.offsets, MemoryLayout<UInt16>.size * (WordList.count + 1)) == 0)
+				#expect(memcmp(packed.displacements, generated.displacements, MemoryLayout<UInt16>.size * Int(generated.bucket_count)) == 0)
+				#expect(memcmp(packed.slots, generated.slots, MemoryLayout<UInt16>.size * Int(generated.slot_count)) == 0)
+			}
+		}
+
+		@Test func testEveryWordRoundTrips() throws {
+			for index in 0..<WordList.count {
+				let word = WordList.english[index]
+				#expect(WordList.english.index(of:word) == index)
+				#expect(WordList.english.index(of:word + "s") != index)
+				#expect(WordList.english.index(of:String(word.dropLast())) != index)
+			}
+			#expect(WordList.english.index(of:"") == nil)
+			#expect(WordList.english.index(of:"bitcoin") == nil)
+			#expect(WordList.english.index(of:"Abandon") == nil)
+		}
+
+		@Test func testSentenceBuffers() throws {
+			for length in [16, 20, 24, 28, 32] {
+				let entropy = (0..<length).map { _ in UInt8.random(in:0...255) }
+				let words = try entropy.withUnsafeBufferPointer { try Mnemonic.encode($0) }
+				var sentence = [UInt8](repeating:0, count:Mnemonic.maximumSentenceByteCount(bytes:length))
+				let written = try entropy.withUnsafeBufferPointer { entropyBuffer in
+					try sentence.withUnsafeMutableBytes { try Mnemonic.encode(entropyBuffer, into:$0) }
+				}
+				#expect(String(decoding:sentence.prefix(written), as:UTF8.self) == words.joined(separator:" "))
+				var decoded = [UInt8](repeating:0, count:32)
+				let decodedCount = try decoded.withUnsafeMutableBytes { decodedBuffer in
+					try sentence.prefix(written).withUnsafeBytes { try Mnemonic.decode(sentence:$0, into:decodedBuffer) }
+				}
+				#expect(Array(decoded.prefix(decodedCount)) == entropy)
+			}
+			var decoded = [UInt8](repeating:0, count:32)
+			try decoded.withUnsafeMutableBytes { decodedBuffer in
+				#expect(throws:Mnemonic.Error.self) { try Mnemonic.decode(sentence:"abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon", into:decodedBuffer) }
+				#expect(throws:Mnemonic.Error.self) { try Mnemonic.decode(sentence:"abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abuot", into:decodedBuffer) }
+				#expect(throws:Mnemonic.Error.self) { try Mnemonic.decode(sentence:"abandon about", into:decodedBuffer) }
+				#expect(throws:Mnemonic.Error.self) { try Mnemonic.decode(sentence:"", into:decodedBuffer) }
+				#expect(try Mnemonic.decode(sentence:"abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about", into:decodedBuffer) == 16)
+			}
+		}
+
+		@Test func testPackedWordLists() throws {
+			let english = (0..<WordList.count).map { WordList.english[$0] }
+			let repacked = try WordList(packed:WordList.english.packed)
+			#expect(repacked.separator == " ")
+			#expect((0..<WordList.count).allSatisfy { repacked[$0] == english[$0] && repacked.index(of:english[$0]) == $0 })
+
+			// an ideographic space separates the words, as in the japanese list
+			let ideographic = try WordList(words:english, separator:"\u{3000}")
+			let entropy = (0..<32).map { _ in UInt8.random(in:0...255) }
+			let words = try entropy.withUnsafeBufferPointer { try Mnemonic.encode($0, wordList:ideographic) }
+			var sentence = [UInt8](repeating:0, count:Mnemonic.maximumSentenceByteCount(bytes:32, wordList:ideographic))
+			let written = try entropy.withUnsafeBufferPointer { entropyBuffer in
+				try sentence.withUnsafeMutableBytes { try Mnemonic.encode(entropyBuffer, wordList:ideographic, into:$0) }
+			}
+			#expect(String(decoding:sentence.prefix(written), as:UTF8.self) == words.joined(separator:"\u{3000}"))
+			var decoded = [UInt8](repeating:0, count:32)
+			for text in [words.joined(separator:"\u{3000}"), words.joined(separator:" ")] {
+				decoded = [UInt8](repeating:0, count:32)
+				#expect(try decoded.withUnsafeMutableBytes { try Mnemonic.decode(sentence:text, wordList:ideographic, into:$0) } == 32)
+				#expect(decoded == entropy)
+			}
+
+			// errors report the whole word and every word, even when a word starts with the lead byte of the separator
+			do {
+				_ = try decoded.withUnsafeMutableBytes { try Mnemonic.decode(sentence:(words.prefix(11) + ["\u{3042}\u{3044}\u{3046}"]).joined(separator:"\u{3000}"), wordList:ideographic, into:$0) }
+				Issue.record("an unknown word was decoded")
+			} catch Mnemonic.Error.unknownWord(let word) {
+				#expect(word == "\u{3042}\u{3044}\u{3046}")
+			}
+			do {
+				_ = try decoded.withUnsafeMutableBytes { try Mnemonic.decode(sentence:(words + ["abandon"]).joined(separator:"\u{3000}"), wordList:ideographic, into:$0) }
+				Issue.record("a sentence of 25 words was decoded")
+			} catch Mnemonic.Error.unsupportedWordCount(let count) {
+				#expect(count == 25)
+			}
+
+			// a mapped image is used in place
+			let path = FileManager.default.temporaryDirectory.appendingPathComponent("raw_mnemonic_\(UUID().uuidString)").path
+			#expect(FileManager.default.createFile(atPath:path, contents:Data(ideographic.packed)))
+			defer { try? FileManager.default.removeItem(atPath:path) }
+			let mapped = try WordList(mapping:path)
+			#expect(mapped.separator == "\u{3000}")
+			#expect((0..<WordList.count).allSatisfy { mapped.index(of:english[$0]) == $0 })
+
+			// decomposed words are found from precomposed input
+			var accented = english
+			accented[0] = "cafe\u{301}"
+			let accentedList = try WordList(words:accented)
+			#expect(accentedList.index(of:"caf\u{E9}") == 0)
+			#expect(accentedList.index(of:"cafe") == nil)
+			// compatibility forms are not folded
+			#expect(accentedList.index(of:"\u{FF43}af\u{E9}") == nil)
+
+			#expect(throws:WordList.Error.self) { try WordList(words:Array(english.dropLast())) }
+			#expect(throws:WordList.Error.self) { try WordList(words:english.dropLast() + ["abandon"]) }
+			#expect(throws:WordList.Error.self) { try WordList(words:english, separator:"") }
+			#expect(throws:WordList.Error.self) { try WordList(packed:Array(WordList.english.packed.dropLast())) }
+			#expect(throws:WordList.Error.self) { try WordList(packed:[]) }
+		}
+	}
+
+	@Suite("SeedTests")
+	struct SeedTests {
+		@Test func testSeed() throws {
+			// BIP39 reference vectors (the reference implementation uses the passphrase "TREZOR")
+			let abandon = "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about".split(separator:" ").map { String($0) }
+			#expect(try Mnemonic.seed(abandon, passphrase:"TREZOR") == hexToBytes("c55257c360c07c72029aebc1b53c05ed0362ada38ead3e3e9efa3708e53495531f09a6987599d18264c1e1c92f2cf141630c7a3c4ab7c81b2f001698e7463b04"))
+			#expect(try Mnemonic.seed(abandon) == hexToBytes("5eb00bbddcf069084889a8ab9155568165f5c453ccb85e70811aaed6f6da5fc19a5ac40b389cd370d086206dec8aa6c43daea6690f20ad3d8d48b2d2ce9e38e4"))
+			let legal = "legal winner thank year wave sausage worth useful legal winner thank year wave sausage worth useful legal will".split(separator:" ").map { String($0) }
+			var seed = [UInt8](repeating:0, count:Mnemonic.seedByteCount)
+			try seed.withUnsafeMutableBytes { try Mnemonic.seed(legal, passphrase:"TREZOR", into:$0) }
+			#expect(seed == hexToBytes("f2b94508732bcbacbcc020faefecfc89feafa6649a5491b8c952cede496c214a0c7b3c392d168748f2d4a612bada0753b52a1c7ac53c1e93abd5c6320b9e95dd"))
+		}
+	}
 }
@@ -3,6 +3,7 @@
 
 import Testing
 @testable import RAW
+import CRAW
 import func Foundation.memcpy
 
 extension rawdog_tests {
@@ -19,5 +20,46 @@ extension rawdog_tests {
 			}
 			#expect(decoded == [0x01, 0x02, 0x03])
 		}
+
+		@Test("DataPointerTests :: buffered secure random bytes")
+		func testSecureRandomBytes() async throws {
+			let large = try generateSecureRandomBytes(count:100_000)
+			#expect(large.count == 100_000)
+			#expect(large[0..<32] != large[32..<64])
+			#expect(try generateSecureRandomBytes(count:16) != generateSecureRandomBytes(count:16))
+			var filled = [UInt8](repeating:0, count:3000)
+			try filled.withUnsafeMutableBytes { try generateSecureRandomBytes(into:$0) }
+			#expect(filled.contains { $0 != 0 })
+			let nonces = try await withThrowingTaskGroup(of:[UInt8].self) { group in
+				for _ in 0..<8 {
+					group.addTask { try generateSecureRandomBytes(count:24) }
+				}
+				var all = Set<[UInt8]>()
+				for try await nonce in group {
+					all.insert(nonce)
+				}
+				return all
+			}
+			#expect(nonces.count == 8)
+		}
+
+		/// the throughput of the zeroing kernels is measured by the secure_zero benchmark of RAW_benchmarks.
+		@Test("DataPointerTests :: secure zero over unaligned regions")
+		func testSecureZeroUnaligned() throws {
+			let byteCount = 1024 * 1024
+			let buffer = UnsafeMutableRawBufferPointer.allocate(byteCount:byteCount + 1, alignment:64)
+			defer { buffer.deallocate() }
+			// start one byte in so the unaligned head and tail paths run too
+			let region = UnsafeMutableRawBufferPointer(rebasing:buffer[1...])
+			for length in [1, 7, 31, 33, 4095, byteCount] {
+				let prefix = UnsafeMutableRawBufferPointer(rebasing:region.prefix(length))
+				region.initializeMemory(as:UInt8.self, repeating:0xA5)
+				try secureZeroBytes(prefix)
+				#expect(prefix.allSatisfy { $0 == 0 })
+				#expect(region[length...].allSatisfy { $0 == 0xA5 })
+			}
+			region[byteCount - 1] = 1
+			#expect(__craw_assert_secure_zero_bytes(region.baseAddress!.assumingMemoryBound(to:UInt8.self), byteCount) != 0)
+		}
 	}
 }
\ No newline at end of file
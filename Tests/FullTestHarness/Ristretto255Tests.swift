@@ -0,0 +1,66 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import Testing
+import RAW
+@testable import RAW_ristretto255
+
+extension rawdog_tests {
+	@Suite("RAW_ristretto255",
+		.serialized
+	)
+	struct Ristretto255Tests {
+		@Test("RAW_ristretto255 :: generator multiples")
+		func testGeneratorMultiples() throws {
+			// RFC 9496 encoding of 2*B
+			let twoB = Element(RAW_decode:[0x6a, 0x49, 0x32, 0x10, 0xf7, 0x49, 0x9c, 0xd1, 0x7f, 0xec, 0xb5, 0x10, 0xae, 0x0c, 0xea, 0x23, 0xa1, 0x10, 0xe8, 0xd5, 0xb9, 0x01, 0xf8, 0xac, 0xad, 0xd3, 0x09, 0x5c, 0x73, 0xa3, 0xb9, 0x19] as [UInt8])!
+			#expect(twoB.isValid == true)
+			var one = Scalar(RAW_staticbuff:Scalar.RAW_staticbuff_zeroed())
+			one.RAW_access_mutating { $0[0] = 1 }
+			#expect(Element(multiplying:one) == Element.generator)
+			#expect(try Element.generator.adding(Element.generator) == twoB)
+			#expect(try twoB.subtracting(Element.generator) == Element.generator)
+			#expect(try Element.generator.subtracting(Element.generator) == Element.identity)
+		}
+
+		@Test("RAW_ristretto255 :: hash to group")
+		func testHashToGroup() throws {
+			let expected = Element(RAW_decode:[0x62, 0x7b, 0x99, 0x7b, 0x10, 0x4e, 0xe6, 0x25, 0x43, 0x35, 0x8e, 0x22, 0x57, 0x6c, 0x75, 0xa9, 0x8d, 0xff, 0x9d, 0xc5, 0xf3, 0x48, 0xd5, 0xab, 0x22, 0x86, 0x89, 0x73, 0x5d, 0x77, 0xb2, 0x58] as [UInt8])!
+			let message = [UInt8]("abc".utf8)
+			let domain = [UInt8]("QUUX-V01-CS02-with-ristretto255_XMD:SHA-512_R255MAP_RO_".utf8)
+			let hashed = try message.RAW_access { messageBuffer in
+				try domain.RAW_access { domainBuffer in
+					try Element(hashing:messageBuffer, domain:domainBuffer)
+				}
+			}
+			#expect(hashed == expected)
+			let oversizedDomain = [UInt8](repeating:0x41, count:256)
+			#expect(throws:InvalidDomainSeparationTag.self) {
+				try message.RAW_access { messageBuffer in
+					try oversizedDomain.RAW_access { domainBuffer in
+						try Element(hashing:messageBuffer, domain:domainBuffer)
+					}
+				}
+			}
+		}
+
+		@Test("RAW_ristretto255 :: scalar arithmetic")
+		func testScalarArithmetic() throws {
+			let a = try Scalar.random()
+			let b = try Scalar.random()
+			#expect(a.isCanonical == true)
+			#expect(a.adding(b).subtracting(b) == a)
+			#expect(a.adding(a.negated()) == Scalar(RAW_staticbuff:Scalar.RAW_staticbuff_zeroed()))
+			#expect(try a.multiplied(by:b).multiplied(by:b.inverted()) == a)
+			#expect(throws:ZeroScalarInversion.self) {
+				try Scalar(RAW_staticbuff:Scalar.RAW_staticbuff_zeroed()).inverted()
+			}
+
+			// (a*b)*B == b*(a*B)
+			let aB = Element(multiplying:a)
+			#expect(try aB.multiplied(by:b) == Element(multiplying:a.multiplied(by:b)))
+			#expect(throws:InvalidElementEncoding.self) {
+				try Element(RAW_decode:[UInt8](repeating:0xFF, count:32))!.multiplied(by:a)
+			}
+		}
+	}
+}
@@ -0,0 +1,152 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import Testing
+import RAW
+
+@RAW_serializable
+fileprivate struct SerialHeader:Equatable {
+	var version:UInt16
+	var flags:UInt32
+	var compressed:Bool
+	var tag:FixedBuff5
+}
+
+@RAW_serializable
+fileprivate struct SerialCounters:Equatable {
+	var low:UInt32
+	var high:Int64
+	var enabled:Bool
+}
+
+@RAW_serializable
+fileprivate struct SerialEntry:Equatable {
+	var key:String
+	var value:[UInt8]
+}
+
+@RAW_serializable
+fileprivate struct SerialMessage:Equatable {
+	var header:SerialHeader
+	var sequence:Int64
+	var entries:[SerialEntry]
+	var trailer:SerialEntry
+	var computedLength:Int {
+		return entries.count
+	}
+}
+
+@RAW_serializable
+fileprivate struct SerialPlatformIntegers:Equatable {
+	var signed:Int
+	var unsigned:UInt
+}
+
+extension rawdog_tests {
+	@Suite("RAW_serializable")
+	struct SerializationTests {
+		@Test("RAW_serializable :: varint boundaries")
+		func testVarintBoundaries() throws {
+			let writer = RAW_serial_writer(capacity:1)
+			let values:[UInt64] = [0, 1, 127, 128, 16_383, 16_384, UInt64(UInt32.max), UInt64.max]
+			for value in values {
+				writer.write(varint:value)
+			}
+			#expect(writer.count == values.reduce(0) { $0 + RAW_varint.byteCount($1) })
+			#expect(RAW_varint.byteCount(UInt64.max) == RAW_varint.maximumByteCount)
+			try writer.RAW_access { buffer in
+				var reader = RAW_serial_reader(UnsafeRawBufferPointer(buffer))
+				for value in values {
+					#expect(try reader.readVarint() == value)
+				}
+				try reader.finish()
+			}
+			// eleven continuation bytes can not be a 64 bit varint
+			let overlong = [UInt8](repeating:0xFF, count:10) + [0x01]
+			overlong.withUnsafeBytes { bytes in
+				var reader = RAW_serial_reader(bytes)
+				#expect(throws:RAW_serial_error(kind:.varintOverflow, offset:0)) { try reader.readVarint() }
+			}
+		}
+
+		@Test("RAW_serializable :: fixed layouts are computed from the fields")
+		func testFixedLayout() throws {
+			#expect(SerialHeader.RAW_serial_fixed_size == 2 + 4 + 1 + 5)
+			#expect(SerialCounters.RAW_serial_fixed_size == 4 + 8 + 1)
+			#expect(SerialEntry.RAW_serial_fixed_size == nil)
+			#expect(SerialMessage.RAW_serial_fixed_size == nil)
+			let header = SerialHeader(version:3, flags:0xAABBCCDD, compressed:true, tag:[1, 2, 3, 4, 5])
+			let bytes = header.RAW_serialized()
+			#expect(bytes == [0x03, 0x00, 0xDD, 0xCC, 0xBB, 0xAA, 0x01, 1, 2, 3, 4, 5])
+			#expect(try bytes.withUnsafeBytes { try SerialHeader(RAW_deserialize:$0) } == header)
+		}
+
+		@Test("RAW_serializable :: Int and UInt are 8 bytes on every platform")
+		func testPlatformIntegers() throws {
+			#expect(SerialPlatformIntegers.RAW_serial_fixed_size == 8 + 8)
+			let value = SerialPlatformIntegers(signed:-2, unsigned:0x01020304)
+			let bytes = value.RAW_serialized()
+			#expect(bytes == [0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00])
+			#expect(try bytes.withUnsafeBytes { try SerialPlatformIntegers(RAW_deserialize:$0) } == value)
+			// a 64 bit value only decodes where the platform integer can hold it
+			let large:[UInt8] = [0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00] + [UInt8](repeating:0, count:8)
+			if Int.bitWidth < 64 {
+				#expect(throws:RAW_serial_error(kind:.integerOverflow, offset:0)) {
+					try large.withUnsafeBytes { try SerialPlatformIntegers(RAW_deserialize:$0) }
+				}
+			} else {
+				#expect(try large.withUnsafeBytes { try SerialPlatformIntegers(RAW_deserialize:$0) }.signed == 1 << 32)
+			}
+		}
+
+		@Test("RAW_serializable :: nested round trip through a reused writer")
+		func testNestedRoundTrip() throws {
+			let writer = RAW_serial_writer(capacity:16)
+			for round in 0..<4 {
+				let message = SerialMessage(
+					header:SerialHeader(version:UInt16(round), flags:0, compressed:false, tag:[9, 9, 9, 9, 9]),
+					sequence:-Int64(round),
+					entries:(0..<(round * 40)).map { SerialEntry(key:"key \($0) ✓", value:[UInt8](repeating:UInt8(truncatingIfNeeded:$0), count:$0)) },
+					trailer:SerialEntry(key:"", value:[])
+				)
+				writer.reset()
+				message.RAW_serialize(into:writer)
+				let decoded = try writer.RAW_access { buffer in
+					try SerialMessage(RAW_deserialize:UnsafeRawBufferPointer(buffer))
+				}
+				#expect(decoded == message)
+				#expect(writer.bytes() == message.RAW_serialized())
+			}
+			// the writer keeps the storage it grew into
+			let grownCapacity = writer.capacity
+			writer.reset()
+			#expect(writer.count == 0 && writer.capacity == grownCapacity)
+		}
+
+		@Test("RAW_serializable :: malformed input is rejected")
+		func testMalformedInput() throws {
+			let entry = SerialEntry(key:"hello", value:[1, 2, 3])
+			let bytes = entry.RAW_serialized()
+			for length in 0..<bytes.count {
+				#expect(throws:RAW_serial_error.self) {
+					try bytes[0..<length].withUnsafeBytes { try SerialEntry(RAW_deserialize:$0) }
+				}
+			}
+			#expect(throws:RAW_serial_error(kind:.trailingBytes, offset:bytes.count)) {
+				try (bytes + [0]).withUnsafeBytes { try SerialEntry(RAW_deserialize:$0) }
+			}
+			// a string field is not decoded with replacement characters
+			let invalidKey:[UInt8] = [0x02, 0xC3, 0x28, 0x00]
+			#expect(throws:RAW_serial_error(kind:.invalidUTF8, offset:0)) {
+				try invalidKey.withUnsafeBytes { try SerialEntry(RAW_deserialize:$0) }
+			}
+			// a byte field read through the reader is a view into the input
+			try bytes.withUnsafeBytes { input in
+				var reader = RAW_serial_reader(input)
+				_ = try reader.readLengthPrefixed()
+				let view = try reader.readLengthPrefixed()
+				#expect(view.baseAddress == input.baseAddress! + 7)
+				#expect([UInt8](view) == [1, 2, 3])
+			}
+		}
+	}
+}
@@ -0,0 +1,70 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import Testing
+import RAW
+import RAW_sha256
+
+extension rawdog_tests {
+	@Suite("RAW_staticbuff_table")
+	struct StaticbuffTableTests {
+		private static func digests(_ count:Int) throws -> [RAW_sha256.Hash] {
+			return try (0..<count).map { _ in try RAW_sha256.Hasher<RAW_sha256.Hash>.hash(try generateSecureRandomBytes(count:32)) }
+		}
+
+		@Test("RAW_staticbuff_table :: matches Dictionary through inserts, updates and removals")
+		func testAgainstDictionary() throws {
+			let keys = try Self.digests(20_000)
+			let table = RAW_staticbuff_table<RAW_sha256.Hash, Int>()
+			var reference = [RAW_sha256.Hash:Int]()
+			for (i, key) in keys.enumerated() {
+				#expect(table.updateValue(i, forKey:key) == nil)
+				reference[key] = i
+			}
+			#expect(table.count == keys.count)
+			#expect(table.updateValue(-1, forKey:keys[7]) == 7)
+			reference[keys[7]] = -1
+
+			// remove every other key so the remaining probes have to step over tombstones
+			for i in stride(from:0, to:keys.count, by:2) {
+				#expect(table.removeValue(forKey:keys[i]) == reference.removeValue(forKey:keys[i]))
+			}
+			#expect(table.removeValue(forKey:keys[0]) == nil)
+			#expect(table.count == reference.count)
+			for key in keys {
+				#expect(table[key] == reference[key])
+			}
+
+			// refilling reuses the tombstones
+			for i in stride(from:0, to:keys.count, by:2) {
+				table[keys[i]] = i
+				reference[keys[i]] = i
+			}
+			var visited = 0
+			table.forEach { key, value in
+				#expect(reference[key] == value)
+				visited += 1
+			}
+			#expect(visited == reference.count)
+
+			table.removeAll(keepingCapacity:true)
+			#expect(table.count == 0 && table.contains(keys[1]) == false)
+		}
+
+		@Test("RAW_staticbuff_table :: keys that are not uniform")
+		func testNonUniformKeys() throws {
+			#expect(FixedBuff5.RAW_staticbuff_is_uniform == false)
+			#expect(RAW_sha256.Hash.RAW_staticbuff_is_uniform)
+			// keys that share their first bytes still spread across the table
+			let table = RAW_staticbuff_table<FixedBuff5, Void>(minimumCapacity:1000)
+			let capacity = table.capacity
+			for i in 0..<1000 {
+				let key:FixedBuff5 = [0, 0, 0, UInt8(truncatingIfNeeded:i), UInt8(truncatingIfNeeded:i >> 8)]
+				#expect(table.insert(key))
+				#expect(table.insert(key) == false)
+			}
+			#expect(table.count == 1000 && table.capacity == capacity)
+			#expect(table.contains([0, 0, 0, 0xE7, 0x03]))
+			#expect(table.contains([0, 0, 0, 0xE8, 0x03]) == false)
+		}
+	}
+}
@@ -0,0 +1,91 @@
+// LICENSE MIT
+// copyright (c) tanner silva 2025. all rights reserved.
+import Testing
+import RAW
+import RAW_sha256
+
+@RAW_staticbuff(bytes:32)
+fileprivate struct Wordwise32:Sendable, Hashable, Equatable {}
+
+// an odd size exercises the byte tail after the last whole word
+@RAW_staticbuff(bytes:13)
+fileprivate struct Wordwise13:Sendable, Hashable, Equatable {}
+
+@RAW_staticbuff(bytes:3)
+fileprivate struct Wordwise3:Sendable, Equatable {}
+
+extension rawdog_tests {
+	@Suite("RAW_staticbuff word-wise operations")
+	struct StaticbuffWordwiseTests {
+		private static func random<S:RAW_staticbuff>(_:S.Type) throws -> S {
+			let bytes = try generateSecureRandomBytes(count:MemoryLayout<S.RAW_staticbuff_storetype>.size)
+			return S(RAW_staticbuff:bytes)
+		}
+
+		private static func bytes<S:RAW_staticbuff>(_ value:S) -> [UInt8] {
+			return value.RAW_access { [UInt8]($0) }
+		}
+
+		private static func checkOperations<S:RAW_staticbuff & Equatable>(_:S.Type) throws {
+			for _ in 0..<64 {
+				let a = try random(S.self)
+				let b = try random(S.self)
+				let ab = zip(bytes(a), bytes(b))
+				#expect(bytes(a ^ b) == ab.map { $0 ^ $1 })
+				#expect(bytes(a & b) == ab.map { $0 & $1 })
+				#expect(bytes(a | b) == ab.map { $0 | $1 })
+				#expect(bytes(~a) == bytes(a).map { ~$0 })
+				var c = a
+				c ^= b
+				c ^= b
+				#expect(c == a)
+				#expect(a == a && a != b)
+				#expect(a.RAW_equals_constant_time(a) && a.RAW_equals_constant_time(b) == false)
+
+				// a single flipped bit anywhere, including the tail, breaks equality
+				for i in 0..<MemoryLayout<S.RAW_staticbuff_storetype>.size {
+					var flipped = bytes(a)
+					flipped[i] ^= 0x10
+					let other = S(RAW_staticbuff:flipped)
+					#expect(a != other)
+					#expect(a.RAW_equals_constant_time(other) == false)
+				}
+			}
+		}
+
+		@Test("RAW_staticbuff :: word-wise bitwise operators and equality")
+		func testOperations() throws {
+			try Self.checkOperations(Wordwise32.self)
+			try Self.checkOperations(Wordwise13.self)
+			try Self.checkOperations(Wordwise3.self)
+		}
+
+		@Test("RAW_staticbuff :: hash prefix and hashing")
+		func testHashing() throws {
+			let value = Wordwise32(RAW_staticbuff:[UInt8](1...32))
+			#expect(value.RAW_hash_prefix == 0x0807060504030201)
+			#expect(Wordwise3(RAW_staticbuff:[0xAA, 0xBB, 0xCC]).RAW_hash_prefix == 0xCCBBAA)
+
+			var set = Set<Wordwise13>()
+			var values = [Wordwise13]()
+			for _ in 0..<1000 {
+				let v = try Self.random(Wordwise13.self)
+				values.append(v)
+				set.insert(v)
+			}
+			#expect(set.count == 1000)
+			#expect(values.allSatisfy { set.contains($0) })
+
+			// digests hash by their prefix
+			let digests = try (0..<1000).map { _ in try RAW_sha256.Hasher<RAW_sha256.Hash>.hash(try generateSecureRandomBytes(count:32)) }
+			var digestSet = Set(digests)
+			#expect(digestSet.count == 1000)
+			#expect(digestSet.insert(digests[500]).inserted == false)
+			var hasher = Swift.Hasher()
+			digests[0].hash(into:&hasher)
+			var prefixHasher = Swift.Hasher()
+			prefixHasher.combine(digests[0].RAW_hash_prefix)
+			#expect(hasher.finalize() == prefixHasher.finalize())
+		}
+	}
+}
@@ -2,6 +2,8 @@
 // copyright (c) tanner silva 2024. all rights reserved.
 import Testing
 import __crawdog_chachapoly_tests
+import RAW
+import RAW_chachapoly
 
 extension rawdog_tests {
 	@Suite("__crawdog_chachapoly_tests",
@@ -13,5 +15,100 @@ extension rawdog_tests {
 			#expect(__crawdog_chachapoly_test_rfc7539() == 0)
 			#expect(__crawdog_chachapoly_test_auth_only() == 0)
 		}
+
+		@Test("RAW_chachapoly :: span encryption matches buffer encryption")
+		func testSpanRoundTrip() throws {
+			let key = Key32(RAW_staticbuff:try generateSecureRandomBytes(count:32))
+			let nonce = Nonce(RAW_staticbuff:try generateSecureRandomBytes(count:12))
+			let associatedData = [UInt8]("header".utf8)
+			let plaintext = try generateSecureRandomBytes(count:300)
+
+			var bufferContext = Context(key:key)
+			var expected = [UInt8](repeating:0, count:plaintext.count)
+			let expectedTag = try associatedData.withUnsafeBufferPointer { ad in
+				try plaintext.withUnsafeBufferPointer { input in
+					try expected.withUnsafeMutableBufferPointer { output in
+						try bufferContext.encrypt(nonce:nonce, associatedData:ad, inputData:input, output:output.baseAddress!)
+					}
+				}
+			}
+
+			var spanContext = Context(key:key)
+			var ciphertext = [UInt8](repeating:0, count:plaintext.count)
+			let tag = try associatedData.RAW_access_span { ad in
+				try plaintext.RAW_access_span { input in
+					try ciphertext.RAW_access_span_mutating { output in
+						try spanContext.encrypt(nonce:nonce, associatedData:ad, inputData:input, output:&output)
+					}
+				}
+			}
+			#expect(ciphertext == expected)
+			#expect(tag == expectedTag)
+
+			var decryptContext = Context(key:key)
+			var decrypted = [UInt8](repeating:0, count:plaintext.count)
+			try associatedData.RAW_access_span { ad in
+				try ciphertext.RAW_access_span { input in
+					try decrypted.RAW_access_span_mutating { output in
+						try decryptContext.decrypt(tag:tag, nonce:nonce, associatedData:ad, inputData:input, output:&output)
+					}
+				}
+			}
+			#expect(decrypted == plaintext)
+		}
+
+		@Test("RAW_chachapoly :: fragmented encryption matches contiguous encryption")
+		func testFragmentedRoundTrip() throws {
+			let key = Key32(RAW_staticbuff:try generateSecureRandomBytes(count:32))
+			let nonce = Nonce(RAW_staticbuff:try generateSecureRandomBytes(count:12))
+			let associatedData = try generateSecureRandomBytes(count:37)
+			let plaintext = try generateSecureRandomBytes(count:517)
+			// fragment boundaries that fall inside chacha blocks and poly1305 blocks
+			let cuts = [0, 5, 64, 70, 200, 333, 517]
+
+			var contiguousContext = Context(key:key)
+			var expected = [UInt8](repeating:0, count:plaintext.count)
+			let expectedTag = try associatedData.withUnsafeBufferPointer { ad in
+				try plaintext.withUnsafeBufferPointer { input in
+					try expected.withUnsafeMutableBufferPointer { output in
+						try contiguousContext.encrypt(nonce:nonce, associatedData:ad, inputData:input, output:output.baseAddress!)
+					}
+				}
+			}
+
+			var fragmentContext = Context(key:key)
+			var ciphertext = [UInt8](repeating:0, count:plaintext.count)
+			let tag = try associatedData.withUnsafeBytes { ad in
+				try plaintext.withUnsafeBytes { input in
+					let adFragments = [UnsafeRawBufferPointer(rebasing:ad[0..<11]), UnsafeRawBufferPointer(rebasing:ad[11...])]
+					let inputFragments = (1..<cuts.count).map { UnsafeRawBufferPointer(rebasing:input[cuts[$0 - 1]..<cuts[$0]]) }
+					return try withUnsafeFragmentVectors(adFragments) { adVectors in
+						try withUnsafeFragmentVectors(inputFragments) { inputVectors in
+							try ciphertext.withUnsafeMutableBufferPointer { output in
+								try fragmentContext.encrypt(nonce:nonce, associatedFragments:adVectors, inputFragments:inputVectors, output:output.baseAddress!)
+							}
+						}
+					}
+				}
+			}
+			#expect(ciphertext == expected)
+			#expect(tag == expectedTag)
+
+			var decryptContext = Context(key:key)
+			var decrypted = [UInt8](repeating:0, count:plaintext.count)
+			try associatedData.withUnsafeBytes { ad in
+				try ciphertext.withUnsafeBytes { input in
+					let inputFragments = (1..<cuts.count).map { UnsafeRawBufferPointer(rebasing:input[cuts[$0 - 1]..<cuts[$0]]) }
+					try withUnsafeFragmentVectors([ad]) { adVectors in
+						try withUnsafeFragmentVectors(inputFragments) { inputVectors in
+							try decrypted.withUnsafeMutableBufferPointer { output in
+								try decryptContext.decrypt(tag:tag, nonce:nonce, associatedFragments:adVectors, inputFragments:inputVectors, output:output.baseAddress!)
+							}
+						}
+					}
+				}
+			}
+			#expect(decrypted == plaintext)
+		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1 @@
+../../Sources/__crawdog_curve25519/include/crawdog_ristretto255.h
\ No newline at end of file
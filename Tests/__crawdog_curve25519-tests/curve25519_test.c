@@ -25,11 +25,14 @@
 #include <stdio.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <time.h>
 #include "crawdog_external_calls.h"
 #include "crawdog_curve25519_mehdi.h"
 #include "curve25519_donna.h"
 #include "crawdog_curve25519_dh.h"
 #include "crawdog_ed25519_signature.h"
+#include "crawdog_ristretto255.h"
+#include "crawdog_sha512.h"
 
 #include <stdint.h>  // For uint32_t, uint64_t
 
@@ -461,9 +464,277 @@ int dh_test()
     return rc;
 }
 
+/* Sign/verify round trips over pseudo-random keys and messages. Exercises whichever
+   verification backend (scalar or AVX2) is selected at runtime on this host. */
+int verify_backend_test(int loops)
+{
+    int i, j, rc = 0;
+    U32 seed = 0x2545F491;
+    unsigned char sk[32], msg[96], sig[__CRAWDOG_ED25519_SIGNATURE_SIZE];
+    unsigned char pubKey[__CRAWDOG_ED25519_PUBLIC_KEY_SIZE];
+    unsigned char privKey[__CRAWDOG_ED25519_PRIVATE_KEY_SIZE];
+
+    printf("\n-- ed25519 -- verification backend test -------------------------\n");
+    for (i = 0; i < loops; i++)
+    {
+        for (j = 0; j < 32; j++) { seed = seed*1103515245 + 12345; sk[j] = (unsigned char)(seed >> 16); }
+        for (j = 0; j < 96; j++) { seed = seed*1103515245 + 12345; msg[j] = (unsigned char)(seed >> 16); }
+
+        __crawdog_ed25519_create_keypair(pubKey, privKey, 0, sk);
+        __crawdog_ed25519_sign_message(sig, privKey, 0, msg, i % 97);
+
+        if (!__crawdog_ed25519_verify_signature(sig, pubKey, msg, i % 97))
+        {
+            rc++;
+            printf("Valid signature REJECTED!!\n");
+            ecp_PrintBytes("sig", sig, __CRAWDOG_ED25519_SIGNATURE_SIZE);
+        }
+
+        /* any single bit flip in R or S must be rejected */
+        sig[i % __CRAWDOG_ED25519_SIGNATURE_SIZE] ^= (unsigned char)(1 << (i & 7));
+        if (__crawdog_ed25519_verify_signature(sig, pubKey, msg, i % 97))
+        {
+            rc++;
+            printf("Forged signature ACCEPTED!!\n");
+            ecp_PrintBytes("sig", sig, __CRAWDOG_ED25519_SIGNATURE_SIZE);
+        }
+    }
+    return rc;
+}
+
+/* Signing pool: every slot must produce signatures identical to unblinded signing,
+   before and after its blinding context is refreshed. */
+int signing_pool_test()
+{
+    int i, rc = 0;
+    size_t slot;
+    unsigned char sig[__CRAWDOG_ED25519_SIGNATURE_SIZE], ref[__CRAWDOG_ED25519_SIGNATURE_SIZE];
+    unsigned char pubKey[__CRAWDOG_ED25519_PUBLIC_KEY_SIZE];
+    unsigned char privKey[__CRAWDOG_ED25519_PRIVATE_KEY_SIZE];
+    void *pool = __crawdog_ed25519_signing_pool_init(3, secret_blind, sizeof(secret_blind), 4);
+
+    printf("\n-- ed25519 -- signing pool test ---------------------------------\n");
+    if (pool == 0 || __crawdog_ed25519_signing_pool_size(pool) != 3) return 1;
+
+    __crawdog_ed25519_create_keypair(pubKey, privKey, 0, sk1);
+    for (i = 0; i < 32; i++)
+    {
+        __crawdog_ed25519_sign_message(ref, privKey, 0, (const unsigned char*)&i, sizeof(i));
+        if (__crawdog_ed25519_signing_pool_sign(pool, sig, privKey, (const unsigned char*)&i, sizeof(i), &slot))
+        {
+            if (!__crawdog_ed25519_signing_pool_refresh(pool, slot, (const unsigned char*)&i, sizeof(i))) rc++;
+        }
+        if (slot >= 3 || memcmp(sig, ref, sizeof(sig)) != 0 ||
+            !__crawdog_ed25519_verify_signature(sig, pubKey, (const unsigned char*)&i, sizeof(i)))
+        {
+            rc++;
+            printf("Signing pool signature FAILED!!\n");
+            ecp_PrintBytes("sig", sig, __CRAWDOG_ED25519_SIGNATURE_SIZE);
+        }
+    }
+
+    __crawdog_ed25519_signing_pool_finish(pool);
+    return rc;
+}
+
+/* ristretto255 (RFC 9496): multiples of the generator 0*B .. 4*B */
+unsigned char r255_multiples[5][__CRAWDOG_RISTRETTO255_ELEMENT_SIZE] = {
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0xe2,0xf2,0xae,0x0a,0x6a,0xbc,0x4e,0x71,0xa8,0x84,0xa9,0x61,0xc5,0x00,0x51,0x5f,
+      0x58,0xe3,0x0b,0x6a,0xa5,0x82,0xdd,0x8d,0xb6,0xa6,0x59,0x45,0xe0,0x8d,0x2d,0x76 },
+    { 0x6a,0x49,0x32,0x10,0xf7,0x49,0x9c,0xd1,0x7f,0xec,0xb5,0x10,0xae,0x0c,0xea,0x23,
+      0xa1,0x10,0xe8,0xd5,0xb9,0x01,0xf8,0xac,0xad,0xd3,0x09,0x5c,0x73,0xa3,0xb9,0x19 },
+    { 0x94,0x74,0x1f,0x5d,0x5d,0x52,0x75,0x5e,0xce,0x4f,0x23,0xf0,0x44,0xee,0x27,0xd5,
+      0xd1,0xea,0x1e,0x2b,0xd1,0x96,0xb4,0x62,0x16,0x6b,0x16,0x15,0x2a,0x9d,0x02,0x59 },
+    { 0xda,0x80,0x86,0x27,0x73,0x35,0x8b,0x46,0x6f,0xfa,0xdf,0xe0,0xb3,0x29,0x3a,0xb3,
+      0xd9,0xfd,0x53,0xc5,0xea,0x6c,0x95,0x53,0x58,0xf5,0x68,0x32,0x2d,0xaf,0x6a,0x57 } };
+
+/* RFC 9496: non-canonical, negative and non-square encodings that must be rejected */
+unsigned char r255_bad_encodings[5][__CRAWDOG_RISTRETTO255_ELEMENT_SIZE] = {
+    { 0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+      0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff },
+    { 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+      0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f },
+    { 0xed,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+      0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f },
+    { 0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x26,0x94,0x8d,0x35,0xca,0x62,0xe6,0x43,0xe2,0x6a,0x83,0x17,0x73,0x32,0xe6,0xb6,
+      0xaf,0xeb,0x9d,0x08,0xe4,0x26,0x8b,0x65,0x0f,0x1f,0x5b,0xbd,0x8d,0x81,0xd3,0x71 } };
+
+/* RFC 9496: element derivation of SHA-512("Ristretto is traditionally a short shot of espresso coffee") */
+unsigned char r255_uniform_element[__CRAWDOG_RISTRETTO255_ELEMENT_SIZE] = {
+    0x30,0x66,0xf8,0x2a,0x1a,0x74,0x7d,0x45,0x12,0x0d,0x17,0x40,0xf1,0x43,0x58,0x53,
+    0x1a,0x8f,0x04,0xbb,0xff,0xe6,0xa8,0x19,0xf8,0x6d,0xfe,0x50,0xf4,0x4a,0x0a,0x46 };
+
+/* RFC 9380 K.3: expand_message_xmd(SHA-512, "abc", "QUUX-V01-CS02-with-expander-SHA512-256", 0x20) */
+unsigned char r255_xmd_abc[32] = {
+    0x0d,0xa7,0x49,0xf1,0x2f,0xbe,0x54,0x83,0xeb,0x06,0x6a,0x5f,0x59,0x50,0x55,0x67,
+    0x9b,0x97,0x6e,0x93,0xab,0xe9,0xbe,0x6f,0x0f,0x63,0x18,0xbc,0xe7,0xac,0xa8,0xdc };
+
+/* hash_to_group("abc", "QUUX-V01-CS02-with-ristretto255_XMD:SHA-512_R255MAP_RO_") */
+unsigned char r255_h2g_abc[__CRAWDOG_RISTRETTO255_ELEMENT_SIZE] = {
+    0x62,0x7b,0x99,0x7b,0x10,0x4e,0xe6,0x25,0x43,0x35,0x8e,0x22,0x57,0x6c,0x75,0xa9,
+    0x8d,0xff,0x9d,0xc5,0xf3,0x48,0xd5,0xab,0x22,0x86,0x89,0x73,0x5d,0x77,0xb2,0x58 };
+
+int ristretto255_test()
+{
+    int i, rc = 0;
+    struct __crawdog_sha512_context H;
+    unsigned char digest[__CRAWDOG_SHA512_HASH_SIZE];
+    unsigned char k[__CRAWDOG_RISTRETTO255_SCALAR_SIZE], ki[__CRAWDOG_RISTRETTO255_SCALAR_SIZE];
+    unsigned char P[__CRAWDOG_RISTRETTO255_ELEMENT_SIZE], Q[__CRAWDOG_RISTRETTO255_ELEMENT_SIZE];
+    static const char xmd_dst[] = "QUUX-V01-CS02-with-expander-SHA512-256";
+    static const char h2g_dst[] = "QUUX-V01-CS02-with-ristretto255_XMD:SHA-512_R255MAP_RO_";
+    static const char label[] = "Ristretto is traditionally a short shot of espresso coffee";
+
+    printf("\n-- ristretto255 -- group and scalar test ------------------------\n");
+
+    memset(k, 0, sizeof(k));
+    for (i = 0; i < 5; i++)
+    {
+        k[0] = (unsigned char)i;
+        __crawdog_ristretto255_scalarmult_base(P, k);
+        if (!__crawdog_ristretto255_is_valid(r255_multiples[i]) || memcmp(P, r255_multiples[i], sizeof(P)) != 0)
+        {
+            rc++;
+            printf("ristretto255 %d*B FAILED!!\n", i);
+            ecp_PrintHexBytes("P", P, sizeof(P));
+        }
+        if (i > 0)
+        {
+            __crawdog_ristretto255_add(Q, r255_multiples[i-1], r255_multiples[1]);
+            if (memcmp(Q, r255_multiples[i], sizeof(Q)) != 0) { rc++; printf("ristretto255 add FAILED!!\n"); }
+            __crawdog_ristretto255_sub(Q, r255_multiples[i], r255_multiples[1]);
+            if (memcmp(Q, r255_multiples[i-1], sizeof(Q)) != 0) { rc++; printf("ristretto255 sub FAILED!!\n"); }
+        }
+    }
+
+    for (i = 0; i < 5; i++)
+    {
+        if (__crawdog_ristretto255_is_valid(r255_bad_encodings[i]) ||
+            __crawdog_ristretto255_scalarmult(P, k, r255_bad_encodings[i]))
+        {
+            rc++;
+            printf("ristretto255 bad encoding %d ACCEPTED!!\n", i);
+        }
+    }
+
+    __crawdog_sha512_init(&H);
+    __crawdog_sha512_update(&H, label, sizeof(label) - 1);
+    __crawdog_sha512_finish(&H, (__crawdog_sha512_output*)digest);
+    __crawdog_ristretto255_from_uniform(P, digest);
+    if (memcmp(P, r255_uniform_element, sizeof(P)) != 0)
+    {
+        rc++;
+        printf("ristretto255 element derivation FAILED!!\n");
+        ecp_PrintHexBytes("P", P, sizeof(P));
+    }
+
+    __crawdog_ristretto255_expand_message_xmd(Q, sizeof(Q), (const unsigned char*)"abc", 3, (const unsigned char*)xmd_dst, sizeof(xmd_dst) - 1);
+    if (memcmp(Q, r255_xmd_abc, sizeof(Q)) != 0)
+    {
+        rc++;
+        printf("expand_message_xmd FAILED!!\n");
+        ecp_PrintHexBytes("uniform", Q, sizeof(Q));
+    }
+
+    __crawdog_ristretto255_hash_to_group(P, (const unsigned char*)"abc", 3, (const unsigned char*)h2g_dst, sizeof(h2g_dst) - 1);
+    if (memcmp(P, r255_h2g_abc, sizeof(P)) != 0)
+    {
+        rc++;
+        printf("ristretto255 hash_to_group FAILED!!\n");
+        ecp_PrintHexBytes("P", P, sizeof(P));
+    }
+
+    /* (1/k)*(k*P) = P and k*B via the variable base path matches the folded base path */
+    __crawdog_ristretto255_scalar_reduce(k, digest);
+    if (!__crawdog_ristretto255_scalar_is_canonical(k) || !__crawdog_ristretto255_scalar_invert(ki, k)) rc++;
+    __crawdog_ristretto255_scalarmult(Q, k, r255_uniform_element);
+    __crawdog_ristretto255_scalarmult(Q, ki, Q);
+    if (memcmp(Q, r255_uniform_element, sizeof(Q)) != 0) { rc++; printf("ristretto255 scalar inverse FAILED!!\n"); }
+
+    __crawdog_ristretto255_scalarmult(P, k, r255_multiples[1]);
+    __crawdog_ristretto255_scalarmult_base(Q, k);
+    if (memcmp(P, Q, sizeof(P)) != 0) { rc++; printf("ristretto255 scalarmult FAILED!!\n"); }
+
+    /* k - k = 0, k + (-k) = 0 */
+    __crawdog_ristretto255_scalar_sub(ki, k, k);
+    __crawdog_ristretto255_scalar_negate(P, k);
+    __crawdog_ristretto255_scalar_add(Q, k, P);
+    memset(P, 0, sizeof(P));
+    if (memcmp(ki, P, sizeof(P)) != 0 || memcmp(Q, P, sizeof(P)) != 0) { rc++; printf("ristretto255 scalar sub FAILED!!\n"); }
+    if (__crawdog_ristretto255_scalar_invert(ki, P)) rc++;
+
+    return rc;
+}
+
+/* Multi-scalar multiplication: Straus and Pippenger agree with each other and with
+   the linearity k1*P + k2*P = (k1 + k2)*P on real public keys */
+int msm_test(int count)
+{
+    int i, j, rc = 0;
+    U32 seed = 0x6C8E9CF5;
+    unsigned char sk[32], privKey[__CRAWDOG_ED25519_PRIVATE_KEY_SIZE];
+    unsigned char r1[32], r2[32], pair[64], ksum[32];
+    unsigned char *scalars = (unsigned char*)mem_alloc(32*count);
+    unsigned char *points = (unsigned char*)mem_alloc(32*count);
+    unsigned int c;
+
+    printf("\n-- ed25519 -- multi-scalar multiplication test ------------------\n");
+    if (scalars == 0 || points == 0) return 1;
+
+    for (i = 0; i < count; i++)
+    {
+        for (j = 0; j < 32; j++) { seed = seed*1103515245 + 12345; sk[j] = (unsigned char)(seed >> 16); }
+        __crawdog_ed25519_create_keypair(&points[32*i], privKey, 0, sk);
+        for (j = 0; j < 32; j++) { seed = seed*1103515245 + 12345; scalars[32*i + j] = (unsigned char)(seed >> 16); }
+    }
+
+    for (i = 1; i <= count; i += (i < 8) ? 1 : i)
+    {
+        if (!__crawdog_ed25519_multi_scalar_mult(r1, scalars, points, i, __CRAWDOG_ED25519_MSM_STRAUS) ||
+            !__crawdog_ed25519_multi_scalar_mult(r2, scalars, points, i, __CRAWDOG_ED25519_MSM_PIPPENGER) ||
+            memcmp(r1, r2, 32) != 0)
+        {
+            rc++;
+            printf("MSM of %d points FAILED!!\n", i);
+            ecp_PrintHexBytes("straus", r1, 32);
+            ecp_PrintHexBytes("pippenger", r2, 32);
+        }
+    }
+
+    /* k1*P + k2*P = (k1 + k2)*P, top bits of k1, k2 cleared so the sum does not overflow */
+    memcpy(pair, scalars, 64);
+    pair[31] &= 0x7F;
+    pair[63] &= 0x7F;
+    for (c = 0, j = 0; j < 32; j++)
+    {
+        c += pair[j] + pair[32 + j];
+        ksum[j] = (unsigned char)c;
+        c >>= 8;
+    }
+    memcpy(&points[32], &points[0], 32);
+    __crawdog_ed25519_multi_scalar_mult(r1, pair, points, 2, __CRAWDOG_ED25519_MSM_AUTO);
+    __crawdog_ed25519_multi_scalar_mult(r2, ksum, points, 1, __CRAWDOG_ED25519_MSM_AUTO);
+    if (memcmp(r1, r2, 32) != 0) { rc++; printf("MSM linearity FAILED!!\n"); }
+
+    /* points that are not on the curve must be rejected */
+    mem_fill(&points[0], 0, 32);
+    points[0] = 2;
+    if (__crawdog_ed25519_multi_scalar_mult(r1, scalars, points, 1, __CRAWDOG_ED25519_MSM_AUTO)) { rc++; printf("MSM invalid point ACCEPTED!!\n"); }
+
+    mem_free(scalars);
+    mem_free(points);
+    return rc;
+}
+
 int allTestsRelatedTo25519(int argc, char**argv)
 {
     int rc = 0;
+    (void)argc;
+    (void)argv;
 
 #ifdef ECP_SELF_TEST
     if (curve25519_SelfTest(0))
@@ -482,6 +753,14 @@ int allTestsRelatedTo25519(int argc, char**argv)
 
     rc += signature_test(sk1, pk1, msg1, sizeof(msg1), msg1_sig);
 
+    rc += verify_backend_test(256);
+
+    rc += signing_pool_test();
+
+    rc += ristretto255_test();
+
+    rc += msm_test(256);
+
     speed_test(1000);
 
     return rc;